@@ -0,0 +1,65 @@
+/**
+ * @file main.cpp
+ * @brief Sincronização no host (Linux) contra servidores NTP em loopback
+ *
+ * Este programa demonstra o build nativo da biblioteca: três servidores
+ * LoopbackServer respondem em 127.0.0.1, um deles com o horário errado, e
+ * NTPSync sincroniza o relógio de software do backend POSIX em modo
+ * paralelo. O falseticker deve ser descartado pela seleção.
+ *
+ * Compilação:
+ *   cmake -S . -B build && cmake --build build
+ *   ./build/host_loopback
+ *
+ * Retorna 0 se o relógio convergir para o offset esperado.
+ */
+
+#include <LoopbackServer.h>
+#include <NTPSync.h>
+#include <cstdio>
+#include <hal/PosixPlatform.h>
+#include <string>
+
+// Offset dos servidores corretos em relação ao relógio do host (us)
+#define EXPECTED_OFFSET_US 250000
+
+// Erro máximo aceito após a sincronização (us)
+#define TOLERANCE_US 5000
+
+int main()
+{
+    LoopbackServer good1, good2, falseticker;
+    good1.setOffsetUs(EXPECTED_OFFSET_US);
+    good2.setOffsetUs(EXPECTED_OFFSET_US);
+    falseticker.setOffsetUs(EXPECTED_OFFSET_US + 30000000); // 30 s adiantado
+
+    if (!good1.start() || !good2.start() || !falseticker.start())
+    {
+        printf("Falha ao abrir servidores em loopback\n");
+        return 1;
+    }
+
+    PosixNetwork network;
+    PosixClock clock;
+    PosixStorage storage;
+    PosixTasking tasking;
+    NTPSync::setPlatform({&network, &clock, &storage, &tasking});
+
+    auto server = [](const LoopbackServer &s)
+    { return "127.0.0.1:" + std::to_string(s.port()); };
+    NTPSync::setTimeval("UTC", {server(good1), server(good2), server(falseticker)});
+    NTPSync::setSyncMode(NTPSync::SyncMode::Parallel);
+
+    if (!NTPSync::syncTime())
+    {
+        printf("Sincronização falhou\n");
+        return 1;
+    }
+
+    NTPStatus status = NTPSync::getStatus();
+    int64_t error = clock.correctionUs() - EXPECTED_OFFSET_US;
+    printf("Sincronizado: offset aplicado %lld us, jitter %u us, erro %lld us\n",
+           (long long)status.offsetUs, status.jitterUs, (long long)error);
+
+    return (error > -TOLERANCE_US && error < TOLERANCE_US) ? 0 : 1;
+}
@@ -0,0 +1,77 @@
+#ifndef NTP_BENCH_H
+#define NTP_BENCH_H
+
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Parâmetros de linha de comando compartilhados pelos benchmarks
+ */
+struct BenchConfig
+{
+    std::string filter;     // Roda apenas benchmarks cujo nome contém o filtro
+    std::string output;     // Arquivo JSON; vazio escreve em stdout
+    uint32_t minTimeMs = 200; // Tempo mínimo por repetição (throughput)
+    uint8_t repetitions = 5;  // Repetições; reporta a mediana
+    uint8_t lossPercent = 0;  // Perda simulada nos servidores em loopback
+    uint32_t delayUs = 0;     // Atraso de resposta dos servidores em loopback
+    uint32_t jitterUs = 0;    // Variação aleatória somada ao atraso
+    uint32_t syncs = 50;      // Sincronizações por benchmark de latência
+};
+
+const BenchConfig &benchConfig();
+
+/**
+ * @brief Estado passado a cada benchmark
+ *
+ * Em benchmarks de throughput, a função executa iterations() vezes a
+ * operação medida e o harness divide o tempo total. Em benchmarks de
+ * latência, a função mede cada operação e reporta as estatísticas em
+ * counter().
+ */
+class BenchState
+{
+public:
+    explicit BenchState(uint64_t iterations) : _iterations(iterations) {}
+
+    uint64_t iterations() const { return _iterations; }
+    void counter(const char *name, double value) { _counters.emplace_back(name, value); }
+    const std::vector<std::pair<std::string, double>> &counters() const { return _counters; }
+
+private:
+    uint64_t _iterations;
+    std::vector<std::pair<std::string, double>> _counters;
+};
+
+typedef void (*BenchFunction)(BenchState &state);
+
+enum class BenchMode
+{
+    Throughput, // ns por operação, iterações calibradas pelo harness
+    Latency     // Executado uma vez; a função reporta os contadores
+};
+
+struct BenchRegistrar
+{
+    BenchRegistrar(const char *name, BenchFunction function, BenchMode mode);
+};
+
+void benchPercentiles(BenchState &state, std::vector<double> samples, const char *unit);
+
+/**
+ * @brief Impede que o compilador descarte um valor calculado no laço
+ */
+template <typename T>
+inline void benchKeep(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+#define NTP_BENCHMARK(name, mode)                                   \
+    static void name(BenchState &state);                            \
+    static BenchRegistrar name##Registrar(#name, name, BenchMode::mode); \
+    static void name(BenchState &state)
+
+#endif // NTP_BENCH_H
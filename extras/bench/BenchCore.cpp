@@ -0,0 +1,378 @@
+/**
+ * @file BenchCore.cpp
+ * @brief Benchmarks de leitura de estado, métricas, codec de pacotes, fusos e
+ *        formatação de timestamps
+ */
+
+#include "Bench.h"
+#include <LocalTimeCache.h>
+#include <NTPPacket.h>
+#include <NTPSync.h>
+#include <NTPTimeFormat.h>
+#include <TimeZone.h>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <ctime>
+#include <hal/PosixPlatform.h>
+
+// ----------------------------------------------------
+//
+//               Leitura de estado
+//
+// ----------------------------------------------------
+
+NTP_BENCHMARK(statusRead, Throughput)
+{
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        NTPStatus status = NTPSync::getStatus();
+        acc += status.lastSync;
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(isTimeSynced, Throughput)
+{
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += NTPSync::isTimeSynced();
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(correctedUtcRead, Throughput)
+{
+    PosixClock clock;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        NTPStatus status = NTPSync::getStatus();
+        acc += status.utcUs(clock.monotonicUs());
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(nowMicros, Throughput)
+{
+    int64_t acc = 0;
+    uint32_t errorUs;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += NTPSync::nowMicros(&errorUs);
+    }
+    benchKeep(acc + errorUs);
+}
+
+NTP_BENCHMARK(nowNtp64, Throughput)
+{
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += NTPSync::nowNtp64();
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(systemTimeRead, Throughput)
+{
+    PosixClock clock;
+    struct timeval tv;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        clock.now(tv);
+        acc += tv.tv_usec;
+    }
+    benchKeep(acc);
+}
+
+// ----------------------------------------------------
+//
+//               Métricas
+//
+// ----------------------------------------------------
+
+NTP_BENCHMARK(histogramRecord, Throughput)
+{
+    NTPHistogram histogram = {};
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        histogram.record((i * 2654435761u) & 0xFFFFF);
+        benchKeep(&histogram);
+    }
+    benchKeep(histogram.count);
+}
+
+NTP_BENCHMARK(metricsSnapshot, Throughput)
+{
+    static NTPMetrics metrics;
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        NTPSync::getMetrics(metrics);
+        acc += metrics.syncSuccess;
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(metricsPrometheus, Throughput)
+{
+    static NTPMetrics metrics;
+    static char text[16384];
+    NTPSync::getMetrics(metrics);
+    size_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += metrics.toPrometheus(text, sizeof(text));
+    }
+    benchKeep(acc);
+}
+
+// ----------------------------------------------------
+//
+//               Codec de pacotes
+//
+// ----------------------------------------------------
+
+NTP_BENCHMARK(packetEncode, Throughput)
+{
+    uint8_t buf[NTP_PACKET_SIZE];
+    NTPPacket packet = NTPPacket::request(0x83AA7E8012345678ULL);
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        packet.transmitTs += i;
+        packet.encode(buf);
+        benchKeep(buf);
+    }
+}
+
+NTP_BENCHMARK(packetDecode, Throughput)
+{
+    uint8_t buf[NTP_PACKET_SIZE];
+    NTPPacket reply = NTPPacket::request(0x83AA7E8012345678ULL);
+    reply.mode = NTP_MODE_SERVER;
+    reply.stratum = 2;
+    reply.encode(buf);
+
+    NTPPacket packet;
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        buf[47] = (uint8_t)i;
+        acc += packet.decode(buf, sizeof(buf)) ? packet.transmitTs : 0;
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(sampleFromExchange, Throughput)
+{
+    NTPPacket reply = NTPPacket::request(0);
+    reply.mode = NTP_MODE_SERVER;
+    reply.receiveTs = 0x83AA7E8012345678ULL;
+    reply.transmitTs = reply.receiveTs + 0x10000;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        uint64_t t1 = reply.receiveTs - 0x200000 + i;
+        NTPSample sample = NTPSample::fromExchange(reply, t1, t1 + 0x400000);
+        acc += sample.offsetUs + sample.delayUs;
+    }
+    benchKeep(acc);
+}
+
+// ----------------------------------------------------
+//
+//               Fusos horários
+//
+// ----------------------------------------------------
+
+static const char *const ZONES[] = {"America/Sao_Paulo", "UTC", "Europe/Paris",
+                                    "Asia/Tokyo", "America/Rio_Branco", "Invalid/Zone"};
+static const size_t ZONE_COUNT = sizeof(ZONES) / sizeof(ZONES[0]);
+
+/**
+ * Reproduz a busca feita por setTimeval() a partir do nome IANA.
+ */
+NTP_BENCHMARK(timezoneLookup, Throughput)
+{
+    int64_t acc = 0;
+    TimeZone zone;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += TimeZone::find(ZONES[i % ZONE_COUNT], zone);
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(utcToLocal, Throughput)
+{
+    TimeZone zone;
+    TimeZone::find("America/New_York", zone);
+    struct tm local;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        zone.toLocal(1700000000 + (int64_t)i * 997, local);
+        acc += local.tm_hour;
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Mesmos instantes de utcToLocal: um dia novo a cada ~87 conversões.
+ */
+NTP_BENCHMARK(utcToLocalCached, Throughput)
+{
+    TimeZone zone;
+    TimeZone::find("America/New_York", zone);
+    LocalTimeCache cache(zone);
+    struct tm local;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        cache.toLocal(1700000000 + (int64_t)i * 997, local);
+        acc += local.tm_hour;
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Amostras a cada segundo, como ao agrupar leituras por hora local.
+ */
+NTP_BENCHMARK(utcToLocalCachedSequential, Throughput)
+{
+    TimeZone zone;
+    TimeZone::find("America/New_York", zone);
+    LocalTimeCache cache(zone);
+    struct tm local;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        cache.toLocal(1700000000 + (int64_t)i, local);
+        acc += local.tm_hour;
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Referência: localtime_r() da libc com TZ do mesmo fuso.
+ */
+NTP_BENCHMARK(utcToLocalLibc, Throughput)
+{
+    setenv("TZ", "EST5EDT,M3.2.0,M11.1.0", 1);
+    tzset();
+    struct tm local;
+    int64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        time_t utc = (time_t)(1700000000 + (int64_t)i);
+        localtime_r(&utc, &local);
+        acc += local.tm_hour;
+    }
+    benchKeep(acc);
+    unsetenv("TZ");
+    tzset();
+}
+
+// ----------------------------------------------------
+//
+//               Formatação de timestamps
+//
+// ----------------------------------------------------
+
+#define FORMAT_BASE_US 1767225600000000LL // 2026-01-01T00:00:00Z
+#define FORMAT_STEP_US 1000               // Uma linha de log por ms
+#define FORMAT_BATCH 64
+
+/**
+ * Referência: gmtime_r() + strftime() + snprintf() dos milissegundos,
+ * como nos pontos de log da aplicação.
+ */
+NTP_BENCHMARK(formatStrftime, Throughput)
+{
+    char text[NTP_TIME_TEXT_LEN];
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        int64_t us = FORMAT_BASE_US + (int64_t)i * FORMAT_STEP_US;
+        time_t seconds = (time_t)(us / 1000000);
+        struct tm utc;
+        gmtime_r(&seconds, &utc);
+        size_t len = strftime(text, sizeof(text), "%Y-%m-%dT%H:%M:%S", &utc);
+        snprintf(text + len, sizeof(text) - len, ".%03dZ", (int)(us % 1000000 / 1000));
+        acc += (uint8_t)text[len + 3];
+    }
+    benchKeep(acc);
+}
+
+NTP_BENCHMARK(formatRfc3339, Throughput)
+{
+    NTPTimeFormatter formatter;
+    char text[NTP_TIME_TEXT_LEN];
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += formatter.format(FORMAT_BASE_US + (int64_t)i * FORMAT_STEP_US, text);
+        acc += (uint8_t)text[22];
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Fuso com regra de horário de verão: offsetAt() a cada segundo novo.
+ */
+NTP_BENCHMARK(formatRfc3339Zone, Throughput)
+{
+    TimeZone zone;
+    TimeZone::find("America/New_York", zone);
+    NTPTimeFormatter formatter(zone);
+    char text[NTP_TIME_TEXT_LEN];
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += formatter.format(FORMAT_BASE_US + (int64_t)i * FORMAT_STEP_US, text);
+        acc += (uint8_t)text[22];
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Pior caso: cada instante cai num segundo e num dia novos.
+ */
+NTP_BENCHMARK(formatRfc3339Cold, Throughput)
+{
+    NTPTimeFormatter formatter;
+    char text[NTP_TIME_TEXT_LEN];
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        acc += formatter.format(FORMAT_BASE_US + (int64_t)i * 86401000123LL, text);
+        acc += (uint8_t)text[22];
+    }
+    benchKeep(acc);
+}
+
+/**
+ * Por timestamp, em lotes de FORMAT_BATCH registros de largura fixa.
+ */
+NTP_BENCHMARK(formatBatch, Throughput)
+{
+    NTPTimeFormatter formatter;
+    int64_t stamps[FORMAT_BATCH];
+    char texts[FORMAT_BATCH][NTP_TIME_TEXT_LEN];
+    uint64_t acc = 0;
+    for (uint64_t i = 0; i < state.iterations(); i += FORMAT_BATCH)
+    {
+        size_t count = (size_t)std::min<uint64_t>(FORMAT_BATCH, state.iterations() - i);
+        for (size_t j = 0; j < count; j++)
+        {
+            stamps[j] = FORMAT_BASE_US + (int64_t)(i + j) * FORMAT_STEP_US;
+        }
+        acc += formatter.formatBatch(stamps, count, texts[0], NTP_TIME_TEXT_LEN);
+        acc += (uint8_t)texts[0][22];
+    }
+    benchKeep(acc);
+}
@@ -0,0 +1,185 @@
+/**
+ * @file BenchMain.cpp
+ * @brief Harness dos microbenchmarks da biblioteca
+ *
+ * Uso:
+ *   ntpsync_bench [--filter=nome] [--output=arquivo.json] [--min-time-ms=N]
+ *                 [--repetitions=N] [--loss=pct] [--delay-us=N]
+ *                 [--jitter-us=N] [--syncs=N]
+ *
+ * A saída é um objeto JSON com um registro por benchmark, para que
+ * regressões possam ser comparadas entre versões.
+ */
+
+#include "Bench.h"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+struct BenchEntry
+{
+    const char *name;
+    BenchFunction function;
+    BenchMode mode;
+};
+
+static std::vector<BenchEntry> &registry()
+{
+    static std::vector<BenchEntry> entries;
+    return entries;
+}
+
+static BenchConfig config;
+
+const BenchConfig &benchConfig()
+{
+    return config;
+}
+
+BenchRegistrar::BenchRegistrar(const char *name, BenchFunction function, BenchMode mode)
+{
+    registry().push_back({name, function, mode});
+}
+
+/**
+ * @brief Reporta mediana, p90, p99, mínimo e máximo de amostras
+ */
+void benchPercentiles(BenchState &state, std::vector<double> samples, const char *unit)
+{
+    if (samples.empty())
+        return;
+
+    std::sort(samples.begin(), samples.end());
+    auto at = [&](double q)
+    { return samples[std::min(samples.size() - 1, (size_t)(q * samples.size()))]; };
+
+    std::string prefix = unit;
+    state.counter(("p50_" + prefix).c_str(), at(0.50));
+    state.counter(("p90_" + prefix).c_str(), at(0.90));
+    state.counter(("p99_" + prefix).c_str(), at(0.99));
+    state.counter(("min_" + prefix).c_str(), samples.front());
+    state.counter(("max_" + prefix).c_str(), samples.back());
+}
+
+static double elapsedNs(std::chrono::steady_clock::time_point start)
+{
+    return (double)std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now() - start)
+        .count();
+}
+
+static void runThroughput(const BenchEntry &entry, FILE *out, bool first)
+{
+    // Calibra o número de iterações para durar pelo menos minTimeMs
+    uint64_t iterations = 1;
+    double minNs = config.minTimeMs * 1e6;
+    for (;;)
+    {
+        BenchState state(iterations);
+        auto start = std::chrono::steady_clock::now();
+        entry.function(state);
+        double ns = elapsedNs(start);
+        if (ns >= minNs || iterations >= (1ULL << 40))
+            break;
+        double scale = ns > 0 ? minNs / ns * 1.2 : 10;
+        iterations = (uint64_t)(iterations * std::min(std::max(scale, 2.0), 100.0));
+    }
+
+    std::vector<double> perOp;
+    for (uint8_t r = 0; r < config.repetitions; r++)
+    {
+        BenchState state(iterations);
+        auto start = std::chrono::steady_clock::now();
+        entry.function(state);
+        perOp.push_back(elapsedNs(start) / iterations);
+    }
+    std::sort(perOp.begin(), perOp.end());
+
+    fprintf(out, "%s    {\"name\": \"%s\", \"mode\": \"throughput\", \"iterations\": %llu, "
+                 "\"ns_per_op\": %.3f, \"min_ns_per_op\": %.3f, \"ops_per_sec\": %.0f}",
+            first ? "" : ",\n", entry.name, (unsigned long long)iterations,
+            perOp[perOp.size() / 2], perOp.front(), 1e9 / perOp[perOp.size() / 2]);
+}
+
+static void runLatency(const BenchEntry &entry, FILE *out, bool first)
+{
+    BenchState state(config.syncs);
+    entry.function(state);
+
+    fprintf(out, "%s    {\"name\": \"%s\", \"mode\": \"latency\"", first ? "" : ",\n", entry.name);
+    for (const auto &c : state.counters())
+    {
+        fprintf(out, ", \"%s\": %.3f", c.first.c_str(), c.second);
+    }
+    fprintf(out, "}");
+}
+
+static bool parseArg(const char *arg, const char *name, const char **value)
+{
+    size_t len = strlen(name);
+    if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+        return false;
+    *value = arg + len + 1;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *v;
+        if (parseArg(argv[i], "--filter", &v))
+            config.filter = v;
+        else if (parseArg(argv[i], "--output", &v))
+            config.output = v;
+        else if (parseArg(argv[i], "--min-time-ms", &v))
+            config.minTimeMs = (uint32_t)atoi(v);
+        else if (parseArg(argv[i], "--repetitions", &v))
+            config.repetitions = (uint8_t)std::max(1, atoi(v));
+        else if (parseArg(argv[i], "--loss", &v))
+            config.lossPercent = (uint8_t)atoi(v);
+        else if (parseArg(argv[i], "--delay-us", &v))
+            config.delayUs = (uint32_t)atoi(v);
+        else if (parseArg(argv[i], "--jitter-us", &v))
+            config.jitterUs = (uint32_t)atoi(v);
+        else if (parseArg(argv[i], "--syncs", &v))
+            config.syncs = (uint32_t)std::max(1, atoi(v));
+        else
+        {
+            fprintf(stderr, "Argumento desconhecido: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    FILE *out = stdout;
+    if (!config.output.empty())
+    {
+        out = fopen(config.output.c_str(), "w");
+        if (out == nullptr)
+        {
+            perror(config.output.c_str());
+            return 1;
+        }
+    }
+
+    fprintf(out, "{\n  \"benchmarks\": [\n");
+    bool first = true;
+    for (const auto &entry : registry())
+    {
+        if (!config.filter.empty() && strstr(entry.name, config.filter.c_str()) == nullptr)
+            continue;
+        if (entry.mode == BenchMode::Throughput)
+            runThroughput(entry, out, first);
+        else
+            runLatency(entry, out, first);
+        first = false;
+        fflush(out);
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file BenchServe.cpp
+ * @brief Carga do modo servidor: respostas por segundo em loopback
+ *
+ * NTPSync sincroniza com um LoopbackServer e passa a servir na porta
+ * local; clientes em threads próprias mantêm uma janela de pedidos em
+ * aberto durante minTimeMs × repetitions e contam as respostas válidas.
+ */
+
+#include "Bench.h"
+#include <LoopbackServer.h>
+#include <NTPSync.h>
+#include <arpa/inet.h>
+#include <chrono>
+#include <hal/PosixPlatform.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <thread>
+#include <unistd.h>
+
+#define CLIENT_COUNT 4
+#define CLIENT_WINDOW 32 // Pedidos em aberto por cliente
+
+struct ClientStats
+{
+    uint64_t sent = 0;
+    uint64_t replies = 0;
+    uint64_t invalid = 0;
+};
+
+static void runClient(uint16_t port, uint8_t stratum, std::chrono::steady_clock::time_point end,
+                      ClientStats &stats)
+{
+    int fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (fd < 0)
+        return;
+    struct sockaddr_in to = {};
+    to.sin_family = AF_INET;
+    to.sin_port = htons(port);
+    to.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+
+    uint8_t buf[NTP_DATAGRAM_LEN];
+    uint64_t outstanding = 0;
+    while (std::chrono::steady_clock::now() < end)
+    {
+        while (outstanding < CLIENT_WINDOW)
+        {
+            NTPPacket::request(++stats.sent).encode(buf);
+            sendto(fd, buf, NTP_PACKET_SIZE, 0, (struct sockaddr *)&to, sizeof(to));
+            outstanding++;
+        }
+
+        struct pollfd pfd = {fd, POLLIN, 0};
+        if (poll(&pfd, 1, 10) <= 0)
+        {
+            outstanding = 0; // Perdidos: a janela recomeça
+            continue;
+        }
+        ssize_t len;
+        while ((len = recv(fd, buf, sizeof(buf), MSG_DONTWAIT)) > 0)
+        {
+            NTPPacket reply;
+            outstanding -= outstanding > 0;
+            if (reply.decode(buf, (size_t)len) && reply.mode == NTP_MODE_SERVER &&
+                reply.stratum == stratum && reply.originTs != 0 && reply.transmitTs != 0)
+                stats.replies++;
+            else
+                stats.invalid++;
+        }
+    }
+    close(fd);
+}
+
+NTP_BENCHMARK(serveLoopback, Latency)
+{
+    const BenchConfig &config = benchConfig();
+
+    LoopbackServer upstream;
+    upstream.setStratum(2);
+    if (!upstream.start())
+    {
+        state.counter("error", 1);
+        return;
+    }
+
+    PosixNetwork network;
+    PosixClock clock;
+    PosixStorage storage;
+    PosixTasking tasking;
+    NTPSync::setPlatform({&network, &clock, &storage, &tasking});
+    NTPSync::setTimeval("UTC", {("127.0.0.1:" + std::to_string(upstream.port())).c_str()});
+    NTPSync::setSyncMode(NTPSync::SyncMode::Parallel);
+    if (!NTPSync::syncTime(3) || !NTPSync::startServer(0))
+    {
+        upstream.stop();
+        state.counter("error", 1);
+        return;
+    }
+
+    NTPMetrics before;
+    NTPSync::getMetrics(before);
+
+    uint32_t durationMs = config.minTimeMs * config.repetitions;
+    auto start = std::chrono::steady_clock::now();
+    auto end = start + std::chrono::milliseconds(durationMs);
+    ClientStats stats[CLIENT_COUNT];
+    std::thread clients[CLIENT_COUNT];
+    for (int i = 0; i < CLIENT_COUNT; i++)
+    {
+        clients[i] = std::thread(runClient, NTPSync::getServerPort(), 3, end, std::ref(stats[i]));
+    }
+    for (auto &client : clients)
+    {
+        client.join();
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    NTPMetrics after;
+    NTPSync::getMetrics(after);
+    NTPSync::stopServer();
+    upstream.stop();
+
+    ClientStats total;
+    for (const auto &s : stats)
+    {
+        total.sent += s.sent;
+        total.replies += s.replies;
+        total.invalid += s.invalid;
+    }
+
+    state.counter("clients", CLIENT_COUNT);
+    state.counter("window", CLIENT_WINDOW);
+    state.counter("duration_ms", seconds * 1000);
+    state.counter("requests", (double)total.sent);
+    state.counter("replies", (double)total.replies);
+    state.counter("invalid", (double)total.invalid);
+    state.counter("replies_per_sec", total.replies / seconds);
+    state.counter("server_requests", after.serveRequests - before.serveRequests);
+    state.counter("server_dropped", after.serveDropped - before.serveDropped);
+}
@@ -0,0 +1,81 @@
+/**
+ * @file BenchSync.cpp
+ * @brief Latência de syncTime() de ponta a ponta contra servidores em loopback
+ *
+ * A perda, o atraso e o jitter dos servidores vêm de --loss, --delay-us e
+ * --jitter-us, permitindo medir o comportamento em redes degradadas.
+ */
+
+#include "Bench.h"
+#include <LoopbackServer.h>
+#include <NTPSync.h>
+#include <chrono>
+#include <hal/PosixPlatform.h>
+
+#define SERVER_COUNT 3
+
+static void runSyncs(BenchState &state, NTPSync::SyncMode mode)
+{
+    const BenchConfig &config = benchConfig();
+
+    LoopbackServer servers[SERVER_COUNT];
+    std::vector<std::string> hosts;
+    for (auto &server : servers)
+    {
+        server.setLossPercent(config.lossPercent);
+        server.setDelayUs(config.delayUs);
+        server.setJitterUs(config.jitterUs);
+        if (!server.start())
+        {
+            state.counter("error", 1);
+            return;
+        }
+        hosts.push_back("127.0.0.1:" + std::to_string(server.port()));
+    }
+
+    PosixNetwork network;
+    PosixClock clock;
+    PosixStorage storage;
+    PosixTasking tasking;
+    NTPSync::setPlatform({&network, &clock, &storage, &tasking});
+    NTPSync::setTimeval("UTC", hosts);
+    NTPSync::setSyncMode(mode);
+    NTPSync::setRateLimit(0); // Sincronizações seguidas, de propósito
+
+    std::vector<double> latencies;
+    uint32_t successes = 0;
+    for (uint64_t i = 0; i < state.iterations(); i++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        bool ok = NTPSync::syncTime(1);
+        auto elapsed = std::chrono::steady_clock::now() - start;
+        latencies.push_back(std::chrono::duration<double, std::micro>(elapsed).count());
+        successes += ok;
+    }
+
+    uint32_t requests = 0, replies = 0;
+    for (auto &server : servers)
+    {
+        requests += server.requests();
+        replies += server.replies();
+        server.stop();
+    }
+
+    state.counter("syncs", (double)state.iterations());
+    state.counter("success_ratio", (double)successes / state.iterations());
+    state.counter("loss_percent", config.lossPercent);
+    state.counter("delay_us", config.delayUs);
+    state.counter("requests", requests);
+    state.counter("replies", replies);
+    benchPercentiles(state, latencies, "us");
+}
+
+NTP_BENCHMARK(syncParallel, Latency)
+{
+    runSyncs(state, NTPSync::SyncMode::Parallel);
+}
+
+NTP_BENCHMARK(syncSequential, Latency)
+{
+    runSyncs(state, NTPSync::SyncMode::Sequential);
+}
@@ -0,0 +1,146 @@
+/**
+ * @file BenchTimestamp.cpp
+ * @brief Jitter do offset medido com e sem os timestamps do backend
+ *
+ * Um cliente troca pedidos com um LoopbackServer sem offset enquanto
+ * threads ocupadas disputam a CPU. Com timestamps, t1 e t4 vêm de
+ * sendStamped()/receiveStamped() (SO_TIMESTAMPNS no Linux); sem, são
+ * lidos pela thread depois de send()/receive(), como faria um cliente
+ * que só marca o tempo ao acordar. O desvio de cada offset em relação à
+ * mediana é o jitter que sobra para o filtro de relógio.
+ */
+
+#include "Bench.h"
+#include <LoopbackServer.h>
+#include <NTPPacket.h>
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <hal/PosixPlatform.h>
+#include <thread>
+
+#define EXCHANGES_PER_SYNC 20 // Trocas por --syncs
+
+static uint64_t ntpAt(PosixClock &clock, int64_t monotonicUs)
+{
+    struct timeval tv;
+    clock.now(tv);
+    int64_t ageUs = clock.monotonicUs() - monotonicUs;
+    return ntpFromTimeval(tv) - (((uint64_t)std::max<int64_t>(ageUs, 0) << 32) / 1000000ULL);
+}
+
+static void runExchanges(BenchState &state, bool stamped)
+{
+    const BenchConfig &config = benchConfig();
+
+    LoopbackServer server;
+    if (!server.start())
+    {
+        state.counter("error", 1);
+        return;
+    }
+
+    // Mais threads ocupadas que núcleos: a thread do cliente espera a vez
+    // de rodar depois que o datagrama chega
+    std::atomic<bool> loaded{true};
+    unsigned loadThreads = 2 * std::max(1u, std::thread::hardware_concurrency());
+    std::vector<std::thread> load;
+    for (unsigned i = 0; i < loadThreads; i++)
+    {
+        load.emplace_back([&loaded]
+                          {
+                              volatile uint64_t spin = 0;
+                              while (loaded.load(std::memory_order_relaxed))
+                                  spin++;
+                          });
+    }
+
+    PosixNetwork network;
+    PosixClock clock;
+    network.open();
+    NTPAddress to = {};
+    ntpParseAddress("127.0.0.1", to);
+    to.port = server.port();
+
+    std::vector<double> offsets;
+    uint32_t lost = 0;
+    uint32_t exchanges = config.syncs * EXCHANGES_PER_SYNC;
+    for (uint32_t i = 0; i < exchanges; i++)
+    {
+        uint8_t buf[NTP_PACKET_SIZE];
+        struct timeval tv;
+        clock.now(tv);
+        uint64_t origin = ntpFromTimeval(tv);
+        NTPPacket::request(origin).encode(buf);
+
+        uint64_t t1, t4;
+        int len;
+        NTPAddress from;
+        if (stamped)
+        {
+            int64_t txUs, rxUs;
+            network.sendStamped(to, buf, sizeof(buf), txUs);
+            t1 = ntpAt(clock, txUs);
+            len = network.receiveStamped(buf, sizeof(buf), from, 100, rxUs);
+            t4 = ntpAt(clock, rxUs);
+        }
+        else
+        {
+            t1 = origin;
+            network.send(to, buf, sizeof(buf));
+            len = network.receive(buf, sizeof(buf), from, 100);
+            clock.now(tv);
+            t4 = ntpFromTimeval(tv);
+        }
+
+        NTPPacket reply;
+        if (len <= 0 || !reply.decode(buf, (size_t)len) || reply.originTs != origin)
+        {
+            lost++;
+            continue;
+        }
+        offsets.push_back((double)NTPSample::fromExchange(reply, t1, t4).offsetUs);
+    }
+
+    loaded = false;
+    for (auto &thread : load)
+    {
+        thread.join();
+    }
+    network.close();
+    server.stop();
+
+    if (offsets.empty())
+    {
+        state.counter("error", 1);
+        return;
+    }
+
+    std::vector<double> sorted = offsets;
+    std::sort(sorted.begin(), sorted.end());
+    double median = sorted[sorted.size() / 2];
+    double sumSq = 0;
+    std::vector<double> deviations;
+    for (double offset : offsets)
+    {
+        deviations.push_back(std::fabs(offset - median));
+        sumSq += (offset - median) * (offset - median);
+    }
+
+    state.counter("exchanges", exchanges);
+    state.counter("lost", lost);
+    state.counter("load_threads", loadThreads);
+    state.counter("median_offset_us", median);
+    state.counter("stddev_us", std::sqrt(sumSq / offsets.size()));
+    benchPercentiles(state, deviations, "dev_us");
+}
+
+NTP_BENCHMARK(rxTimestampKernel, Latency)
+{
+    runExchanges(state, true);
+}
+
+NTP_BENCHMARK(rxTimestampUser, Latency)
+{
+    runExchanges(state, false);
+}
@@ -0,0 +1,139 @@
+#include "LoopbackServer.h"
+#include "NTPPacket.h"
+#include <arpa/inet.h>
+#include <chrono>
+#include <netinet/in.h>
+#include <poll.h>
+#include <random>
+#include <sys/socket.h>
+#include <time.h>
+#include <unistd.h>
+
+static uint64_t realtimeNtp(int64_t offsetUs)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_REALTIME, &ts);
+    int64_t us = (int64_t)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000 + offsetUs;
+    struct timeval tv;
+    tv.tv_sec = (time_t)(us / 1000000LL);
+    tv.tv_usec = (suseconds_t)(us % 1000000LL);
+    return ntpFromTimeval(tv);
+}
+
+LoopbackServer::LoopbackServer()
+    : _fd(-1), _port(0), _running(false), _offsetUs(0), _stratum(1), _lossPercent(0),
+      _delayUs(0), _jitterUs(0), _pathDelayUs(0), _kissCode(0), _requests(0), _replies(0)
+{
+}
+
+LoopbackServer::~LoopbackServer()
+{
+    stop();
+}
+
+/**
+ * @brief Abre o socket em 127.0.0.1 e inicia a thread de respostas
+ *
+ * @param port Porta UDP; 0 escolhe uma porta livre, lida depois em port().
+ */
+bool LoopbackServer::start(uint16_t port)
+{
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0)
+        return false;
+
+    struct sockaddr_in addr = {};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    socklen_t len = sizeof(addr);
+    if (bind(_fd, (struct sockaddr *)&addr, sizeof(addr)) != 0 ||
+        getsockname(_fd, (struct sockaddr *)&addr, &len) != 0)
+    {
+        close(_fd);
+        _fd = -1;
+        return false;
+    }
+
+    _port = ntohs(addr.sin_port);
+    _running = true;
+    _thread = std::thread(&LoopbackServer::run, this);
+    return true;
+}
+
+void LoopbackServer::stop()
+{
+    _running = false;
+    if (_thread.joinable())
+        _thread.join();
+    if (_fd >= 0)
+    {
+        close(_fd);
+        _fd = -1;
+    }
+}
+
+void LoopbackServer::run()
+{
+    std::mt19937 rng(_port);
+    uint8_t buf[NTP_PACKET_SIZE];
+
+    while (_running)
+    {
+        struct pollfd pfd = {_fd, POLLIN, 0};
+        if (poll(&pfd, 1, 20) <= 0)
+            continue;
+
+        struct sockaddr_in client = {};
+        socklen_t clientLen = sizeof(client);
+        ssize_t n = recvfrom(_fd, buf, sizeof(buf), 0, (struct sockaddr *)&client, &clientLen);
+
+        // Metade do atraso de caminho na ida, metade na volta: simétrico,
+        // não desloca o offset medido
+        uint32_t halfPathUs = _pathDelayUs / 2;
+        if (halfPathUs > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(halfPathUs));
+        uint64_t receiveTs = realtimeNtp(_offsetUs);
+
+        NTPPacket request;
+        if (n <= 0 || !request.decode(buf, (size_t)n) || request.mode != NTP_MODE_CLIENT)
+            continue;
+        _requests++;
+
+        if (_lossPercent > 0 && rng() % 100 < _lossPercent)
+            continue;
+
+        uint32_t delayUs = _delayUs;
+        if (_jitterUs > 0)
+            delayUs += rng() % _jitterUs;
+        if (delayUs > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(delayUs));
+
+        NTPPacket reply = {};
+        reply.leap = 0;
+        reply.version = NTP_VERSION;
+        reply.mode = NTP_MODE_SERVER;
+        reply.stratum = _stratum;
+        reply.poll = request.poll;
+        reply.precision = -20;
+        reply.rootDelay = 0x00000010;
+        reply.rootDispersion = 0x00000010;
+        reply.referenceId = 0x4C4F434C; // "LOCL"
+        reply.referenceTs = receiveTs;
+        reply.originTs = request.transmitTs;
+        reply.receiveTs = receiveTs;
+        reply.transmitTs = realtimeNtp(_offsetUs);
+        if (_kissCode != 0)
+        {
+            reply.leap = NTP_LEAP_UNSYNC;
+            reply.stratum = 0;
+            reply.referenceId = _kissCode;
+        }
+        reply.encode(buf);
+        if (halfPathUs > 0)
+            std::this_thread::sleep_for(std::chrono::microseconds(halfPathUs));
+
+        if (sendto(_fd, buf, sizeof(buf), 0, (struct sockaddr *)&client, clientLen) == (ssize_t)sizeof(buf))
+            _replies++;
+    }
+}
@@ -0,0 +1,60 @@
+#ifndef NTP_LOOPBACK_SERVER_H
+#define NTP_LOOPBACK_SERVER_H
+
+#include <atomic>
+#include <cstdint>
+#include <thread>
+
+/**
+ * @brief Servidor NTP mínimo em 127.0.0.1 para testes e benchmarks no host
+ *
+ * Responde pedidos de cliente com o horário de CLOCK_REALTIME somado a um
+ * offset configurável. Perda de pacotes e atraso de resposta podem ser
+ * simulados para exercitar timeouts e o filtro de relógio.
+ *
+ * O atraso de resposta (setDelayUs) fica entre os timestamps de recepção
+ * e de transmissão e é descontado pelo cliente; o atraso de caminho
+ * (setPathDelayUs) fica fora deles e aparece no atraso medido. Com
+ * setKissCode, os pedidos recebem Kiss-o'-Death em vez do horário.
+ */
+class LoopbackServer
+{
+public:
+    LoopbackServer();
+    ~LoopbackServer();
+
+    bool start(uint16_t port = 0);
+    void stop();
+    uint16_t port() const { return _port; }
+
+    void setOffsetUs(int64_t offsetUs) { _offsetUs = offsetUs; }
+    void setStratum(uint8_t stratum) { _stratum = stratum; }
+    void setLossPercent(uint8_t percent) { _lossPercent = percent; }
+    void setDelayUs(uint32_t delayUs) { _delayUs = delayUs; }
+    void setJitterUs(uint32_t jitterUs) { _jitterUs = jitterUs; }
+    void setPathDelayUs(uint32_t delayUs) { _pathDelayUs = delayUs; }
+    void setKissCode(uint32_t code) { _kissCode = code; } // NTP_KISS_*, ou 0
+
+    uint32_t requests() const { return _requests; }
+    uint32_t replies() const { return _replies; }
+
+private:
+    int _fd;
+    uint16_t _port;
+    std::thread _thread;
+    std::atomic<bool> _running;
+
+    std::atomic<int64_t> _offsetUs;
+    std::atomic<uint8_t> _stratum;
+    std::atomic<uint8_t> _lossPercent;
+    std::atomic<uint32_t> _delayUs;
+    std::atomic<uint32_t> _jitterUs;
+    std::atomic<uint32_t> _pathDelayUs;
+    std::atomic<uint32_t> _kissCode;
+    std::atomic<uint32_t> _requests;
+    std::atomic<uint32_t> _replies;
+
+    void run();
+};
+
+#endif // NTP_LOOPBACK_SERVER_H
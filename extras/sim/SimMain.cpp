@@ -0,0 +1,210 @@
+/**
+ * @file SimMain.cpp
+ * @brief Simulação determinística das políticas de sincronização
+ *
+ * Uso:
+ *   ntpsync_sim [--filter=nome] [--output=arquivo.json] [--hours=N]
+ *               [--seed=N] [--drift-ppm=N] [--error-ms=N]
+ *
+ * Cada cenário (conjunto de servidores virtuais) é simulado com cada
+ * política (modo, quorum e intervalos) por --hours de tempo virtual. O
+ * NTPSyncClock roda sem modificações sobre SimWorld (simRun()), que
+ * avança o tempo virtual pelo intervalo devolvido por loop(), então um
+ * dia de simulação leva frações de segundo.
+ *
+ * A saída é um objeto JSON com um registro por par cenário/política.
+ * Com a mesma semente, os resultados são idênticos entre execuções.
+ */
+
+#include "SimRun.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+struct SimConfig
+{
+    std::string filter; // Roda apenas execuções cujo "cenário/política" contém o filtro
+    std::string output; // Arquivo JSON; vazio escreve em stdout
+    uint32_t hours = 24;
+    uint32_t seed = 1;
+    double driftPpm = 40;       // Deriva do oscilador local
+    int64_t errorMs = 2500;     // Erro inicial do relógio do sistema
+};
+
+struct SimScenario
+{
+    const char *name;
+    void (*setup)(SimWorld &world);
+};
+
+static SimConfig config;
+
+// ---- Cenários ----
+
+static void addServers(SimWorld &world, SimServerConfig server, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        world.addServer(server);
+    }
+}
+
+static void ideal(SimWorld &world)
+{
+    addServers(world, SimServerConfig(), 4);
+}
+
+static void lossy(SimWorld &world)
+{
+    SimServerConfig server;
+    server.lossPercent = 30;
+    server.jitterUs = 5000;
+    addServers(world, server, 4);
+}
+
+static void asymmetric(SimWorld &world)
+{
+    // 80% do atraso na ida: o offset medido erra em (80% - 50%) × 80 ms
+    SimServerConfig server;
+    server.delayUs = 80000;
+    server.forwardPercent = 80;
+    server.jitterUs = 2000;
+    addServers(world, server, 3);
+}
+
+static void falseticker(SimWorld &world)
+{
+    SimServerConfig server;
+    addServers(world, server, 3);
+    server.offsetUs = 3000000;
+    world.addServer(server);
+}
+
+static void kod(SimWorld &world)
+{
+    SimServerConfig server;
+    addServers(world, server, 2);
+    server.kissCode = NTP_KISS_DENY;
+    world.addServer(server);
+    server.kissCode = 0;
+    server.rateMinIntervalMs = 120000;
+    world.addServer(server);
+}
+
+static void wan(SimWorld &world)
+{
+    SimServerConfig server;
+    server.delayUs = 150000;
+    server.jitterUs = 20000;
+    server.lossPercent = 5;
+    server.forwardPercent = 60;
+    addServers(world, server, 4);
+}
+
+static const SimScenario scenarios[] = {
+    {"ideal", ideal},
+    {"lossy", lossy},
+    {"asymmetric", asymmetric},
+    {"falseticker", falseticker},
+    {"kod", kod},
+    {"wan", wan},
+};
+
+static const SimPolicy policies[] = {
+    {"sequential", NTPSyncClock::SyncMode::Sequential, 0, 60, 5, false},
+    {"parallel", NTPSyncClock::SyncMode::Parallel, 0, 60, 5, false},
+    {"quorum2", NTPSyncClock::SyncMode::Parallel, 2, 60, 5, false},
+    {"adaptive", NTPSyncClock::SyncMode::Parallel, 0, 60, 5, true},
+    {"fast", NTPSyncClock::SyncMode::Parallel, 0, 5, 1, false},
+};
+
+// ---- Execução ----
+
+static void run(const SimScenario &scenario, const SimPolicy &policy, FILE *out, bool first)
+{
+    SimWorld world(config.seed, config.driftPpm, config.errorMs * 1000);
+    scenario.setup(world);
+    SimResult result = simRun(world, policy, config.hours);
+
+    fprintf(out, "%s    {\"scenario\": \"%s\", \"policy\": \"%s\", \"synced\": %s, "
+                 "\"time_to_first_sync_s\": %.3f, \"p50_error_us\": %.0f, "
+                 "\"p99_error_us\": %.0f, \"max_error_us\": %.0f, \"packets_sent\": %u, "
+                 "\"packets_per_hour\": %.1f, \"kisses\": %u, \"final_error_us\": %lld, "
+                 "\"speedup\": %.0f}",
+            first ? "" : ",\n", scenario.name, policy.name, result.synced ? "true" : "false",
+            result.firstSyncS, result.percentile(0.50), result.percentile(0.99),
+            result.maxErrorUs(), result.sent, result.sent / (result.virtualS / 3600),
+            result.kisses, (long long)result.finalErrorUs,
+            result.realS > 0 ? result.virtualS / result.realS : 0.0);
+}
+
+static bool parseArg(const char *arg, const char *name, const char **value)
+{
+    size_t len = strlen(name);
+    if (strncmp(arg, name, len) != 0 || arg[len] != '=')
+        return false;
+    *value = arg + len + 1;
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    for (int i = 1; i < argc; i++)
+    {
+        const char *v;
+        if (parseArg(argv[i], "--filter", &v))
+            config.filter = v;
+        else if (parseArg(argv[i], "--output", &v))
+            config.output = v;
+        else if (parseArg(argv[i], "--hours", &v))
+            config.hours = (uint32_t)std::max(1, atoi(v));
+        else if (parseArg(argv[i], "--seed", &v))
+            config.seed = (uint32_t)strtoul(v, nullptr, 10);
+        else if (parseArg(argv[i], "--drift-ppm", &v))
+            config.driftPpm = atof(v);
+        else if (parseArg(argv[i], "--error-ms", &v))
+            config.errorMs = atoll(v);
+        else
+        {
+            fprintf(stderr, "Argumento desconhecido: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    FILE *out = stdout;
+    if (!config.output.empty())
+    {
+        out = fopen(config.output.c_str(), "w");
+        if (out == nullptr)
+        {
+            perror(config.output.c_str());
+            return 1;
+        }
+    }
+
+    NTPSync::logControl(false);
+
+    fprintf(out, "{\n  \"hours\": %u, \"seed\": %u, \"drift_ppm\": %.1f, \"initial_error_ms\": %lld,\n"
+                 "  \"runs\": [\n",
+            config.hours, config.seed, config.driftPpm, (long long)config.errorMs);
+    bool first = true;
+    for (const auto &scenario : scenarios)
+    {
+        for (const auto &policy : policies)
+        {
+            std::string name = std::string(scenario.name) + "/" + policy.name;
+            if (!config.filter.empty() && name.find(config.filter) == std::string::npos)
+                continue;
+            run(scenario, policy, out, first);
+            first = false;
+            fflush(out);
+        }
+    }
+    fprintf(out, "\n  ]\n}\n");
+
+    if (out != stdout)
+        fclose(out);
+    return 0;
+}
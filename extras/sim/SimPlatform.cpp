@@ -0,0 +1,355 @@
+#include "SimPlatform.h"
+#include <algorithm>
+#include <cstdio>
+
+constexpr int64_t SIM_BOOT_MONOTONIC_US = 1000000; // monotonicUs() no instante inicial, nunca 0
+constexpr uint32_t SIM_SERVER_PROCESSING_US = 30;  // Entre t2 e t3
+constexpr uint32_t SIM_DNS_TTL_S = 3600;
+
+// ----------------------------------------------------
+//
+//               SimClock
+//
+// ----------------------------------------------------
+
+SimClock::SimClock(SimWorld &world, double driftPpm, int64_t initialErrorUs)
+    : _world(world),
+      _driftPpm(driftPpm),
+      _initialErrorUs(initialErrorUs),
+      _offsetUs(0),
+      _pendingUs(0),
+      _settledAtUs(SIM_BOOT_MONOTONIC_US)
+{
+}
+
+/**
+ * @brief Leitura do oscilador local no tempo verdadeiro trueUs
+ */
+int64_t SimClock::monotonicAt(int64_t trueUs) const
+{
+    int64_t elapsed = trueUs - NTP_SIM_EPOCH_US;
+    return SIM_BOOT_MONOTONIC_US + elapsed + (int64_t)(elapsed * _driftPpm / 1000000.0);
+}
+
+int64_t SimClock::monotonicUs()
+{
+    return monotonicAt(_world.nowUs());
+}
+
+void SimClock::now(struct timeval &tv)
+{
+    int64_t us = wallUs();
+    tv.tv_sec = (time_t)(us / 1000000LL);
+    tv.tv_usec = (suseconds_t)(us % 1000000LL);
+}
+
+void SimClock::step(int64_t offsetUs)
+{
+    settle();
+    _offsetUs += offsetUs;
+}
+
+void SimClock::slew(int64_t offsetUs)
+{
+    settle();
+    _pendingUs += offsetUs;
+}
+
+int64_t SimClock::pendingSlewUs()
+{
+    settle();
+    return _pendingUs;
+}
+
+/**
+ * @brief Avança o tempo da simulação em vez de dormir
+ */
+void SimClock::sleepMs(uint32_t ms)
+{
+    _world.advanceTo(_world.nowUs() + (int64_t)ms * 1000);
+}
+
+bool SimClock::rtcUs(int64_t &us)
+{
+    (void)us;
+    return false;
+}
+
+uint32_t SimClock::random()
+{
+    return (uint32_t)_world._rng();
+}
+
+/**
+ * @brief Horário do sistema: o oscilador mais o erro inicial e as
+ *        correções já aplicadas
+ */
+int64_t SimClock::wallUs()
+{
+    settle();
+    return NTP_SIM_EPOCH_US + _initialErrorUs + (monotonicUs() - SIM_BOOT_MONOTONIC_US) + _offsetUs;
+}
+
+/**
+ * @brief Aplica o slew como PosixClock::settle(), guardando para a próxima
+ *        chamada o tempo que ainda não vale 1 us de correção
+ */
+void SimClock::settle()
+{
+    int64_t monotonic = monotonicUs();
+    int64_t elapsed = monotonic - _settledAtUs;
+    if (_pendingUs == 0)
+        _settledAtUs = monotonic;
+    if (_pendingUs == 0 || elapsed <= 0)
+        return;
+
+    int64_t budget = elapsed * NTP_SIM_SLEW_RATE_PPM / 1000000;
+    if (budget == 0)
+        return;
+    _settledAtUs += budget * 1000000 / NTP_SIM_SLEW_RATE_PPM;
+    int64_t applied = _pendingUs > 0 ? std::min(_pendingUs, budget) : std::max(_pendingUs, -budget);
+    _offsetUs += applied;
+    _pendingUs -= applied;
+}
+
+// ----------------------------------------------------
+//
+//               SimNetwork
+//
+// ----------------------------------------------------
+
+int SimNetwork::resolveStart(const char *hostname)
+{
+    for (int i = 0; i < NTP_MAX_DNS_QUERIES; i++)
+    {
+        if (_queries[i].used)
+            continue;
+
+        int server = -1;
+        char tail;
+        if (sscanf(hostname, "sim%d.ntp%c", &server, &tail) != 1 || server < 0 ||
+            (size_t)server >= _world._servers.size())
+            server = -1;
+        _queries[i] = {true, server, _world.nowUs() + _world._dnsDelayUs};
+        return i;
+    }
+    return -1;
+}
+
+int SimNetwork::resolveResult(int query, NTPAddress &address, uint32_t &ttlSec)
+{
+    Query &q = _queries[query];
+    if (!q.used)
+        return -1;
+    if (_world.nowUs() < q.doneUs)
+        return 0;
+
+    q.used = false;
+    if (q.server < 0)
+        return -1;
+    address.family = NTPFamily::IPv4;
+    memset(address.ip, 0, sizeof(address.ip));
+    address.ip[0] = 10;
+    address.ip[3] = (uint8_t)(q.server + 1);
+    ttlSec = SIM_DNS_TTL_S;
+    return 1;
+}
+
+void SimNetwork::resolveCancel(int query)
+{
+    _queries[query].used = false;
+}
+
+bool SimNetwork::send(const NTPAddress &to, const uint8_t *buf, size_t len)
+{
+    int64_t txMonotonicUs;
+    return sendStamped(to, buf, len, txMonotonicUs);
+}
+
+int SimNetwork::receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs)
+{
+    int64_t rxMonotonicUs;
+    return receiveStamped(buf, len, from, timeoutMs, rxMonotonicUs);
+}
+
+/**
+ * @brief Entrega o pedido ao servidor e agenda a resposta, se não houver
+ *        perda em nenhum dos sentidos
+ */
+bool SimNetwork::sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                             int64_t &txMonotonicUs)
+{
+    txMonotonicUs = _world._clock.monotonicUs();
+    _sent++;
+
+    int server = to.ip[3] - 1;
+    if (to.family != NTPFamily::IPv4 || to.ip[0] != 10 || server < 0 ||
+        (size_t)server >= _world._servers.size() || len < NTP_PACKET_SIZE)
+        return true; // Sem destino: o pacote se perde, como na rede real
+
+    InFlight reply;
+    if (_world.serve(server, buf, _world.nowUs(), reply.data, reply.arrivalUs))
+    {
+        reply.from = to;
+        _inFlight.push_back(reply);
+    }
+    return true;
+}
+
+/**
+ * @brief Entrega a próxima resposta que chegar até o timeout, avançando o
+ *        tempo da simulação até ela
+ */
+int SimNetwork::receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                               int64_t &rxMonotonicUs)
+{
+    rxMonotonicUs = 0;
+    int64_t deadline = _world.nowUs() + (int64_t)timeoutMs * 1000;
+    auto next = std::min_element(_inFlight.begin(), _inFlight.end(),
+                                 [](const InFlight &a, const InFlight &b)
+                                 { return a.arrivalUs < b.arrivalUs; });
+    if (next == _inFlight.end() || next->arrivalUs > deadline)
+    {
+        _world.advanceTo(deadline);
+        return 0;
+    }
+
+    _world.advanceTo(next->arrivalUs);
+    rxMonotonicUs = _world._clock.monotonicAt(next->arrivalUs);
+    from = next->from;
+    size_t copied = std::min(len, sizeof(next->data));
+    memcpy(buf, next->data, copied);
+    _inFlight.erase(next);
+    return (int)copied;
+}
+
+// ----------------------------------------------------
+//
+//               SimTasking
+//
+// ----------------------------------------------------
+
+bool SimTasking::start(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+                       uint8_t priority)
+{
+    (void)task;
+    (void)name;
+    (void)stackSize;
+    (void)arg;
+    (void)priority;
+    return true;
+}
+
+// ----------------------------------------------------
+//
+//               SimWorld
+//
+// ----------------------------------------------------
+
+SimWorld::SimWorld(uint32_t seed, double driftPpm, int64_t initialErrorUs, uint32_t dnsDelayUs)
+    : _nowUs(NTP_SIM_EPOCH_US),
+      _dnsDelayUs(dnsDelayUs),
+      _rng(seed),
+      _stats{},
+      _lastRequestUs{},
+      _clock(*this, driftPpm, initialErrorUs),
+      _network(*this)
+{
+}
+
+/**
+ * @brief Adiciona um servidor virtual
+ *
+ * @return Índice N do servidor, acessível como "simN.ntp", ou -1 se já
+ *         houver NTP_SIM_MAX_SERVERS servidores.
+ */
+int SimWorld::addServer(const SimServerConfig &config)
+{
+    if (_servers.size() >= NTP_SIM_MAX_SERVERS)
+        return -1;
+    _servers.push_back(config);
+    return (int)_servers.size() - 1;
+}
+
+void SimWorld::advanceTo(int64_t trueUs)
+{
+    _nowUs = std::max(_nowUs, trueUs);
+}
+
+bool SimWorld::lost(uint8_t percent)
+{
+    return percent > 0 && _rng() % 100 < percent;
+}
+
+int64_t SimWorld::pathDelayUs(uint32_t fixedUs, uint32_t jitterUs)
+{
+    if (jitterUs == 0)
+        return fixedUs;
+    std::exponential_distribution<double> tail(1.0 / jitterUs);
+    return fixedUs + (int64_t)tail(_rng);
+}
+
+/**
+ * @brief Resposta do servidor a um pedido enviado em sentUs
+ *
+ * @param arrivalUs Recebe o tempo verdadeiro de chegada da resposta ao
+ *                  cliente.
+ *
+ * @return false se o pedido ou a resposta se perderem.
+ */
+bool SimWorld::serve(int server, const uint8_t *request, int64_t sentUs, uint8_t *reply,
+                     int64_t &arrivalUs)
+{
+    const SimServerConfig &config = _servers[server];
+    SimServerStats &stats = _stats[server];
+
+    uint32_t forwardUs = config.delayUs * config.forwardPercent / 100;
+    if (lost(config.lossPercent))
+        return false;
+    int64_t receivedUs = sentUs + pathDelayUs(forwardUs, config.jitterUs);
+    stats.requests++;
+
+    NTPPacket query;
+    if (!query.decode(request, NTP_PACKET_SIZE) || query.mode != NTP_MODE_CLIENT)
+        return false;
+
+    uint32_t kiss = config.kissCode;
+    if (kiss == 0 && config.rateMinIntervalMs > 0 && stats.requests > 1 &&
+        receivedUs - _lastRequestUs[server] < (int64_t)config.rateMinIntervalMs * 1000)
+        kiss = NTP_KISS_RATE;
+    _lastRequestUs[server] = receivedUs;
+
+    int64_t serverUs = receivedUs + config.offsetUs;
+    NTPPacket packet = {};
+    packet.version = NTP_VERSION;
+    packet.mode = NTP_MODE_SERVER;
+    packet.poll = query.poll;
+    packet.precision = -20;
+    packet.originTs = query.transmitTs;
+    if (kiss != 0)
+    {
+        packet.leap = NTP_LEAP_UNSYNC;
+        packet.stratum = 0;
+        packet.referenceId = kiss;
+        stats.kisses++;
+    }
+    else
+    {
+        packet.leap = NTP_LEAP_NONE;
+        packet.stratum = config.stratum;
+        packet.rootDelay = ntpShortFromUs(1000);
+        packet.rootDispersion = ntpShortFromUs(1000);
+        packet.referenceId = 0x53494D00 | (uint32_t)server; // "SIM" + índice
+        packet.referenceTs = ntpFromUnixUs(serverUs - 16000000);
+        packet.receiveTs = ntpFromUnixUs(serverUs);
+        packet.transmitTs = ntpFromUnixUs(serverUs + SIM_SERVER_PROCESSING_US);
+        stats.replies++;
+    }
+    packet.encode(reply);
+
+    if (lost(config.lossPercent))
+        return false;
+    arrivalUs = receivedUs + SIM_SERVER_PROCESSING_US +
+                pathDelayUs(config.delayUs - forwardUs, config.jitterUs);
+    return true;
+}
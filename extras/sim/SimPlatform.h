@@ -0,0 +1,190 @@
+#ifndef NTP_SIM_PLATFORM_H
+#define NTP_SIM_PLATFORM_H
+
+#include <NTPPacket.h>
+#include <hal/NTPHal.h>
+#include <hal/PosixPlatform.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+constexpr int64_t NTP_SIM_EPOCH_US = 1767225600LL * 1000000LL; // 2026-01-01T00:00:00Z
+constexpr uint8_t NTP_SIM_MAX_SERVERS = 8;
+constexpr uint32_t NTP_SIM_SLEW_RATE_PPM = 500;
+
+class SimWorld;
+
+/**
+ * @brief Comportamento de um servidor NTP virtual
+ *
+ * O atraso de cada sentido é a parte fixa (delayUs × forwardPercent no
+ * sentido cliente → servidor) somada a uma cauda exponencial de média
+ * jitterUs, como numa fila de roteador.
+ */
+struct SimServerConfig
+{
+    uint32_t delayUs = 20000;       // Atraso mínimo de ida e volta
+    uint32_t jitterUs = 1000;       // Média da cauda exponencial de cada sentido
+    uint8_t forwardPercent = 50;    // Parte do atraso mínimo no sentido de ida
+    uint8_t lossPercent = 0;        // Perda em cada sentido
+    int64_t offsetUs = 0;           // Erro do horário do servidor
+    uint8_t stratum = 2;
+    uint32_t kissCode = 0;          // KoD enviado a todo pedido (ex.: NTP_KISS_DENY), ou 0
+    uint32_t rateMinIntervalMs = 0; // Pedidos mais próximos recebem KoD RATE; 0 desliga
+};
+
+struct SimServerStats
+{
+    uint32_t requests; // Pedidos que chegaram ao servidor
+    uint32_t replies;
+    uint32_t kisses;
+};
+
+/**
+ * @brief Oscilador local com deriva e erro inicial, corrigido pelo NTPSync
+ *
+ * O relógio monotônico avança (1 + driftPpm) vezes o tempo verdadeiro do
+ * SimWorld; o horário do sistema soma a ele o erro inicial e as
+ * correções de step e slew, com o slew aplicado a NTP_SIM_SLEW_RATE_PPM
+ * como o adjtime().
+ */
+class SimClock : public NTPClock
+{
+public:
+    SimClock(SimWorld &world, double driftPpm, int64_t initialErrorUs);
+
+    uint32_t millis() override { return (uint32_t)(monotonicUs() / 1000); }
+    int64_t monotonicUs() override;
+    void now(struct timeval &tv) override;
+    void step(int64_t offsetUs) override;
+    void slew(int64_t offsetUs) override;
+    int64_t pendingSlewUs() override;
+    void sleepMs(uint32_t ms) override;
+    bool rtcUs(int64_t &us) override;
+    uint32_t rtcTolerancePpm() override { return 500; }
+    uint32_t random() override;
+
+    int64_t wallUs();
+    int64_t monotonicAt(int64_t trueUs) const;
+
+private:
+    SimWorld &_world;
+    double _driftPpm;
+    int64_t _initialErrorUs;
+    int64_t _offsetUs;
+    int64_t _pendingUs;
+    int64_t _settledAtUs;
+
+    void settle();
+};
+
+/**
+ * @brief Rede virtual: DNS com atraso fixo e datagramas com atraso,
+ *        assimetria e perda sorteados por servidor
+ *
+ * Os servidores respondem no instante em que o pedido chega a eles;
+ * receive() avança o tempo do SimWorld até a próxima resposta ou até o
+ * timeout, então uma espera nunca custa tempo real.
+ */
+class SimNetwork : public NTPNetwork
+{
+public:
+    explicit SimNetwork(SimWorld &world) : _world(world), _queries{} {}
+
+    bool connected() override { return true; }
+    int resolveStart(const char *hostname) override;
+    int resolveResult(int query, NTPAddress &address, uint32_t &ttlSec) override;
+    void resolveCancel(int query) override;
+    bool open() override { return true; }
+    void close() override {}
+    bool send(const NTPAddress &to, const uint8_t *buf, size_t len) override;
+    int receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs) override;
+    bool sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                     int64_t &txMonotonicUs) override;
+    int receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                       int64_t &rxMonotonicUs) override;
+
+    uint32_t sent() const { return _sent; }
+
+private:
+    struct Query
+    {
+        bool used;
+        int server;     // Índice do servidor, ou -1 para hostname desconhecido
+        int64_t doneUs; // Tempo verdadeiro em que a resposta do DNS chega
+    };
+
+    struct InFlight
+    {
+        int64_t arrivalUs; // Tempo verdadeiro de chegada ao cliente
+        NTPAddress from;
+        uint8_t data[NTP_PACKET_SIZE];
+    };
+
+    SimWorld &_world;
+    Query _queries[NTP_MAX_DNS_QUERIES];
+    std::vector<InFlight> _inFlight;
+    uint32_t _sent = 0;
+};
+
+/**
+ * @brief Tarefas que nunca rodam: o laço da simulação chama loop()
+ */
+class SimTasking : public NTPTasking
+{
+public:
+    bool start(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+               uint8_t priority) override;
+    void wait(uint32_t timeoutMs) override { (void)timeoutMs; }
+    void notify() override {}
+};
+
+/**
+ * @brief Tempo virtual, servidores e backends de uma simulação
+ *
+ * Determinístico: a mesma semente produz as mesmas perdas, atrasos e
+ * resultados. Os servidores são "simN.ntp" (N a partir de 0), resolvidos
+ * para 10.0.0.(N+1) após dnsDelayUs.
+ */
+class SimWorld
+{
+public:
+    SimWorld(uint32_t seed, double driftPpm, int64_t initialErrorUs, uint32_t dnsDelayUs = 30000);
+
+    SimWorld(const SimWorld &) = delete;
+    SimWorld &operator=(const SimWorld &) = delete;
+
+    int addServer(const SimServerConfig &config);
+    NTPPlatform platform() { return {&_network, &_clock, &_storage, &_tasking}; }
+
+    int64_t nowUs() const { return _nowUs; }
+    int64_t elapsedUs() const { return _nowUs - NTP_SIM_EPOCH_US; }
+    void advanceTo(int64_t trueUs);
+
+    int64_t clockErrorUs() { return _clock.wallUs() - _nowUs; }
+    uint32_t sent() const { return _network.sent(); }
+    const SimServerStats &serverStats(int server) const { return _stats[server]; }
+    size_t serverCount() const { return _servers.size(); }
+
+private:
+    friend class SimClock;
+    friend class SimNetwork;
+
+    int64_t _nowUs;
+    uint32_t _dnsDelayUs;
+    std::mt19937 _rng;
+    std::vector<SimServerConfig> _servers;
+    SimServerStats _stats[NTP_SIM_MAX_SERVERS];
+    int64_t _lastRequestUs[NTP_SIM_MAX_SERVERS];
+    SimClock _clock;
+    SimNetwork _network;
+    PosixStorage _storage;
+    SimTasking _tasking;
+
+    bool lost(uint8_t percent);
+    int64_t pathDelayUs(uint32_t fixedUs, uint32_t jitterUs);
+    bool serve(int server, const uint8_t *request, int64_t sentUs, uint8_t *reply,
+               int64_t &arrivalUs);
+};
+
+#endif // NTP_SIM_PLATFORM_H
@@ -0,0 +1,97 @@
+#include "SimRun.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <memory>
+#include <string>
+
+double SimResult::percentile(double q) const
+{
+    if (errorsUs.empty())
+        return 0;
+    return errorsUs[std::min(errorsUs.size() - 1, (size_t)(q * errorsUs.size()))];
+}
+
+/**
+ * @brief Sincroniza um NTPSyncClock com os servidores de world por hours
+ *        de tempo virtual
+ *
+ * O NTPSyncClock roda sem modificações sobre SimWorld: loop() é chamado
+ * por este laço, que avança o tempo virtual pelo intervalo devolvido e
+ * amostra o erro do relógio a cada NTP_SIM_SAMPLE_INTERVAL_MS.
+ *
+ * @param world Mundo já com os servidores do cenário; os nomes simN.ntp
+ *              são passados ao NTPSyncClock na ordem de addServer().
+ */
+SimResult simRun(SimWorld &world, const SimPolicy &policy, uint32_t hours)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector<std::string> servers;
+    for (size_t i = 0; i < world.serverCount(); i++)
+    {
+        servers.push_back("sim" + std::to_string(i) + ".ntp");
+    }
+
+    // ~10 KB: fora da pilha, como recomenda NTPSyncClock
+    std::unique_ptr<NTPSyncClock> ntp(new NTPSyncClock("sim", world.platform()));
+    SimTasking tasking;
+    NTPScheduler scheduler(&tasking);
+    ntp->setTimeval("UTC", servers);
+    ntp->setSyncMode(policy.mode, policy.quorum);
+    if (policy.adaptive)
+        ntp->setAdaptivePolling(true);
+    ntp->begin(policy.syncMin, policy.retryMin, scheduler);
+
+    SimResult result;
+    int64_t durationUs = (int64_t)hours * 3600 * 1000000;
+    int64_t nextSampleUs = world.nowUs();
+    int64_t firstSyncUs = -1;
+    int64_t stalledAtUs = -1;
+    uint32_t stalled = 0;
+
+    while (world.elapsedUs() < durationUs)
+    {
+        uint32_t waitMs = ntp->loop();
+
+        if (firstSyncUs < 0 && ntp->getStatus().source == NTPTimeSource::Ntp)
+            firstSyncUs = world.elapsedUs();
+
+        // Só o receive() avança o tempo durante uma troca: protege contra
+        // um estado que devolva 0 indefinidamente
+        if (waitMs == 0)
+        {
+            stalled = world.nowUs() == stalledAtUs ? stalled + 1 : 0;
+            stalledAtUs = world.nowUs();
+            if (stalled < NTP_SIM_STALL_LOOPS)
+                continue;
+            waitMs = 1;
+        }
+
+        int64_t targetUs = world.nowUs() + (int64_t)waitMs * 1000;
+        while (nextSampleUs <= targetUs)
+        {
+            world.advanceTo(nextSampleUs);
+            if (firstSyncUs >= 0 &&
+                world.elapsedUs() - firstSyncUs >= (int64_t)NTP_SIM_SETTLE_MS * 1000)
+                result.errorsUs.push_back(std::fabs((double)world.clockErrorUs()));
+            nextSampleUs += (int64_t)NTP_SIM_SAMPLE_INTERVAL_MS * 1000;
+        }
+        world.advanceTo(targetUs);
+    }
+
+    ntp->end();
+
+    std::sort(result.errorsUs.begin(), result.errorsUs.end());
+    result.synced = firstSyncUs >= 0;
+    result.firstSyncS = firstSyncUs >= 0 ? firstSyncUs / 1e6 : -1.0;
+    result.sent = world.sent();
+    for (size_t i = 0; i < world.serverCount(); i++)
+    {
+        result.kisses += world.serverStats((int)i).kisses;
+    }
+    result.finalErrorUs = world.clockErrorUs();
+    result.virtualS = world.elapsedUs() / 1e6;
+    result.realS = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
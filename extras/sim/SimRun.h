@@ -0,0 +1,46 @@
+#ifndef NTP_SIM_RUN_H
+#define NTP_SIM_RUN_H
+
+#include "SimPlatform.h"
+#include <NTPSync.h>
+#include <cstdint>
+#include <vector>
+
+constexpr uint32_t NTP_SIM_SAMPLE_INTERVAL_MS = 10000; // Amostragem do erro do relógio
+constexpr uint32_t NTP_SIM_SETTLE_MS = 30 * 60000;     // Após a 1ª sincronização, fora do regime
+constexpr uint32_t NTP_SIM_STALL_LOOPS = 10000;        // loop() seguidos sem avanço do tempo
+
+/**
+ * @brief Política de sincronização simulada: modo, quorum e intervalos
+ */
+struct SimPolicy
+{
+    const char *name;
+    NTPSyncClock::SyncMode mode;
+    uint8_t quorum;
+    uint32_t syncMin;  // Intervalo de sincronização, em minutos
+    uint32_t retryMin; // Intervalo após falha, em minutos
+    bool adaptive;
+};
+
+/**
+ * @brief Resultado de uma execução de simRun()
+ */
+struct SimResult
+{
+    bool synced = false;
+    double firstSyncS = -1;      // Tempo virtual até a 1ª sincronização
+    std::vector<double> errorsUs; // |erro| do relógio após NTP_SIM_SETTLE_MS, em ordem crescente
+    uint32_t sent = 0;
+    uint32_t kisses = 0;
+    int64_t finalErrorUs = 0;
+    double virtualS = 0;
+    double realS = 0;
+
+    double percentile(double q) const;
+    double maxErrorUs() const { return errorsUs.empty() ? 0 : errorsUs.back(); }
+};
+
+SimResult simRun(SimWorld &world, const SimPolicy &policy, uint32_t hours);
+
+#endif // NTP_SIM_RUN_H
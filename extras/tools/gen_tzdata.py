@@ -0,0 +1,401 @@
+#!/usr/bin/env python3
+"""
+Gera src/TimeZoneData.cpp e src/TimeZoneNames.h a partir da base IANA
+compilada (TZif).
+
+Para cada fuso são mantidas apenas as transições a partir de --since que a
+regra POSIX final (rodapé do arquivo TZif) não consegue reproduzir; daí em
+diante a regra é avaliada em tempo de execução. Tipos (offset, DST) e
+regras são deduplicados entre todos os fusos.
+
+Uso:
+    python3 extras/tools/gen_tzdata.py [--zoneinfo /usr/share/zoneinfo]
+                                       [--outdir src] [--since 1970]
+
+Antes de --since vale o offset em vigor naquela data; aumentar o ano reduz
+a tabela para dispositivos que nunca consultam datas antigas.
+
+Os nomes dos fusos formam um hash perfeito mínimo (hash-and-displace): o
+FNV-1a do nome escolhe um balde, e a semente do balde, misturada ao hash,
+escolhe a posição. TimeZone::find() repete o cálculo em constexpr.
+"""
+
+import argparse
+import calendar
+import os
+import re
+import struct
+import sys
+import time
+
+RULE_TYPE = 0xFF  # Tipo reservado: "a partir daqui vale a regra POSIX"
+MAX_UTC = 0xFFFFFFFF
+MASK = 0xFFFFFFFF
+KEYS_PER_BUCKET = 3
+
+
+# ----------------------------------------------------
+#               Leitura do TZif (RFC 8536)
+# ----------------------------------------------------
+
+def read_tzif(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if data[:4] != b"TZif":
+        raise ValueError("%s não é TZif" % path)
+    version = data[4]
+
+    def header(offset):
+        return struct.unpack(">6l", data[offset + 20:offset + 44])
+
+    isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = header(0)
+    pos = 44
+    tsize = 4
+    if version >= ord("2"):
+        pos += timecnt * 5 + typecnt * 6 + charcnt + leapcnt * 8 + isstdcnt + isutcnt
+        isutcnt, isstdcnt, leapcnt, timecnt, typecnt, charcnt = header(pos)
+        pos += 44
+        tsize = 8
+
+    fmt = ">%d%s" % (timecnt, "q" if tsize == 8 else "l")
+    times = list(struct.unpack(fmt, data[pos:pos + timecnt * tsize]))
+    pos += timecnt * tsize
+    indexes = list(data[pos:pos + timecnt])
+    pos += timecnt
+    types = []
+    for i in range(typecnt):
+        utoff, isdst, _ = struct.unpack(">lBB", data[pos + i * 6:pos + i * 6 + 6])
+        types.append((utoff, isdst))
+    pos += typecnt * 6 + charcnt + leapcnt * (tsize + 4) + isstdcnt + isutcnt
+
+    footer = ""
+    if version >= ord("2"):
+        footer = data[pos:].decode("ascii").strip("\n")
+    return [(t, types[i]) for t, i in zip(times, indexes)], types, footer
+
+
+# ----------------------------------------------------
+#               Regra POSIX TZ
+# ----------------------------------------------------
+
+def parse_offset(text):
+    m = re.match(r"([+-]?)(\d+)(?::(\d+))?(?::(\d+))?", text)
+    sign = -1 if m.group(1) == "-" else 1
+    value = int(m.group(2)) * 3600 + int(m.group(3) or 0) * 60 + int(m.group(4) or 0)
+    return sign * value, text[m.end():]
+
+
+def parse_name(text):
+    if text.startswith("<"):
+        end = text.index(">")
+        return text[1:end], text[end + 1:]
+    m = re.match(r"[A-Za-z]+", text)
+    return m.group(0), text[m.end():]
+
+
+def parse_date(text):
+    seconds = 7200
+    if "/" in text:
+        text, t = text.split("/")
+        seconds, _ = parse_offset(t)
+    if text.startswith("M"):
+        month, week, day = (int(x) for x in text[1:].split("."))
+        return ("M", month, week, day, 0, seconds)
+    if text.startswith("J"):
+        return ("J", 0, 0, 0, int(text[1:]), seconds)
+    return ("N", 0, 0, 0, int(text), seconds)
+
+
+def parse_posix(tz):
+    """Retorna (stdOffset, dstOffset, start, end) com offsets a leste de UTC."""
+    _, rest = parse_name(tz)
+    offset, rest = parse_offset(rest)
+    std = -offset
+    if not rest:
+        return (std, std, None, None)
+    _, rest = parse_name(rest)
+    dst = std + 3600
+    if rest and rest[0] != ",":
+        offset, rest = parse_offset(rest)
+        dst = -offset
+    start, end = rest[1:].split(",")
+    return (std, dst, parse_date(start), parse_date(end))
+
+
+def rule_day(date, year):
+    """Dia (desde 1970) em que a data da regra cai no ano dado."""
+    kind, month, week, day, yday, _ = date
+    jan1 = calendar.timegm((year, 1, 1, 0, 0, 0)) // 86400
+    leap = calendar.isleap(year)
+    if kind == "J":
+        return jan1 + yday - 1 + (1 if leap and yday >= 60 else 0)
+    if kind == "N":
+        return jan1 + yday
+    first = calendar.timegm((year, month, 1, 0, 0, 0)) // 86400
+    wday = (first + 4) % 7  # 1970-01-01 foi quinta-feira
+    d = first + (day - wday) % 7 + (week - 1) * 7
+    last = first + calendar.monthrange(year, month)[1] - 1
+    while d > last:
+        d -= 7
+    return d
+
+
+def rule_transitions(rule, year):
+    std, dst, start, end = rule
+    if start is None:
+        return []
+    s = rule_day(start, year) * 86400 + start[5] - std
+    e = rule_day(end, year) * 86400 + end[5] - dst
+    return sorted([(s, (dst, 1)), (e, (std, 0))])
+
+
+# ----------------------------------------------------
+#               Compactação por fuso
+# ----------------------------------------------------
+
+def compile_zone(path, since=0):
+    transitions, types, footer = read_tzif(path)
+    rule = parse_posix(footer) if footer else None
+
+    before = [t for t in transitions if t[0] < since]
+    initial = before[-1][1] if before else types[0]
+    # Remove transições que não mudam o tipo (ex.: marcador em 2^31-1)
+    kept = []
+    current = initial
+    for t, ttype in transitions:
+        if t >= since and ttype != current:
+            kept.append((t, ttype))
+        current = ttype
+
+    # Descarta do fim as transições que a regra POSIX reproduz, desde que a
+    # regra não preveja nenhuma outra transição entre elas (ex.: ano sem DST)
+    dropped = None
+    if rule is not None and rule[2] is not None:
+        while kept:
+            t, ttype = kept[-1]
+            y = time.gmtime(t).tm_year
+            ny = time.gmtime(dropped).tm_year if dropped is not None else y
+            predicted = [p for yy in range(y - 1, ny + 2) for p in rule_transitions(rule, yy)]
+            if (t, (ttype[0], 1 if ttype[1] else 0)) not in predicted:
+                break
+            if dropped is not None and any(t < pt < dropped for pt, _ in predicted):
+                break
+            dropped = t
+            kept.pop()
+
+    entries = [(t, (ttype[0], 1 if ttype[1] else 0)) for t, ttype in kept]
+    initial = (initial[0], 1 if initial[1] else 0)
+    if rule is not None and rule[2] is not None:
+        if dropped is not None:
+            entries.append((dropped, None))
+        elif entries:
+            entries[-1] = (entries[-1][0], None)
+        else:
+            initial = None
+
+    for t, _ in entries:
+        if t > MAX_UTC:
+            raise ValueError("%s: transição fora do intervalo de 32 bits" % path)
+    return footer or "UTC0", rule or (0, 0, None, None), initial, entries
+
+
+def zone_names(zoneinfo):
+    names = []
+    with open(os.path.join(zoneinfo, "tzdata.zi")) as f:
+        for line in f:
+            fields = line.split()
+            if fields and fields[0] == "Z":
+                names.append(fields[1])
+            elif fields and fields[0] == "L":
+                names.append(fields[2])
+    return sorted(set(names))
+
+
+def tzdata_version(zoneinfo):
+    with open(os.path.join(zoneinfo, "tzdata.zi")) as f:
+        first = f.readline()
+    m = re.match(r"# version (\S+)", first)
+    return m.group(1) if m else "desconhecida"
+
+
+# ----------------------------------------------------
+#               Hash perfeito dos nomes
+# ----------------------------------------------------
+
+def fnv1a(name):
+    h = 2166136261
+    for b in name.encode("ascii"):
+        h = ((h ^ b) * 16777619) & MASK
+    return h
+
+
+def mix(h, seed):
+    """Deve ser idêntico a tzMix() em TimeZone.h."""
+    x = (h + seed * 0x9E3779B9) & MASK
+    x ^= x >> 16
+    x = (x * 0x85EBCA6B) & MASK
+    x ^= x >> 13
+    x = (x * 0xC2B2AE35) & MASK
+    x ^= x >> 16
+    return x
+
+
+def perfect_hash(names):
+    """Retorna (sementes por balde, nomes na ordem das posições)."""
+    count = len(names)
+    buckets = [[] for _ in range((count + KEYS_PER_BUCKET - 1) // KEYS_PER_BUCKET)]
+    for name in names:
+        buckets[fnv1a(name) % len(buckets)].append(name)
+
+    seeds = [0] * len(buckets)
+    slots = [None] * count
+    for index in sorted(range(len(buckets)), key=lambda b: -len(buckets[b])):
+        keys = buckets[index]
+        if not keys:
+            continue
+        for seed in range(1, 0x10000):
+            chosen = [mix(fnv1a(k), seed) % count for k in keys]
+            if len(set(chosen)) == len(keys) and all(slots[c] is None for c in chosen):
+                break
+        else:
+            sys.exit("Não foi possível construir o hash perfeito")
+        seeds[index] = seed
+        for k, c in zip(keys, chosen):
+            slots[c] = k
+    return seeds, slots
+
+
+# ----------------------------------------------------
+#               Emissão do C++
+# ----------------------------------------------------
+
+def c_date(date):
+    if date is None:
+        return "{TZRuleDate::None, 0, 0, 0, 0, 0}"
+    kind, month, week, day, yday, seconds = date
+    kinds = {"M": "TZRuleDate::MonthWeekDay", "J": "TZRuleDate::Julian", "N": "TZRuleDate::DayOfYear"}
+    return "{%s, %d, %d, %d, %d, %d}" % (kinds[kind], month, week, day, yday, seconds)
+
+
+def emit(zoneinfo, outdir, since):
+    names = zone_names(zoneinfo)
+    types = {}
+    rules = {}
+    posix = set()
+    zones = {}
+    zone_list = []
+    transitions = []
+    name_zone = {}
+
+    def type_index(t):
+        if t is None:
+            return RULE_TYPE
+        if t not in types:
+            types[t] = len(types)
+        return types[t]
+
+    for name in names:
+        footer, rule, initial, entries = compile_zone(os.path.join(zoneinfo, name), since)
+        key = (footer, rule, initial, tuple(entries))
+        if key not in zones:
+            if rule not in rules:
+                rules[rule] = len(rules)
+            posix.add(footer)
+            zones[key] = len(zone_list)
+            zone_list.append((footer, rules[rule], type_index(initial), len(transitions),
+                              len(entries)))
+            for t, ttype in entries:
+                transitions.append((t, type_index(ttype)))
+        name_zone[name] = zones[key]
+
+    if len(types) >= RULE_TYPE:
+        sys.exit("Tipos demais para índice de 8 bits")
+    if len(transitions) > 0xFFFF or len(zone_list) >= 0xFFFF:
+        sys.exit("Tabela grande demais para índices de 16 bits")
+
+    banner = ("// Gerado por extras/tools/gen_tzdata.py a partir do tzdata %s"
+              " (transições desde %d). Não editar."
+              % (tzdata_version(zoneinfo), time.gmtime(since).tm_year))
+
+    out = [banner, ""]
+    out.append('#include "TimeZone.h"')
+    out.append("")
+    out.append("const TZType TZ_TYPES[] = {")
+    for (offset, dst), _ in sorted(types.items(), key=lambda kv: kv[1]):
+        out.append("    {%d, %d}," % (offset, dst))
+    out.append("};")
+    out.append("")
+    out.append("const TZRule TZ_RULES[] = {")
+    for (std, dst, start, end), _ in sorted(rules.items(), key=lambda kv: kv[1]):
+        out.append("    {%d, %d, %s, %s}," % (std, dst, c_date(start), c_date(end)))
+    out.append("};")
+    out.append("")
+    out.append("const uint32_t TZ_TRANSITION_UTC[] = {")
+    for i in range(0, len(transitions), 6):
+        out.append("    " + " ".join("%du," % t for t, _ in transitions[i:i + 6]))
+    out.append("};")
+    out.append("")
+    out.append("const uint8_t TZ_TRANSITION_TYPE[] = {")
+    for i in range(0, len(transitions), 16):
+        out.append("    " + " ".join("%d," % k for _, k in transitions[i:i + 16]))
+    out.append("};")
+    out.append("")
+    out.append("const TZZone TZ_ZONES[] = {")
+    for p, r, initial, first, count in zone_list:
+        out.append('    {"%s", %d, %d, %d, %d},' % (p, r, initial, first, count))
+    out.append("};")
+    out.append("")
+    with open(os.path.join(outdir, "TimeZoneData.cpp"), "w") as f:
+        f.write("\n".join(out))
+
+    seeds, slots = perfect_hash(names)
+    out = [banner, "", "#ifndef TIME_ZONE_NAMES_H", "#define TIME_ZONE_NAMES_H", ""]
+    out.append("#include <cstddef>")
+    out.append("#include <cstdint>")
+    out.append("#include <string_view>")
+    out.append("")
+    out.append("constexpr size_t TZ_NAME_COUNT = %d;" % len(slots))
+    out.append("constexpr size_t TZ_HASH_BUCKETS = %d;" % len(seeds))
+    out.append("")
+    out.append("inline constexpr uint16_t TZ_HASH_SEEDS[TZ_HASH_BUCKETS] = {")
+    for i in range(0, len(seeds), 12):
+        out.append("    " + " ".join("%d," % v for v in seeds[i:i + 12]))
+    out.append("};")
+    out.append("")
+    out.append("// Nomes na ordem das posições do hash")
+    out.append("inline constexpr std::string_view TZ_NAME_KEYS[TZ_NAME_COUNT] = {")
+    for name in slots:
+        out.append('    "%s",' % name)
+    out.append("};")
+    out.append("")
+    out.append("// Índice em TZ_ZONES de cada nome")
+    out.append("inline constexpr uint16_t TZ_NAME_ZONES[TZ_NAME_COUNT] = {")
+    for i in range(0, len(slots), 12):
+        out.append("    " + " ".join("%d," % name_zone[n] for n in slots[i:i + 12]))
+    out.append("};")
+    out.append("")
+    out.append("#endif // TIME_ZONE_NAMES_H")
+    out.append("")
+
+    with open(os.path.join(outdir, "TimeZoneNames.h"), "w") as f:
+        f.write("\n".join(out))
+
+    size = (len(types) * 8 + len(rules) * 32 + len(transitions) * 5 + len(zone_list) * 12
+            + len(names) * 12 + len(seeds) * 2 + sum(len(n) + 1 for n in names)
+            + sum(len(p) + 1 for p in posix))
+    print("%d nomes, %d fusos, %d regras, %d tipos, %d transições (~%d bytes)"
+          % (len(names), len(zone_list), len(rules), len(types), len(transitions), size))
+
+
+def main():
+    root = os.path.dirname(os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+    parser = argparse.ArgumentParser(description=__doc__.split("\n")[1])
+    parser.add_argument("--zoneinfo", default="/usr/share/zoneinfo")
+    parser.add_argument("--outdir", default=os.path.join(root, "src"))
+    parser.add_argument("--since", type=int, default=1970)
+    args = parser.parse_args()
+    emit(args.zoneinfo, args.outdir, calendar.timegm((args.since, 1, 1, 0, 0, 0)))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,228 @@
+#include "ClockDiscipline.h"
+#include <algorithm>
+#include <cmath>
+
+ClockDiscipline::ClockDiscipline()
+    : _stepThresholdUs(NTP_STEP_THRESHOLD_US),
+      _pollMs(0),
+      _pollMinMs(0),
+      _pollMaxMs(0),
+      _errorBudgetUs(0),
+      _pollCounter(0)
+{
+    reset();
+}
+
+/**
+ * @brief Volta ao estado inicial, esquecendo a frequência estimada
+ */
+void ClockDiscipline::reset()
+{
+    _state = State::Unset;
+    _freqPpm = 0;
+    _freqKnown = false;
+    _lastUpdateMs = 0;
+    _spikeStartMs = 0;
+    _lastTickMs = 0;
+    _tickResidualUs = 0;
+    _freqStepPpm = 0;
+    _pollMs = _pollMinMs;
+    _pollCounter = 0;
+}
+
+/**
+ * @brief Define o offset a partir do qual o relógio é ajustado por step
+ *
+ * @param thresholdUs Limite em microssegundos. Offsets menores são sempre
+ *                    aplicados por slew.
+ */
+void ClockDiscipline::setStepThreshold(uint32_t thresholdUs)
+{
+    _stepThresholdUs = thresholdUs;
+}
+
+/**
+ * @brief Restaura uma estimativa de frequência salva anteriormente
+ *
+ * Com a frequência conhecida, a compensação começa no próximo tick() e a
+ * fase de medição inicial é pulada.
+ *
+ * @param ppm Erro de frequência do oscilador em partes por milhão.
+ */
+void ClockDiscipline::setFrequency(double ppm)
+{
+    if (std::isnan(ppm))
+        return;
+    if (ppm > NTP_MAX_FREQ_PPM)
+        ppm = NTP_MAX_FREQ_PPM;
+    if (ppm < -NTP_MAX_FREQ_PPM)
+        ppm = -NTP_MAX_FREQ_PPM;
+    _freqStepPpm = ppm - _freqPpm;
+    _freqPpm = ppm;
+    _freqKnown = true;
+}
+
+/**
+ * @brief Processa um novo offset medido
+ *
+ * @param offsetUs Offset combinado, já descontada a compensação de
+ *                 frequência aplicada desde a última atualização.
+ * @param nowMs Relógio monotônico em milissegundos.
+ *
+ * @return Ação que deve ser aplicada ao relógio local com offsetUs.
+ */
+ClockDiscipline::Action ClockDiscipline::update(int64_t offsetUs, uint32_t nowMs)
+{
+    double dt = (nowMs - _lastUpdateMs) / 1000.0;
+    uint64_t magnitude = (uint64_t)(offsetUs < 0 ? -offsetUs : offsetUs);
+
+    if (magnitude > _stepThresholdUs)
+    {
+        if (_state == State::Sync)
+        {
+            // Um offset grande isolado costuma ser ruído da rede
+            _state = State::Spike;
+            _spikeStartMs = nowMs;
+            return Action::Ignore;
+        }
+        if (_state == State::Spike && nowMs - _spikeStartMs < NTP_STEPOUT_MS)
+        {
+            return Action::Ignore;
+        }
+
+        // Após um step ou um slew, o relógio estava certo na última
+        // atualização: todo o offset acumulado desde então é deriva
+        if (_state == State::Frequency && dt >= NTP_MIN_FREQ_INTERVAL_S)
+            setFrequency(offsetUs / dt);
+
+        _state = _freqKnown ? State::Sync : State::Frequency;
+        _lastUpdateMs = nowMs;
+        _lastTickMs = nowMs;
+        _tickResidualUs = 0;
+        return Action::Step;
+    }
+
+    switch (_state)
+    {
+    case State::Unset:
+        _state = _freqKnown ? State::Sync : State::Frequency;
+        _lastTickMs = nowMs;
+        break;
+
+    case State::Frequency:
+        // Sem atualizar _lastUpdateMs: dt continua contando do último
+        // ajuste até alcançar o intervalo mínimo
+        if (dt < NTP_MIN_FREQ_INTERVAL_S)
+            return Action::Ignore;
+        // Primeira estimativa: todo o offset residual é atribuído à deriva
+        setFrequency(offsetUs / dt);
+        _state = State::Sync;
+        break;
+
+    case State::Spike:
+    case State::Sync:
+    {
+        _state = State::Sync;
+        if (dt <= 0)
+            break;
+
+        // PLL: ganho proporcional a dt / (constante de tempo)²
+        double tc = NTP_PLL_TC_FACTOR * dt;
+        double pll = offsetUs * dt / (tc * tc);
+
+        // FLL: acima do intercepto de Allan, a deriva domina o ruído de fase
+        double fll = dt >= NTP_ALLAN_S ? offsetUs / dt / NTP_FLL_GAIN : 0;
+
+        setFrequency(_freqPpm + pll + fll);
+        break;
+    }
+    }
+
+    _lastUpdateMs = nowMs;
+    return Action::Slew;
+}
+
+/**
+ * @brief Correção de fase acumulada pela frequência desde o último tick
+ *
+ * Deve ser chamada periodicamente (NTP_DISCIPLINE_TICK_MS) e o valor
+ * retornado aplicado ao relógio por slew. Frações de microssegundo são
+ * guardadas para o próximo tick.
+ *
+ * @return Correção em microssegundos, 0 enquanto a frequência não for
+ *         conhecida.
+ */
+int64_t ClockDiscipline::tick(uint32_t nowMs)
+{
+    uint32_t elapsedMs = nowMs - _lastTickMs;
+    _lastTickMs = nowMs;
+    if (!_freqKnown)
+        return 0;
+
+    _tickResidualUs += _freqPpm * elapsedMs / 1000.0;
+    int64_t correction = (int64_t)_tickResidualUs;
+    _tickResidualUs -= (double)correction;
+    return correction;
+}
+
+/**
+ * @brief Define os limites do intervalo adaptativo
+ *
+ * @param minMs Menor intervalo entre sincronizações; também é o inicial.
+ * @param maxMs Maior intervalo entre sincronizações.
+ * @param errorBudgetUs Erro máximo aceitável no fim de um intervalo.
+ */
+void ClockDiscipline::setPollLimits(uint32_t minMs, uint32_t maxMs, uint32_t errorBudgetUs)
+{
+    _pollMinMs = minMs;
+    _pollMaxMs = maxMs < minMs ? minMs : maxMs;
+    _errorBudgetUs = errorBudgetUs;
+    _pollMs = minMs;
+    _pollCounter = 0;
+}
+
+/**
+ * @brief Erro esperado ao fim de um intervalo sem sincronizar
+ *
+ * Soma o offset residual e o jitter medidos à deriva que a estimativa de
+ * frequência ainda não compensa, aproximada pela última variação dela.
+ */
+uint64_t ClockDiscipline::predictedErrorUs(int64_t offsetUs, uint32_t jitterUs, uint32_t intervalMs) const
+{
+    uint64_t magnitude = (uint64_t)(offsetUs < 0 ? -offsetUs : offsetUs);
+    double drift = std::fabs(_freqStepPpm) * intervalMs / 1000.0;
+    return magnitude + jitterUs + (uint64_t)drift;
+}
+
+/**
+ * @brief Ajusta o intervalo de sincronização após uma correção
+ *
+ * @param offsetUs Offset aplicado na última sincronização.
+ * @param jitterUs Jitter do sistema na última sincronização.
+ */
+void ClockDiscipline::adjustPoll(int64_t offsetUs, uint32_t jitterUs)
+{
+    if (_pollMaxMs == 0)
+        return;
+
+    if (_state != State::Sync ||
+        predictedErrorUs(offsetUs, jitterUs, _pollMs) > _errorBudgetUs)
+    {
+        _pollMs = std::max(_pollMs / 2, _pollMinMs);
+        _pollCounter = 0;
+        return;
+    }
+
+    uint32_t longer = _pollMs > _pollMaxMs / 2 ? _pollMaxMs : _pollMs * 2;
+    if (longer == _pollMs || predictedErrorUs(offsetUs, jitterUs, longer) > _errorBudgetUs)
+    {
+        _pollCounter = 0;
+        return;
+    }
+
+    if (++_pollCounter >= NTP_POLL_HYSTERESIS)
+    {
+        _pollMs = longer;
+        _pollCounter = 0;
+    }
+}
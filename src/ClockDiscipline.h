@@ -0,0 +1,85 @@
+#ifndef CLOCK_DISCIPLINE_H
+#define CLOCK_DISCIPLINE_H
+
+#include <cstdint>
+
+constexpr uint32_t NTP_STEP_THRESHOLD_US = 128000; // STEPT (128 ms)
+constexpr uint32_t NTP_STEPOUT_MS = 900000;        // Tempo mínimo em spike antes do step
+constexpr uint32_t NTP_ALLAN_S = 1500;             // Intercepto de Allan
+constexpr uint32_t NTP_MIN_FREQ_INTERVAL_S = 60;   // Intervalo mínimo para a 1ª estimativa
+constexpr uint32_t NTP_DISCIPLINE_TICK_MS = 16000; // Período da compensação de frequência
+constexpr double NTP_MAX_FREQ_PPM = 500.0;         // Tolerância máxima do oscilador
+constexpr uint8_t NTP_PLL_TC_FACTOR = 4;           // Constante de tempo = 4 * intervalo
+constexpr uint8_t NTP_FLL_GAIN = 4;                // Média do FLL (1/4)
+constexpr uint8_t NTP_POLL_HYSTERESIS = 3;         // Amostras boas antes de dobrar o intervalo
+
+/**
+ * @brief Disciplina do relógio local por PLL/FLL híbrido (RFC 5905 §11.3)
+ *
+ * Recebe os offsets medidos e decide se o relógio deve ser ajustado
+ * gradualmente (slew) ou por salto (step). Ao longo das sincronizações,
+ * estima o erro de frequência do oscilador, em ppm, e devolve em tick() a
+ * correção de fase devida a esse erro para ser aplicada entre as
+ * sincronizações.
+ *
+ * Com o intervalo adaptativo ativo, também escolhe o intervalo até a
+ * próxima sincronização: dobra quando o erro previsto para o dobro do
+ * intervalo cabe no orçamento de erro e reduz à metade quando o erro
+ * previsto para o intervalo atual o ultrapassa.
+ *
+ * A classe não acessa o relógio: quem a usa aplica as ações retornadas.
+ */
+class ClockDiscipline
+{
+public:
+    enum class State
+    {
+        Unset,     // Nenhum offset recebido ainda
+        Frequency, // Medindo a frequência após o primeiro ajuste
+        Sync,      // Frequência conhecida, PLL/FLL ativos
+        Spike      // Offset acima do limite, aguardando confirmação
+    };
+
+    enum class Action
+    {
+        Ignore, // Spike ou medição de frequência em curso
+        Slew,   // Aplicar o offset gradualmente
+        Step    // Aplicar o offset de uma vez
+    };
+
+    ClockDiscipline();
+
+    void reset();
+    void setStepThreshold(uint32_t thresholdUs);
+    void setFrequency(double ppm);
+    Action update(int64_t offsetUs, uint32_t nowMs);
+    int64_t tick(uint32_t nowMs);
+
+    void setPollLimits(uint32_t minMs, uint32_t maxMs, uint32_t errorBudgetUs);
+    void adjustPoll(int64_t offsetUs, uint32_t jitterUs);
+    uint32_t pollIntervalMs() const { return _pollMs; }
+    uint64_t predictedErrorUs(int64_t offsetUs, uint32_t jitterUs, uint32_t intervalMs) const;
+
+    State state() const { return _state; }
+    double frequencyPpm() const { return _freqPpm; }
+    bool frequencyKnown() const { return _freqKnown; }
+
+private:
+    State _state;
+    double _freqPpm;
+    bool _freqKnown;
+    uint32_t _stepThresholdUs;
+    uint32_t _lastUpdateMs;
+    uint32_t _spikeStartMs;
+    uint32_t _lastTickMs;
+    double _tickResidualUs;
+    double _freqStepPpm; // Variação da frequência na última atualização
+
+    uint32_t _pollMs;
+    uint32_t _pollMinMs;
+    uint32_t _pollMaxMs;
+    uint32_t _errorBudgetUs;
+    uint8_t _pollCounter;
+};
+
+#endif // CLOCK_DISCIPLINE_H
@@ -0,0 +1,373 @@
+#include "ClockFilter.h"
+#include "ClockDiscipline.h"
+#include <algorithm>
+#include <cmath>
+
+// ----------------------------------------------------
+//
+//               ClockFilter
+//
+// ----------------------------------------------------
+
+ClockFilter::ClockFilter()
+{
+    reset();
+}
+
+void ClockFilter::reset()
+{
+    for (auto &stage : _stages)
+    {
+        stage = {0, 0, NTP_MAX_DISPERSION_US, 0, 0};
+    }
+    _count = 0;
+    _lastUpdateMs = 0;
+    _serial = 0;
+    _usedSerial = 0;
+    _offsetUs = 0;
+    _delayUs = 0;
+    _dispersionUs = NTP_MAX_DISPERSION_US;
+    _jitterUs = 0;
+    _epochMs = 0;
+    _epochSerial = 0;
+    _rootDelayUs = 0;
+    _rootDispersionUs = 0;
+    _stratum = 0;
+}
+
+/**
+ * @brief Insere uma amostra e recalcula a saída do filtro
+ *
+ * @param sample Resultado de uma troca válida com o servidor.
+ * @param nowMs Relógio monotônico em milissegundos (millis()).
+ */
+void ClockFilter::add(const NTPSample &sample, uint32_t nowMs)
+{
+    // Envelhece as amostras anteriores: dispersão += PHI * tempo decorrido
+    uint64_t agedUs = (uint64_t)(nowMs - _lastUpdateMs) * NTP_PHI_PPM / 1000;
+    for (uint8_t i = NTP_FILTER_STAGES - 1; i > 0; i--)
+    {
+        _stages[i] = _stages[i - 1];
+        uint64_t dispersion = _stages[i].dispersionUs + agedUs;
+        _stages[i].dispersionUs = (uint32_t)std::min<uint64_t>(dispersion, NTP_MAX_DISPERSION_US);
+    }
+    _lastUpdateMs = nowMs;
+
+    // Dispersão da amostra: precisão de leitura + PHI * atraso
+    uint32_t dispersion = 1 + (uint32_t)((uint64_t)sample.delayUs * NTP_PHI_PPM / 1000000);
+    _stages[0] = {sample.offsetUs, sample.delayUs, dispersion, nowMs, ++_serial};
+    if (_count < NTP_FILTER_STAGES)
+        _count++;
+
+    _rootDelayUs = sample.rootDelayUs;
+    _rootDispersionUs = sample.rootDispersionUs;
+    _stratum = sample.stratum;
+
+    // Ordena por atraso (inserção: no máximo 8 estágios). Como no ntpd,
+    // amostras mais velhas que o intercepto de Allan somam a dispersão
+    // acumulada, para não vencerem as novas só pelo atraso
+    Stage sorted[NTP_FILTER_STAGES];
+    int64_t keys[NTP_FILTER_STAGES];
+    for (uint8_t i = 0; i < _count; i++)
+    {
+        int64_t key = _stages[i].delayUs;
+        if (nowMs - _stages[i].epochMs > NTP_ALLAN_S * 1000)
+            key += _stages[i].dispersionUs;
+        uint8_t j = i;
+        while (j > 0 && keys[j - 1] > key)
+        {
+            sorted[j] = sorted[j - 1];
+            keys[j] = keys[j - 1];
+            j--;
+        }
+        sorted[j] = _stages[i];
+        keys[j] = key;
+    }
+
+    _offsetUs = sorted[0].offsetUs;
+    _delayUs = sorted[0].delayUs;
+    _epochMs = sorted[0].epochMs;
+    _epochSerial = sorted[0].serial;
+
+    // Dispersão do par: soma ponderada por 1/2^(i+1), estágios vazios
+    // contam como MAXDISP
+    uint64_t peerDispersion = 0;
+    for (uint8_t i = 0; i < NTP_FILTER_STAGES; i++)
+    {
+        uint32_t d = i < _count ? sorted[i].dispersionUs : NTP_MAX_DISPERSION_US;
+        peerDispersion += d >> (i + 1);
+    }
+    _dispersionUs = (uint32_t)std::min<uint64_t>(peerDispersion, NTP_MAX_DISPERSION_US);
+
+    double sum = 0;
+    for (uint8_t i = 1; i < _count; i++)
+    {
+        double d = (double)(sorted[i].offsetUs - _offsetUs);
+        sum += d * d;
+    }
+    _jitterUs = _count > 1 ? (uint32_t)std::sqrt(sum / (_count - 1)) : 0;
+    if (_jitterUs == 0)
+        _jitterUs = 1;
+}
+
+/**
+ * @brief Indica se a amostra escolhida chegou depois da última correção
+ *
+ * Regra da RFC 5905 (§10 e §11.3): só uma amostra mais nova que a última
+ * atualização do relógio vai para a seleção e a disciplina.
+ */
+bool ClockFilter::fresh() const
+{
+    return _count > 0 && (int32_t)(_epochSerial - _usedSerial) > 0;
+}
+
+/**
+ * @brief Registra uma correção do relógio: as amostras recebidas até aqui
+ *        deixam de ser fresh()
+ *
+ * Os offsets guardados não são corrigidos: continuam relativos ao relógio
+ * da época em que foram medidos.
+ */
+void ClockFilter::markUsed()
+{
+    _usedSerial = _serial;
+}
+
+/**
+ * @brief Distância de sincronização até a referência primária
+ *
+ * λ = (rootDelay + delay) / 2 + rootDispersion + dispersion +
+ *     PHI * idade + jitter
+ */
+uint32_t ClockFilter::rootDistanceUs(uint32_t nowMs) const
+{
+    if (_count == 0)
+        return NTP_MAX_DISPERSION_US;
+
+    uint64_t delay = (uint64_t)_rootDelayUs + (uint64_t)_delayUs;
+    uint64_t distance = std::max<uint64_t>(NTP_MIN_DISPERSION_US, delay) / 2;
+    distance += _rootDispersionUs;
+    distance += _dispersionUs;
+    distance += (uint64_t)(nowMs - _epochMs) * NTP_PHI_PPM / 1000;
+    distance += _jitterUs;
+    return (uint32_t)std::min<uint64_t>(distance, NTP_MAX_DISPERSION_US);
+}
+
+/**
+ * @brief Limite do erro do offset escolhido
+ *
+ * Ao contrário de rootDistanceUs(), considera só a amostra escolhida, sem
+ * a dispersão dos estágios ainda vazios, que domina nas primeiras
+ * amostras:
+ * (rootDelay + delay) / 2 + rootDispersion + PHI * (delay + idade)
+ */
+uint32_t ClockFilter::maxErrorUs(uint32_t nowMs) const
+{
+    if (_count == 0)
+        return NTP_MAX_DISPERSION_US;
+
+    uint64_t delay = (uint64_t)std::max<int64_t>(_delayUs, 0);
+    uint64_t error = ((uint64_t)_rootDelayUs + delay) / 2 + _rootDispersionUs + 1;
+    error += delay * NTP_PHI_PPM / 1000000;
+    error += (uint64_t)(nowMs - _epochMs) * NTP_PHI_PPM / 1000;
+    return (uint32_t)std::min<uint64_t>(error, NTP_MAX_DISPERSION_US);
+}
+
+// ----------------------------------------------------
+//
+//               ClockSelect
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Seleciona os truechimers e combina seus offsets
+ *
+ * @param candidates Saída dos filtros; o vetor é reordenado e compactado
+ *                   com os sobreviventes no início.
+ * @param count Número de candidatos.
+ * @param result Offset combinado, jitter do sistema e contagens.
+ *
+ * @return false se não houver maioria que concorde sobre o horário. Com
+ *         maioria mas sem sobrevivente de amostra nova, result.fresh é
+ *         false e não há offset a aplicar.
+ */
+bool ClockSelect::combine(ClockCandidate *candidates, size_t count, Result &result)
+{
+    if (count == 0)
+        return false;
+    count = std::min<size_t>(count, NTP_MAX_CANDIDATES);
+
+    size_t truechimers = intersect(candidates, count);
+    if (truechimers == 0)
+        return false;
+
+    size_t survivors = cluster(candidates, truechimers);
+
+    double weightSum = 0;
+    double freshWeightSum = 0;
+    double offsetSum = 0;
+    for (size_t i = 0; i < survivors; i++)
+    {
+        double weight = 1.0 / std::max<uint32_t>(candidates[i].rootDistanceUs, 1);
+        weightSum += weight;
+        if (!candidates[i].fresh)
+            continue;
+        freshWeightSum += weight;
+        offsetSum += weight * (double)candidates[i].offsetUs;
+    }
+    double offset = freshWeightSum > 0 ? offsetSum / freshWeightSum : 0;
+
+    // Jitter do sistema: dispersão dos sobreviventes em torno do par de
+    // menor distância somada ao jitter do próprio par
+    const ClockCandidate &peer = *std::min_element(
+        candidates, candidates + survivors,
+        [](const ClockCandidate &a, const ClockCandidate &b)
+        { return a.rootDistanceUs < b.rootDistanceUs; });
+    double selJitter = 0;
+    for (size_t i = 0; i < survivors; i++)
+    {
+        double d = (double)(candidates[i].offsetUs - peer.offsetUs);
+        selJitter += d * d / std::max<uint32_t>(candidates[i].rootDistanceUs, 1);
+    }
+    selJitter /= weightSum;
+
+    result.offsetUs = (int64_t)std::llround(offset);
+    result.jitterUs = (uint32_t)std::sqrt(selJitter + (double)peer.jitterUs * peer.jitterUs);
+    result.maxErrorUs = 0;
+    for (size_t i = 0; i < survivors; i++)
+    {
+        result.maxErrorUs = std::max(result.maxErrorUs, candidates[i].maxErrorUs);
+    }
+    result.fresh = freshWeightSum > 0;
+    result.survivors = (uint8_t)survivors;
+    result.falsetickers = (uint8_t)(count - truechimers);
+    return true;
+}
+
+/**
+ * @brief Algoritmo de interseção
+ *
+ * Cada candidato define o intervalo [offset - λ, offset + λ]. Procura o
+ * menor intervalo que intersecta pelo menos n - f candidatos, com o
+ * número de falsetickers f < n / 2, e move os candidatos que o cruzam
+ * para o início do vetor.
+ *
+ * @return Número de truechimers, 0 se não houver maioria.
+ */
+size_t ClockSelect::intersect(ClockCandidate *candidates, size_t count)
+{
+    struct Edge
+    {
+        int64_t value;
+        int8_t type; // -1 = início, 0 = ponto médio, +1 = fim
+    };
+
+    Edge edges[NTP_MAX_CANDIDATES * 3];
+    size_t n = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        edges[n++] = {candidates[i].offsetUs - candidates[i].rootDistanceUs, -1};
+        edges[n++] = {candidates[i].offsetUs, 0};
+        edges[n++] = {candidates[i].offsetUs + candidates[i].rootDistanceUs, +1};
+    }
+    std::sort(edges, edges + n,
+              [](const Edge &a, const Edge &b)
+              { return a.value < b.value || (a.value == b.value && a.type < b.type); });
+
+    int64_t low = 0;
+    int64_t high = 0;
+    bool found = false;
+    for (size_t allow = 0; 2 * allow < count; allow++)
+    {
+        size_t midpoints = 0;
+        int chime = 0;
+        for (size_t i = 0; i < n; i++)
+        {
+            chime -= edges[i].type;
+            if (chime >= (int)(count - allow))
+            {
+                low = edges[i].value;
+                break;
+            }
+            if (edges[i].type == 0)
+                midpoints++;
+        }
+
+        chime = 0;
+        for (size_t i = n; i-- > 0;)
+        {
+            chime += edges[i].type;
+            if (chime >= (int)(count - allow))
+            {
+                high = edges[i].value;
+                break;
+            }
+            if (edges[i].type == 0)
+                midpoints++;
+        }
+
+        if (midpoints > allow)
+            continue;
+        if (low <= high)
+        {
+            found = true;
+            break;
+        }
+    }
+
+    if (!found)
+        return 0;
+
+    size_t truechimers = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const ClockCandidate &c = candidates[i];
+        if (c.offsetUs - (int64_t)c.rootDistanceUs <= high &&
+            c.offsetUs + (int64_t)c.rootDistanceUs >= low)
+        {
+            std::swap(candidates[truechimers++], candidates[i]);
+        }
+    }
+    return truechimers;
+}
+
+/**
+ * @brief Algoritmo de agrupamento
+ *
+ * Remove, um a um, o sobrevivente com maior jitter de seleção enquanto
+ * restarem mais de NMIN e esse jitter for maior que o menor jitter de par.
+ *
+ * @return Número de sobreviventes, mantidos no início do vetor.
+ */
+size_t ClockSelect::cluster(ClockCandidate *candidates, size_t count)
+{
+    while (count > NTP_MIN_CLUSTER)
+    {
+        size_t worst = 0;
+        double worstJitter = -1;
+        uint32_t minPeerJitter = UINT32_MAX;
+        for (size_t i = 0; i < count; i++)
+        {
+            double sum = 0;
+            for (size_t j = 0; j < count; j++)
+            {
+                double d = (double)(candidates[j].offsetUs - candidates[i].offsetUs);
+                sum += d * d;
+            }
+            double selJitter = std::sqrt(sum / (count - 1));
+            if (selJitter > worstJitter)
+            {
+                worstJitter = selJitter;
+                worst = i;
+            }
+            minPeerJitter = std::min(minPeerJitter, candidates[i].jitterUs);
+        }
+
+        if (worstJitter <= minPeerJitter)
+            break;
+
+        std::swap(candidates[worst], candidates[count - 1]);
+        count--;
+    }
+    return count;
+}
@@ -0,0 +1,120 @@
+#ifndef CLOCK_FILTER_H
+#define CLOCK_FILTER_H
+
+#include "NTPPacket.h"
+#include <cstddef>
+#include <cstdint>
+
+constexpr uint8_t NTP_FILTER_STAGES = 8;             // NSTAGE
+constexpr uint8_t NTP_MIN_CLUSTER = 3;               // NMIN
+constexpr uint8_t NTP_MAX_CANDIDATES = 16;           // Limite da seleção
+constexpr uint32_t NTP_PHI_PPM = 15;                 // Tolerância de frequência
+constexpr uint32_t NTP_MAX_DISPERSION_US = 16000000; // MAXDISP (16 s)
+constexpr uint32_t NTP_MIN_DISPERSION_US = 5000;     // MINDISP (5 ms)
+
+/**
+ * @brief Filtro de relógio de 8 estágios por servidor (RFC 5905 §10)
+ *
+ * Mantém as últimas amostras de um servidor e escolhe a de menor atraso,
+ * que é a menos afetada por filas na rede. A dispersão de cada amostra
+ * cresce com o tempo (PHI) e o jitter é o desvio RMS dos offsets em
+ * relação à amostra escolhida.
+ *
+ * A amostra escolhida só deve corrigir o relógio se tiver chegado depois
+ * da última correção (fresh()): uma amostra antiga de atraso menor
+ * continua vencendo por até 8 rodadas, e seu offset foi medido contra o
+ * relógio de antes da correção.
+ */
+class ClockFilter
+{
+public:
+    ClockFilter();
+
+    void reset();
+    void add(const NTPSample &sample, uint32_t nowMs);
+    void markUsed();
+
+    bool valid() const { return _count > 0; }
+    bool fresh() const;
+    int64_t offsetUs() const { return _offsetUs; }
+    int64_t delayUs() const { return _delayUs; }
+    uint32_t dispersionUs() const { return _dispersionUs; }
+    uint32_t jitterUs() const { return _jitterUs; }
+    uint8_t stratum() const { return _stratum; }
+    uint32_t rootDelayUs() const { return _rootDelayUs; }
+    uint32_t rootDistanceUs(uint32_t nowMs) const;
+    uint32_t maxErrorUs(uint32_t nowMs) const;
+
+private:
+    struct Stage
+    {
+        int64_t offsetUs;
+        int64_t delayUs;
+        uint32_t dispersionUs;
+        uint32_t epochMs;
+        uint32_t serial; // Ordem de chegada: _serial após o add()
+    };
+
+    Stage _stages[NTP_FILTER_STAGES];
+    uint8_t _count;
+    uint32_t _lastUpdateMs;
+    uint32_t _serial;     // Amostras recebidas desde o reset()
+    uint32_t _usedSerial; // _serial na última correção do relógio
+
+    int64_t _offsetUs;
+    int64_t _delayUs;
+    uint32_t _dispersionUs;
+    uint32_t _jitterUs;
+    uint32_t _epochMs;
+    uint32_t _epochSerial; // Série da amostra escolhida
+    uint32_t _rootDelayUs;
+    uint32_t _rootDispersionUs;
+    uint8_t _stratum;
+};
+
+/**
+ * @brief Candidato à seleção: saída do filtro de um servidor
+ */
+struct ClockCandidate
+{
+    int64_t offsetUs;
+    uint32_t rootDistanceUs;
+    uint32_t jitterUs;
+    uint8_t stratum;
+    uint32_t maxErrorUs; // ClockFilter::maxErrorUs()
+    bool fresh;          // ClockFilter::fresh(): só estes entram na média
+};
+
+/**
+ * @brief Seleção, agrupamento e combinação de servidores (RFC 5905 §11.2)
+ *
+ * O algoritmo de interseção (variante de Marzullo) encontra o menor
+ * intervalo que contém a maioria dos servidores e descarta os que não o
+ * cruzam (falsetickers). O agrupamento remove os sobreviventes mais
+ * dispersos e a combinação faz a média ponderada pelo inverso da
+ * distância à raiz.
+ *
+ * Todos os candidatos votam na interseção, mas só os de amostra nova
+ * entram na média: um offset já aplicado não deve ser aplicado de novo.
+ */
+class ClockSelect
+{
+public:
+    struct Result
+    {
+        int64_t offsetUs;
+        uint32_t jitterUs;
+        uint32_t maxErrorUs; // Maior erro entre os sobreviventes
+        bool fresh;          // Algum sobrevivente tem amostra nova; senão offsetUs é 0
+        uint8_t survivors;
+        uint8_t falsetickers;
+    };
+
+    static bool combine(ClockCandidate *candidates, size_t count, Result &result);
+
+private:
+    static size_t intersect(ClockCandidate *candidates, size_t count);
+    static size_t cluster(ClockCandidate *candidates, size_t count);
+};
+
+#endif // CLOCK_FILTER_H
@@ -0,0 +1,53 @@
+#ifndef FIXED_LIST_H
+#define FIXED_LIST_H
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @brief Lista de capacidade fixa, armazenada inline
+ *
+ * Substitui std::vector onde o tamanho máximo é conhecido: os elementos
+ * ficam no próprio objeto, então inserir e limpar nunca alocam. Os
+ * iteradores são ponteiros e funcionam com range-for e <algorithm>.
+ *
+ * @tparam T Tipo dos elementos.
+ * @tparam N Capacidade.
+ */
+template <typename T, size_t N>
+struct FixedList
+{
+    T items[N];
+    uint8_t count;
+
+    static_assert(N <= UINT8_MAX, "FixedList comporta no máximo 255 elementos");
+
+    /**
+     * @brief Acrescenta um elemento
+     *
+     * @return false se a lista estiver cheia; o elemento é descartado.
+     */
+    bool push_back(const T &value)
+    {
+        if (count >= N)
+            return false;
+        items[count++] = value;
+        return true;
+    }
+
+    void clear() { count = 0; }
+    size_t size() const { return count; }
+    bool empty() const { return count == 0; }
+    bool full() const { return count >= N; }
+    static constexpr size_t capacity() { return N; }
+
+    T *begin() { return items; }
+    T *end() { return items + count; }
+    const T *begin() const { return items; }
+    const T *end() const { return items + count; }
+    T &back() { return items[count - 1]; }
+    T &operator[](size_t i) { return items[i]; }
+    const T &operator[](size_t i) const { return items[i]; }
+};
+
+#endif // FIXED_LIST_H
@@ -0,0 +1,119 @@
+#include "LocalTimeCache.h"
+#include <algorithm>
+
+LocalTimeCache::LocalTimeCache(const TimeZone &zone) : _zone(zone)
+{
+    _day.write(invalid(zone));
+}
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Troca o fuso e descarta o dia em cache
+ */
+void LocalTimeCache::setZone(const TimeZone &zone)
+{
+    std::lock_guard<std::mutex> lock(_writer);
+    _zone = zone;
+    _day.write(invalid(zone));
+}
+
+TimeZone LocalTimeCache::zone()
+{
+    return _day.read().zone;
+}
+
+/**
+ * @brief Converte utc para a hora local decomposta, como localtime_r()
+ *
+ * @param utc Segundos desde 1970 (UTC).
+ */
+void LocalTimeCache::toLocal(int64_t utc, struct tm &out)
+{
+    Day day = lookup(utc);
+    int32_t second = (int32_t)(utc + day.offset - day.midnight);
+    out.tm_year = day.year;
+    out.tm_mon = day.month;
+    out.tm_mday = day.mday;
+    out.tm_hour = second / 3600;
+    out.tm_min = (second / 60) % 60;
+    out.tm_sec = second % 60;
+    out.tm_wday = day.wday;
+    out.tm_yday = day.yday;
+    out.tm_isdst = day.dst ? 1 : 0;
+}
+
+/**
+ * @brief Offset local (segundos a leste de UTC) em vigor no instante utc
+ *
+ * @param dst Se não nulo, recebe se o horário de verão está ativo.
+ */
+int32_t LocalTimeCache::offsetAt(int64_t utc, bool *dst)
+{
+    Day day = lookup(utc);
+    if (dst)
+        *dst = day.dst;
+    return day.offset;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+LocalTimeCache::Day LocalTimeCache::lookup(int64_t utc)
+{
+    Day day;
+    _day.read(day);
+    if (utc < day.fromUtc || utc >= day.untilUtc)
+        day = refresh(day.zone, utc);
+    return day;
+}
+
+/**
+ * @brief Calcula o dia local de utc e o publica, se ninguém estiver
+ *        publicando e o fuso não tiver mudado nesse meio-tempo
+ */
+LocalTimeCache::Day LocalTimeCache::refresh(const TimeZone &zone, int64_t utc)
+{
+    TZSpan span = zone.span(utc);
+    int64_t local = utc + span.offset;
+    struct tm date;
+    TimeZone::breakDown(local, date);
+    int64_t midnight = local - (date.tm_hour * 3600 + date.tm_min * 60 + date.tm_sec);
+
+    Day day;
+    day.fromUtc = std::max(span.fromUtc, midnight - span.offset);
+    day.untilUtc = std::min(span.untilUtc, midnight + 86400 - span.offset);
+    day.midnight = midnight;
+    day.offset = span.offset;
+    day.zone = zone;
+    day.dst = span.dst;
+    day.year = (int16_t)date.tm_year;
+    day.month = (uint8_t)date.tm_mon;
+    day.mday = (uint8_t)date.tm_mday;
+    day.wday = (uint8_t)date.tm_wday;
+    day.yday = (uint16_t)date.tm_yday;
+
+    std::unique_lock<std::mutex> lock(_writer, std::try_to_lock);
+    if (lock.owns_lock() && _zone == zone)
+        _day.write(day);
+    return day;
+}
+
+/**
+ * @brief Dia vazio: qualquer instante força o recálculo
+ */
+LocalTimeCache::Day LocalTimeCache::invalid(const TimeZone &zone)
+{
+    Day day = {};
+    day.fromUtc = INT64_MAX;
+    day.untilUtc = INT64_MIN;
+    day.zone = zone;
+    return day;
+}
@@ -0,0 +1,70 @@
+#ifndef LOCAL_TIME_CACHE_H
+#define LOCAL_TIME_CACHE_H
+
+#include "SeqLock.h"
+#include "TimeZone.h"
+#include <cstdint>
+#include <ctime>
+#include <mutex>
+
+/**
+ * @brief Conversão UTC → local com o dia local corrente em cache
+ *
+ * @details
+ *     Guarda a data decomposta do dia local do último instante convertido
+ *     e o intervalo UTC em que ela vale: o dia local, cortado na próxima
+ *     transição do fuso (TimeZone::span()). Dentro dele, converter é uma
+ *     subtração e três divisões por constantes; fora, o dia é recalculado
+ *     e publicado para as próximas chamadas.
+ *
+ *     Thread-safe: o dia é publicado por seqlock, e a leitura não bloqueia.
+ *     Se duas tarefas recalcularem ao mesmo tempo, só uma publica; a outra
+ *     usa o próprio resultado.
+ *
+ *     Dá sempre o mesmo resultado que TimeZone::toLocal() e
+ *     TimeZone::offsetAt(), inclusive nas transições de horário de verão.
+ *
+ * Exemplo de uso:
+ * LocalTimeCache local(NTPSync::getStatus().zone);
+ * struct tm t;
+ * local.toLocal(time(nullptr), t); // Agrupa amostras por t.tm_hour, t.tm_yday...
+ */
+class LocalTimeCache
+{
+public:
+    explicit LocalTimeCache(const TimeZone &zone = TimeZone());
+
+    LocalTimeCache(const LocalTimeCache &) = delete;
+    LocalTimeCache &operator=(const LocalTimeCache &) = delete;
+
+    void setZone(const TimeZone &zone);
+    TimeZone zone();
+    void toLocal(int64_t utc, struct tm &out);
+    int32_t offsetAt(int64_t utc, bool *dst = nullptr);
+
+private:
+    struct Day
+    {
+        int64_t fromUtc;  // Validade do dia: [fromUtc, untilUtc)
+        int64_t untilUtc;
+        int64_t midnight; // Meia-noite do dia, em segundos locais desde 1970
+        int32_t offset;
+        TimeZone zone;
+        bool dst;
+        int16_t year; // Como tm_year: anos desde 1900
+        uint8_t month;
+        uint8_t mday;
+        uint8_t wday;
+        uint16_t yday;
+    };
+
+    std::mutex _writer; // Serializa as escritas em _day
+    TimeZone _zone;     // Fuso atual, protegido por _writer
+    SeqLock<Day> _day;
+
+    Day lookup(int64_t utc);
+    Day refresh(const TimeZone &zone, int64_t utc);
+    static Day invalid(const TimeZone &zone);
+};
+
+#endif // LOCAL_TIME_CACHE_H
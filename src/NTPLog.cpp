@@ -0,0 +1,355 @@
+#include "NTPLog.h"
+#include <cstdio>
+#include <cstring>
+
+NTPLog::Cell NTPLog::_cells[NTP_LOG_RING_SIZE];
+std::atomic<uint32_t> NTPLog::_head{0};
+std::atomic<uint32_t> NTPLog::_tail{0};
+std::atomic<uint32_t> NTPLog::_dropped{0};
+std::atomic<uint32_t> NTPLog::_droppedTotal{0};
+std::atomic<bool> NTPLog::_enabled{true};
+std::atomic<NTPClock *> NTPLog::_clock{nullptr};
+NTPLogSink NTPLog::_sink = nullptr;
+void *NTPLog::_sinkArg = nullptr;
+
+static const char LEVEL_CHARS[] = "?EWID";
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Liga ou desliga o registro em tempo de execução
+ *
+ * Desligado, cada ponto de log custa a leitura de um booleano.
+ */
+void NTPLog::setEnabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Relógio usado no carimbo de tempo das entradas
+ */
+void NTPLog::setClock(NTPClock *clock)
+{
+    _clock.store(clock, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Define para onde flush() envia as linhas formatadas
+ *
+ * Sem destino, as entradas ficam no buffer até serem lidas por read().
+ * Deve ser chamada antes de NTPSync::begin().
+ *
+ * @param sink Ex.: [](const char *line, void *) { Serial.println(line); }
+ * @param arg Repassado ao sink.
+ */
+void NTPLog::setSink(NTPLogSink sink, void *arg)
+{
+    _sinkArg = arg;
+    _sink = sink;
+}
+
+/**
+ * @brief Retira e formata a entrada mais antiga
+ *
+ * Se mensagens foram descartadas com o buffer cheio, a primeira linha
+ * informa quantas.
+ *
+ * @param line Recebe a linha, sem '\n'.
+ * @return false se o buffer estiver vazio.
+ */
+bool NTPLog::read(char *line, size_t len)
+{
+    uint32_t dropped = _dropped.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+    {
+        snprintf(line, len, "[NTP Sync] %lu mensagens descartadas", (unsigned long)dropped);
+        return true;
+    }
+
+    NTPLogEntry entry;
+    if (!pop(entry))
+        return false;
+    format(entry, line, len);
+    return true;
+}
+
+/**
+ * @brief Formata todas as entradas pendentes e as entrega ao sink
+ *
+ * Chamada pela tarefa de sincronização quando ociosa; pode ser chamada
+ * por outra tarefa de prioridade baixa.
+ *
+ * @return Linhas entregues; 0 se não houver sink.
+ */
+size_t NTPLog::flush()
+{
+    NTPLogSink sink = _sink;
+    if (sink == nullptr)
+        return 0;
+
+    char line[NTP_LOG_LINE_LEN];
+    size_t count = 0;
+    while (read(line, sizeof(line)))
+    {
+        sink(line, _sinkArg);
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Total de mensagens descartadas com o buffer cheio desde o boot
+ */
+uint32_t NTPLog::dropped()
+{
+    return _droppedTotal.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Formata uma entrada como "[NTP Sync] s.mmm N mensagem"
+ *
+ * @details
+ *     Interpreta o formato como printf, trocando os modificadores de
+ *     tamanho pelos do tipo realmente capturado: "%lu" com um int64_t ou
+ *     "%d" com um size_t produzem o valor correto em qualquer plataforma.
+ *     Argumentos NTPAddress são formatados por %s.
+ *
+ * @return Tamanho da linha, como snprintf().
+ */
+size_t NTPLog::format(const NTPLogEntry &entry, char *line, size_t len)
+{
+    size_t pos = 0;
+    auto append = [&](int n)
+    {
+        if (n > 0)
+            pos += (size_t)n;
+    };
+    auto out = [&]() { return pos < len ? line + pos : nullptr; };
+    auto room = [&]() { return pos < len ? len - pos : 0; };
+
+    if (len > 0)
+        line[0] = '\0';
+    uint8_t level = (uint8_t)entry.level < sizeof(LEVEL_CHARS) - 1 ? (uint8_t)entry.level : 0;
+    append(snprintf(out(), room(), "[NTP Sync] %lu.%03lu %c ", (unsigned long)(entry.ms / 1000),
+                    (unsigned long)(entry.ms % 1000), LEVEL_CHARS[level]));
+
+    const char *p = entry.format;
+    uint8_t arg = 0;
+    while (*p != '\0')
+    {
+        if (*p != '%' || p[1] == '%')
+        {
+            if (room() > 1)
+            {
+                line[pos] = *p;
+                line[pos + 1] = '\0';
+            }
+            pos++;
+            p += (*p == '%') ? 2 : 1;
+            continue;
+        }
+
+        // Flags, largura e precisão são mantidos; o tamanho vem do tipo
+        char spec[16] = "%";
+        size_t n = 1;
+        p++;
+        while (*p != '\0' && strchr("-+ #0123456789.", *p) != nullptr && n < sizeof(spec) - 4)
+        {
+            spec[n++] = *p++;
+        }
+        while (*p != '\0' && strchr("hlLqjzt", *p) != nullptr)
+        {
+            p++;
+        }
+        char conv = *p;
+        if (conv == '\0' || arg >= entry.argc)
+            break;
+        p++;
+
+        NTPLogArg::Kind kind = entry.kinds[arg];
+        int64_t value = kind == NTPLogArg::Double ? (int64_t)entry.args[arg].d : entry.args[arg].i;
+        if (conv == 's' && kind == NTPLogArg::String)
+        {
+            spec[n++] = 's';
+            append(snprintf(out(), room(), spec, entry.strings + entry.args[arg].offset));
+        }
+        else if (conv == 's' && kind == NTPLogArg::Address)
+        {
+            NTPAddress address;
+            memcpy(&address, entry.strings + entry.args[arg].offset, sizeof(address));
+            char text[NTP_ADDRESS_TEXT_LEN];
+            ntpFormatAddress(address, text, sizeof(text));
+            spec[n++] = 's';
+            append(snprintf(out(), room(), spec, text));
+        }
+        else if (strchr("fFeEgGaA", conv) != nullptr)
+        {
+            double d = kind == NTPLogArg::Double ? entry.args[arg].d
+                       : kind == NTPLogArg::Uint ? (double)entry.args[arg].u
+                                                 : (double)value;
+            spec[n++] = conv;
+            append(snprintf(out(), room(), spec, d));
+        }
+        else if (strchr("ouxX", conv) != nullptr || (conv != 'c' && kind == NTPLogArg::Uint))
+        {
+            spec[n++] = 'l';
+            spec[n++] = 'l';
+            spec[n++] = strchr("ouxX", conv) != nullptr ? conv : 'u';
+            append(snprintf(out(), room(), spec, (unsigned long long)entry.args[arg].u));
+        }
+        else
+        {
+            if (conv == 'c')
+            {
+                spec[n++] = 'c';
+                append(snprintf(out(), room(), spec, (int)value));
+            }
+            else
+            {
+                spec[n++] = 'l';
+                spec[n++] = 'l';
+                spec[n++] = 'd';
+                append(snprintf(out(), room(), spec, (long long)value));
+            }
+        }
+        arg++;
+    }
+    return pos;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Grava uma entrada no buffer sem bloquear.
+ *
+ * @details
+ *     A célula da posição pos está livre quando seq + índice == pos e
+ *     contém uma entrada quando seq + índice == pos + 1. Guardar seq
+ *     relativo ao índice permite que o buffer comece zerado, sem
+ *     inicialização dinâmica.
+ */
+void NTPLog::push(NTPLogLevel level, const char *format, const NTPLogArg *args, uint8_t argc)
+{
+    NTPClock *clock = _clock.load(std::memory_order_relaxed);
+    uint32_t pos = _head.load(std::memory_order_relaxed);
+    Cell *cell;
+    uint32_t index;
+    while (true)
+    {
+        index = pos & (NTP_LOG_RING_SIZE - 1);
+        cell = &_cells[index];
+        int32_t diff = (int32_t)(cell->seq.load(std::memory_order_acquire) + index - pos);
+        if (diff == 0)
+        {
+            if (_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            // Cheio: descarta em vez de esperar pelo consumidor
+            _dropped.fetch_add(1, std::memory_order_relaxed);
+            _droppedTotal.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        else
+        {
+            pos = _head.load(std::memory_order_relaxed);
+        }
+    }
+
+    NTPLogEntry &entry = cell->entry;
+    entry.format = format;
+    entry.ms = clock != nullptr ? clock->millis() : 0;
+    entry.level = level;
+    entry.argc = argc;
+    // O último byte é um "" comum, nunca alocado: destino dos argumentos
+    // que não couberem
+    constexpr uint8_t empty = NTP_LOG_STRING_BYTES - 1;
+    entry.strings[empty] = '\0';
+    uint8_t used = 0;
+    for (uint8_t i = 0; i < argc; i++)
+    {
+        entry.kinds[i] = args[i].kind;
+        switch (args[i].kind)
+        {
+        case NTPLogArg::String:
+        {
+            // Strings longas são truncadas; sem espaço, vira ""
+            size_t room = empty - used;
+            if (room > 0)
+            {
+                size_t n = strnlen(args[i].s, room - 1);
+                entry.args[i].offset = used;
+                memcpy(entry.strings + used, args[i].s, n);
+                entry.strings[used + n] = '\0';
+                used = (uint8_t)(used + n + 1);
+            }
+            else
+            {
+                entry.args[i].offset = empty;
+            }
+            break;
+        }
+        case NTPLogArg::Address:
+            if ((size_t)(empty - used) >= sizeof(NTPAddress))
+            {
+                entry.args[i].offset = used;
+                memcpy(entry.strings + used, &args[i].a, sizeof(NTPAddress));
+                used = (uint8_t)(used + sizeof(NTPAddress));
+            }
+            else
+            {
+                // Sem espaço: formatado como ""
+                entry.kinds[i] = NTPLogArg::String;
+                entry.args[i].offset = empty;
+            }
+            break;
+        default:
+            entry.args[i].u = args[i].u;
+            break;
+        }
+    }
+    cell->seq.store(pos + 1 - index, std::memory_order_release);
+}
+
+/**
+ * @brief Retira a entrada mais antiga, sem bloquear.
+ */
+bool NTPLog::pop(NTPLogEntry &entry)
+{
+    uint32_t pos = _tail.load(std::memory_order_relaxed);
+    Cell *cell;
+    uint32_t index;
+    while (true)
+    {
+        index = pos & (NTP_LOG_RING_SIZE - 1);
+        cell = &_cells[index];
+        int32_t diff = (int32_t)(cell->seq.load(std::memory_order_acquire) + index - (pos + 1));
+        if (diff == 0)
+        {
+            if (_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (diff < 0)
+        {
+            return false; // Vazio
+        }
+        else
+        {
+            pos = _tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    entry = cell->entry;
+    cell->seq.store(pos + NTP_LOG_RING_SIZE - index, std::memory_order_release);
+    return true;
+}
@@ -0,0 +1,215 @@
+#ifndef NTP_LOG_H
+#define NTP_LOG_H
+
+#include "hal/NTPHal.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+#define NTP_LOG_LEVEL_NONE 0
+#define NTP_LOG_LEVEL_ERROR 1
+#define NTP_LOG_LEVEL_WARN 2
+#define NTP_LOG_LEVEL_INFO 3
+#define NTP_LOG_LEVEL_DEBUG 4
+
+// Nível máximo compilado; mensagens acima dele não geram código. Defina
+// no build, ex.: -DNTP_LOG_LEVEL=NTP_LOG_LEVEL_DEBUG
+#ifndef NTP_LOG_LEVEL
+#define NTP_LOG_LEVEL NTP_LOG_LEVEL_INFO
+#endif
+
+// Entradas do buffer circular (potência de 2)
+#ifndef NTP_LOG_RING_SIZE
+#define NTP_LOG_RING_SIZE 32
+#endif
+
+constexpr uint8_t NTP_LOG_MAX_ARGS = 4;
+constexpr uint8_t NTP_LOG_STRING_BYTES = 64; // Espaço para argumentos %s e endereços de uma entrada
+constexpr size_t NTP_LOG_LINE_LEN = 160;     // Linha entregue ao NTPLogSink
+
+static_assert((NTP_LOG_RING_SIZE & (NTP_LOG_RING_SIZE - 1)) == 0, "NTP_LOG_RING_SIZE deve ser potência de 2");
+
+enum class NTPLogLevel : uint8_t
+{
+    Error = NTP_LOG_LEVEL_ERROR,
+    Warn = NTP_LOG_LEVEL_WARN,
+    Info = NTP_LOG_LEVEL_INFO,
+    Debug = NTP_LOG_LEVEL_DEBUG
+};
+
+/**
+ * @brief Argumento de log capturado sem formatação
+ *
+ * Strings são copiadas para a entrada no momento do registro; os demais
+ * tipos guardam apenas o valor.
+ */
+struct NTPLogArg
+{
+    enum Kind : uint8_t
+    {
+        None,
+        Int,
+        Uint,
+        Double,
+        String,
+        Address // Formatado como %s ("ip:porta")
+    };
+
+    Kind kind;
+    union
+    {
+        int64_t i;
+        uint64_t u;
+        double d;
+        const char *s;
+        NTPAddress a;
+    };
+
+    NTPLogArg() : kind(None), u(0) {}
+    NTPLogArg(bool v) : kind(Uint), u(v) {}
+    NTPLogArg(char v) : kind(Int), i(v) {}
+    NTPLogArg(signed char v) : kind(Int), i(v) {}
+    NTPLogArg(short v) : kind(Int), i(v) {}
+    NTPLogArg(int v) : kind(Int), i(v) {}
+    NTPLogArg(long v) : kind(Int), i(v) {}
+    NTPLogArg(long long v) : kind(Int), i(v) {}
+    NTPLogArg(unsigned char v) : kind(Uint), u(v) {}
+    NTPLogArg(unsigned short v) : kind(Uint), u(v) {}
+    NTPLogArg(unsigned int v) : kind(Uint), u(v) {}
+    NTPLogArg(unsigned long v) : kind(Uint), u(v) {}
+    NTPLogArg(unsigned long long v) : kind(Uint), u(v) {}
+    NTPLogArg(double v) : kind(Double), d(v) {}
+    NTPLogArg(const char *v) : kind(String), s(v != nullptr ? v : "") {}
+    NTPLogArg(const std::string &v) : kind(String), s(v.c_str()) {}
+    NTPLogArg(const NTPAddress &v) : kind(Address), a(v) {}
+};
+
+/**
+ * @brief Mensagem registrada, ainda não formatada
+ *
+ * format aponta para o literal da mensagem, que serve de identificador:
+ * fica na flash e não precisa de tabela de IDs. Strings e endereços
+ * ficam em strings, para que os argumentos numéricos ocupem 8 bytes.
+ */
+struct NTPLogEntry
+{
+    const char *format;
+    uint32_t ms; // NTPClock::millis() no registro
+    NTPLogLevel level;
+    uint8_t argc;
+    NTPLogArg::Kind kinds[NTP_LOG_MAX_ARGS];
+    union
+    {
+        int64_t i;
+        uint64_t u;
+        double d;
+        uint8_t offset; // Início da string ou do NTPAddress em strings
+    } args[NTP_LOG_MAX_ARGS];
+    char strings[NTP_LOG_STRING_BYTES]; // O último byte é sempre "", comum a quem não coube
+};
+
+/**
+ * @brief Recebe uma linha formatada; chamado por NTPLog::flush()
+ */
+typedef void (*NTPLogSink)(const char *line, void *arg);
+
+/**
+ * @brief Log binário com formatação adiada
+ *
+ * @details
+ *     Nos pontos de log, NTP_LOGx() grava o ponteiro do formato e os
+ *     argumentos numa entrada de tamanho fixo do buffer circular, sem
+ *     formatar nem alocar, e nunca bloqueia: com o buffer cheio a
+ *     mensagem é descartada e contada. A formatação acontece depois, em
+ *     read() ou flush(), chamados pela tarefa de sincronização (prioridade
+ *     baixa) quando está ociosa ou por qualquer tarefa da aplicação.
+ *
+ *     O buffer é uma fila limitada de Vyukov: vários produtores e
+ *     consumidores, sem lock.
+ *
+ *     Mensagens acima de NTP_LOG_LEVEL são removidas na compilação,
+ *     inclusive a avaliação dos argumentos, que continuam sendo
+ *     verificados pelo compilador.
+ */
+class NTPLog
+{
+public:
+    template <typename... Args>
+    static void write(NTPLogLevel level, const char *format, const Args &...args)
+    {
+        static_assert(sizeof...(Args) <= NTP_LOG_MAX_ARGS, "Argumentos demais para NTPLog");
+        const NTPLogArg list[sizeof...(Args) + 1] = {NTPLogArg(args)..., NTPLogArg()};
+        push(level, format, list, sizeof...(Args));
+    }
+
+    static bool enabled() { return _enabled.load(std::memory_order_relaxed); }
+    static void setEnabled(bool enabled);
+    static void setClock(NTPClock *clock);
+    static void setSink(NTPLogSink sink, void *arg = nullptr);
+    static bool read(char *line, size_t len);
+    static size_t flush();
+    static uint32_t dropped();
+    static size_t format(const NTPLogEntry &entry, char *line, size_t len);
+
+private:
+    struct Cell
+    {
+        std::atomic<uint32_t> seq; // Relativo ao índice da célula, começa em 0
+        NTPLogEntry entry;
+    };
+
+    static Cell _cells[NTP_LOG_RING_SIZE];
+    static std::atomic<uint32_t> _head; // Próxima posição a gravar
+    static std::atomic<uint32_t> _tail; // Próxima posição a ler
+    static std::atomic<uint32_t> _dropped;
+    static std::atomic<uint32_t> _droppedTotal;
+    static std::atomic<bool> _enabled;
+    static std::atomic<NTPClock *> _clock;
+    static NTPLogSink _sink;
+    static void *_sinkArg;
+
+    static void push(NTPLogLevel level, const char *format, const NTPLogArg *args, uint8_t argc);
+    static bool pop(NTPLogEntry &entry);
+};
+
+#define NTP_LOG_AT(level, ...)                 \
+    do                                         \
+    {                                          \
+        if (NTPLog::enabled())                 \
+            NTPLog::write(level, __VA_ARGS__); \
+    } while (0)
+
+// Nível desativado: código morto, removido pelo compilador
+#define NTP_LOG_OFF(level, ...)                \
+    do                                         \
+    {                                          \
+        if (false)                             \
+            NTPLog::write(level, __VA_ARGS__); \
+    } while (0)
+
+#if NTP_LOG_LEVEL >= NTP_LOG_LEVEL_ERROR
+#define NTP_LOGE(...) NTP_LOG_AT(NTPLogLevel::Error, __VA_ARGS__)
+#else
+#define NTP_LOGE(...) NTP_LOG_OFF(NTPLogLevel::Error, __VA_ARGS__)
+#endif
+
+#if NTP_LOG_LEVEL >= NTP_LOG_LEVEL_WARN
+#define NTP_LOGW(...) NTP_LOG_AT(NTPLogLevel::Warn, __VA_ARGS__)
+#else
+#define NTP_LOGW(...) NTP_LOG_OFF(NTPLogLevel::Warn, __VA_ARGS__)
+#endif
+
+#if NTP_LOG_LEVEL >= NTP_LOG_LEVEL_INFO
+#define NTP_LOGI(...) NTP_LOG_AT(NTPLogLevel::Info, __VA_ARGS__)
+#else
+#define NTP_LOGI(...) NTP_LOG_OFF(NTPLogLevel::Info, __VA_ARGS__)
+#endif
+
+#if NTP_LOG_LEVEL >= NTP_LOG_LEVEL_DEBUG
+#define NTP_LOGD(...) NTP_LOG_AT(NTPLogLevel::Debug, __VA_ARGS__)
+#else
+#define NTP_LOGD(...) NTP_LOG_OFF(NTPLogLevel::Debug, __VA_ARGS__)
+#endif
+
+#endif // NTP_LOG_H
@@ -0,0 +1,213 @@
+#include "NTPMetrics.h"
+#include <cstdarg>
+#include <cstdio>
+
+/**
+ * @brief Acumula texto formatado num buffer fixo, sem alocação
+ *
+ * Como snprintf(), continua contando o tamanho necessário depois que o
+ * buffer enche.
+ */
+struct TextWriter
+{
+    char *buf;
+    size_t len;
+    size_t pos;
+
+    void printf(const char *format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        va_list args;
+        va_start(args, format);
+        int n = vsnprintf(pos < len ? buf + pos : nullptr, pos < len ? len - pos : 0, format, args);
+        va_end(args);
+        if (n > 0)
+            pos += (size_t)n;
+    }
+
+    // Microssegundos como segundos decimais, sem ponto flutuante
+    void seconds(uint64_t us)
+    {
+        printf("%llu.%06llu", (unsigned long long)(us / 1000000), (unsigned long long)(us % 1000000));
+    }
+};
+
+// ----------------------------------------------------
+//
+//               Prometheus
+//
+// ----------------------------------------------------
+
+static void promHistogram(TextWriter &w, const char *name, const char *labels, const NTPHistogram &h)
+{
+    const char *sep = labels[0] != '\0' ? "," : "";
+    uint32_t cumulative = 0;
+    for (uint8_t i = 0; i < NTP_HISTOGRAM_BUCKETS - 1; i++)
+    {
+        cumulative += h.buckets[i];
+        w.printf("%s_bucket{%s%sle=\"", name, labels, sep);
+        w.seconds(NTPHistogram::upperBoundUs(i));
+        w.printf("\"} %lu\n", (unsigned long)cumulative);
+    }
+    w.printf("%s_bucket{%s%sle=\"+Inf\"} %lu\n", name, labels, sep, (unsigned long)h.count);
+    // Sem rótulos, _sum e _count não levam chaves
+    const char *open = labels[0] != '\0' ? "{" : "";
+    const char *close = labels[0] != '\0' ? "}" : "";
+    w.printf("%s_sum%s%s%s ", name, open, labels, close);
+    w.seconds(h.sumUs);
+    w.printf("\n%s_count%s%s%s %lu\n", name, open, labels, close, (unsigned long)h.count);
+}
+
+/**
+ * @brief Exporta as métricas no formato texto do Prometheus
+ *
+ * Tempos em segundos; contadores de servidor com o rótulo server.
+ *
+ * @return Tamanho do texto completo. Se for >= len, o texto foi truncado.
+ */
+size_t NTPMetrics::toPrometheus(char *buf, size_t len) const
+{
+    TextWriter w = {buf, len, 0};
+    if (len > 0)
+        buf[0] = '\0';
+
+    w.printf("# TYPE ntpsync_syncs_total counter\n");
+    w.printf("ntpsync_syncs_total{result=\"success\"} %lu\n", (unsigned long)syncSuccess);
+    w.printf("ntpsync_syncs_total{result=\"failed\"} %lu\n", (unsigned long)syncFailed);
+    w.printf("ntpsync_syncs_total{result=\"no_network\"} %lu\n", (unsigned long)syncNoNetwork);
+    w.printf("ntpsync_syncs_total{result=\"dns_failed\"} %lu\n", (unsigned long)syncDnsFailed);
+    w.printf("ntpsync_syncs_total{result=\"timeout\"} %lu\n", (unsigned long)syncTimeout);
+    w.printf("ntpsync_syncs_total{result=\"cancelled\"} %lu\n", (unsigned long)syncCancelled);
+    w.printf("ntpsync_syncs_total{result=\"unchanged\"} %lu\n", (unsigned long)syncUnchanged);
+
+    w.printf("# TYPE ntpsync_sync_duration_seconds histogram\n");
+    promHistogram(w, "ntpsync_sync_duration_seconds", "", syncDuration);
+
+    w.printf("# TYPE ntpsync_dns_lookups_total counter\n");
+    w.printf("ntpsync_dns_lookups_total %lu\n", (unsigned long)dnsLookups);
+    w.printf("# TYPE ntpsync_dns_failures_total counter\n");
+    w.printf("ntpsync_dns_failures_total %lu\n", (unsigned long)dnsFailures);
+    w.printf("# TYPE ntpsync_dns_latency_seconds histogram\n");
+    promHistogram(w, "ntpsync_dns_latency_seconds", "", dnsLatency);
+
+    w.printf("# TYPE ntpsync_offset_seconds gauge\n");
+    w.printf("ntpsync_offset_seconds %s", offsetUs < 0 ? "-" : "");
+    w.seconds((uint64_t)(offsetUs < 0 ? -offsetUs : offsetUs));
+    w.printf("\n# TYPE ntpsync_jitter_seconds gauge\nntpsync_jitter_seconds ");
+    w.seconds(jitterUs);
+    w.printf("\n# TYPE ntpsync_last_sync_age_seconds gauge\nntpsync_last_sync_age_seconds ");
+    if (everSynced)
+        w.seconds((uint64_t)sinceLastSyncMs * 1000);
+    else
+        w.printf("+Inf");
+    w.printf("\n# TYPE ntpsync_stack_high_water_bytes gauge\n");
+    w.printf("ntpsync_stack_high_water_bytes %lu\n", (unsigned long)stackHighWater);
+    w.printf("# TYPE ntpsync_serve_packets_total counter\n");
+    w.printf("ntpsync_serve_packets_total{result=\"request\"} %lu\n", (unsigned long)serveRequests);
+    w.printf("ntpsync_serve_packets_total{result=\"reply\"} %lu\n", (unsigned long)serveReplies);
+    w.printf("ntpsync_serve_packets_total{result=\"dropped\"} %lu\n", (unsigned long)serveDropped);
+
+    static const char *const counters[] = {"requests", "replies", "timeouts", "rejected", "kod",
+                                           "throttled"};
+    for (uint8_t c = 0; c < sizeof(counters) / sizeof(counters[0]); c++)
+    {
+        w.printf("# TYPE ntpsync_server_%s_total counter\n", counters[c]);
+        for (uint8_t i = 0; i < serverCount; i++)
+        {
+            const NTPServerMetrics &s = servers[i];
+            const uint32_t values[] = {s.requests, s.replies, s.timeouts, s.rejected, s.kod,
+                                       s.throttled};
+            w.printf("ntpsync_server_%s_total{server=\"%s\"} %lu\n", counters[c], s.hostname,
+                     (unsigned long)values[c]);
+        }
+    }
+    w.printf("# TYPE ntpsync_server_stratum gauge\n");
+    for (uint8_t i = 0; i < serverCount; i++)
+    {
+        w.printf("ntpsync_server_stratum{server=\"%s\"} %u\n", servers[i].hostname, servers[i].stratum);
+    }
+
+    char labels[NTP_METRICS_HOSTNAME_LEN + 16];
+    w.printf("# TYPE ntpsync_server_rtt_seconds histogram\n");
+    for (uint8_t i = 0; i < serverCount; i++)
+    {
+        snprintf(labels, sizeof(labels), "server=\"%s\"", servers[i].hostname);
+        promHistogram(w, "ntpsync_server_rtt_seconds", labels, servers[i].rtt);
+    }
+    w.printf("# TYPE ntpsync_server_offset_abs_seconds histogram\n");
+    for (uint8_t i = 0; i < serverCount; i++)
+    {
+        snprintf(labels, sizeof(labels), "server=\"%s\"", servers[i].hostname);
+        promHistogram(w, "ntpsync_server_offset_abs_seconds", labels, servers[i].offset);
+    }
+    return w.pos;
+}
+
+// ----------------------------------------------------
+//
+//               JSON
+//
+// ----------------------------------------------------
+
+static void jsonHistogram(TextWriter &w, const char *name, const NTPHistogram &h)
+{
+    w.printf("\"%s\":{\"count\":%lu,\"sum_us\":%llu,\"buckets\":[", name, (unsigned long)h.count,
+             (unsigned long long)h.sumUs);
+    for (uint8_t i = 0; i < NTP_HISTOGRAM_BUCKETS; i++)
+    {
+        w.printf("%s%lu", i > 0 ? "," : "", (unsigned long)h.buckets[i]);
+    }
+    w.printf("]}");
+}
+
+/**
+ * @brief Exporta as métricas como um objeto JSON
+ *
+ * Histogramas trazem as contagens de cada bucket (não cumulativas); o
+ * limite do bucket i é NTP_HISTOGRAM_BASE_US * 2^i e o último não tem
+ * limite.
+ *
+ * @return Tamanho do texto completo. Se for >= len, o texto foi truncado.
+ */
+size_t NTPMetrics::toJson(char *buf, size_t len) const
+{
+    TextWriter w = {buf, len, 0};
+    if (len > 0)
+        buf[0] = '\0';
+
+    w.printf("{\"syncs\":{\"success\":%lu,\"failed\":%lu,\"no_network\":%lu,\"dns_failed\":%lu,"
+             "\"timeout\":%lu,\"cancelled\":%lu,\"unchanged\":%lu},",
+             (unsigned long)syncSuccess, (unsigned long)syncFailed, (unsigned long)syncNoNetwork,
+             (unsigned long)syncDnsFailed, (unsigned long)syncTimeout, (unsigned long)syncCancelled,
+             (unsigned long)syncUnchanged);
+    jsonHistogram(w, "sync_duration_us", syncDuration);
+    w.printf(",\"dns\":{\"lookups\":%lu,\"failures\":%lu,", (unsigned long)dnsLookups,
+             (unsigned long)dnsFailures);
+    jsonHistogram(w, "latency_us", dnsLatency);
+    w.printf("},\"offset_us\":%lld,\"jitter_us\":%lu,", (long long)offsetUs, (unsigned long)jitterUs);
+    if (everSynced)
+        w.printf("\"since_last_sync_ms\":%lu,", (unsigned long)sinceLastSyncMs);
+    else
+        w.printf("\"since_last_sync_ms\":null,");
+    w.printf("\"stack_high_water\":%lu,\"serve\":{\"requests\":%lu,\"replies\":%lu,\"dropped\":%lu},"
+             "\"base_us\":%lu,\"servers\":[",
+             (unsigned long)stackHighWater, (unsigned long)serveRequests, (unsigned long)serveReplies,
+             (unsigned long)serveDropped, (unsigned long)NTP_HISTOGRAM_BASE_US);
+
+    for (uint8_t i = 0; i < serverCount; i++)
+    {
+        const NTPServerMetrics &s = servers[i];
+        w.printf("%s{\"host\":\"%s\",\"requests\":%lu,\"replies\":%lu,\"timeouts\":%lu,"
+                 "\"rejected\":%lu,\"kod\":%lu,\"throttled\":%lu,\"offset_us\":%lld,\"jitter_us\":%lu,"
+                 "\"stratum\":%u,",
+                 i > 0 ? "," : "", s.hostname, (unsigned long)s.requests, (unsigned long)s.replies,
+                 (unsigned long)s.timeouts, (unsigned long)s.rejected, (unsigned long)s.kod,
+                 (unsigned long)s.throttled,
+                 (long long)s.offsetUs, (unsigned long)s.jitterUs, s.stratum);
+        jsonHistogram(w, "rtt_us", s.rtt);
+        w.printf(",");
+        jsonHistogram(w, "offset_abs_us", s.offset);
+        w.printf("}");
+    }
+    w.printf("]}");
+    return w.pos;
+}
@@ -0,0 +1,95 @@
+#ifndef NTP_METRICS_H
+#define NTP_METRICS_H
+
+#include <cstddef>
+#include <cstdint>
+
+constexpr uint8_t NTP_HISTOGRAM_BUCKETS = 16;      // 15 limites finitos + infinito
+constexpr uint32_t NTP_HISTOGRAM_BASE_US = 128;    // Limite do primeiro bucket
+constexpr uint8_t NTP_METRICS_MAX_SERVERS = 8;
+constexpr uint8_t NTP_METRICS_HOSTNAME_LEN = 40;
+
+/**
+ * @brief Histograma com buckets em potências de 2
+ *
+ * O bucket i conta valores até NTP_HISTOGRAM_BASE_US * 2^i (128 µs a
+ * ~2,1 s) e o último, os maiores. Registrar é um laço de deslocamentos,
+ * sem divisão nem ponto flutuante.
+ */
+struct NTPHistogram
+{
+    uint32_t buckets[NTP_HISTOGRAM_BUCKETS];
+    uint32_t count;
+    uint64_t sumUs;
+
+    void record(uint64_t valueUs)
+    {
+        uint8_t i = 0;
+        for (uint64_t bound = NTP_HISTOGRAM_BASE_US; i < NTP_HISTOGRAM_BUCKETS - 1 && valueUs > bound; bound <<= 1)
+        {
+            i++;
+        }
+        buckets[i]++;
+        count++;
+        sumUs += valueUs;
+    }
+
+    static uint64_t upperBoundUs(uint8_t bucket) { return (uint64_t)NTP_HISTOGRAM_BASE_US << bucket; }
+};
+
+/**
+ * @brief Contadores e histogramas de um servidor configurado
+ */
+struct NTPServerMetrics
+{
+    char hostname[NTP_METRICS_HOSTNAME_LEN];
+    uint32_t requests;
+    uint32_t replies;
+    uint32_t timeouts; // Pedidos sem resposta dentro do timeout de pacote
+    uint32_t rejected; // Respostas descartadas por validateReply()
+    uint32_t kod;      // Kiss-o'-Death (stratum 0)
+    uint32_t throttled; // Pedidos suprimidos pelo limite de taxa
+    int64_t offsetUs;  // Saída atual do filtro de relógio
+    uint32_t jitterUs;
+    uint8_t stratum;
+    NTPHistogram rtt;    // Atraso de ida e volta de cada resposta
+    NTPHistogram offset; // |offset| de cada resposta
+};
+
+/**
+ * @brief Snapshot das métricas de saúde da sincronização
+ *
+ * Contadores são cumulativos desde o boot. sinceLastSyncMs,
+ * stackHighWater e os contadores serve* são preenchidos no momento do
+ * snapshot.
+ */
+struct NTPMetrics
+{
+    uint32_t syncSuccess;
+    uint32_t syncFailed;
+    uint32_t syncNoNetwork;
+    uint32_t syncDnsFailed;
+    uint32_t syncTimeout;
+    uint32_t syncCancelled;
+    uint32_t syncUnchanged; // Respostas sem amostra nova: relógio mantido
+    NTPHistogram syncDuration; // Do início ao fim de cada sincronização bem-sucedida
+    uint32_t dnsLookups;
+    uint32_t dnsFailures;
+    NTPHistogram dnsLatency;
+    int64_t offsetUs;          // Último offset aplicado
+    uint32_t jitterUs;         // Jitter do sistema
+    bool everSynced;
+    uint32_t lastSyncMs;       // millis() da última sincronização bem-sucedida
+    uint32_t sinceLastSyncMs;  // Tempo desde a última sincronização bem-sucedida
+    uint32_t stackHighWater;   // Menor folga de pilha da tarefa, em bytes (0 = desconhecida)
+    uint32_t serveRequests;    // Modo servidor: pedidos recebidos
+    uint32_t serveReplies;     // Modo servidor: respostas enviadas
+    uint32_t serveDropped;     // Modo servidor: pacotes que não eram pedidos válidos
+    uint8_t serverCount;
+    NTPServerMetrics servers[NTP_METRICS_MAX_SERVERS];
+
+    size_t toPrometheus(char *buf, size_t len) const;
+    size_t toJson(char *buf, size_t len) const;
+};
+
+#endif // NTP_METRICS_H
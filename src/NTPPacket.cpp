@@ -0,0 +1,208 @@
+#include "NTPPacket.h"
+
+// ----------------------------------------------------
+//
+//               Codificação big-endian
+//
+// ----------------------------------------------------
+
+static inline void putU32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)(v >> 24);
+    p[1] = (uint8_t)(v >> 16);
+    p[2] = (uint8_t)(v >> 8);
+    p[3] = (uint8_t)v;
+}
+
+static inline uint32_t getU32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void putU64(uint8_t *p, uint64_t v)
+{
+    putU32(p, (uint32_t)(v >> 32));
+    putU32(p + 4, (uint32_t)v);
+}
+
+static inline uint64_t getU64(const uint8_t *p)
+{
+    return ((uint64_t)getU32(p) << 32) | getU32(p + 4);
+}
+
+// ----------------------------------------------------
+//
+//               NTPPacket
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Monta um pedido de cliente SNTPv4
+ *
+ * @param transmitTs Timestamp t1 que o servidor devolverá no campo origin.
+ */
+NTPPacket NTPPacket::request(uint64_t transmitTs)
+{
+    NTPPacket packet = {};
+    packet.leap = NTP_LEAP_UNSYNC;
+    packet.version = NTP_VERSION;
+    packet.mode = NTP_MODE_CLIENT;
+    packet.transmitTs = transmitTs;
+    return packet;
+}
+
+void NTPPacket::encode(uint8_t *buf) const
+{
+    buf[0] = (uint8_t)(((leap & 0x03) << 6) | ((version & 0x07) << 3) | (mode & 0x07));
+    buf[1] = stratum;
+    buf[2] = (uint8_t)poll;
+    buf[3] = (uint8_t)precision;
+    putU32(buf + 4, rootDelay);
+    putU32(buf + 8, rootDispersion);
+    putU32(buf + 12, referenceId);
+    putU64(buf + 16, referenceTs);
+    putU64(buf + 24, originTs);
+    putU64(buf + 32, receiveTs);
+    putU64(buf + 40, transmitTs);
+}
+
+/**
+ * @brief Grava só o transmit timestamp de um pacote já codificado
+ *
+ * Permite codificar um lote de respostas e carimbar t3 em todas logo
+ * antes do envio.
+ */
+void NTPPacket::setTransmitTs(uint8_t *buf, uint64_t transmitTs)
+{
+    putU64(buf + 40, transmitTs);
+}
+
+/**
+ * @brief Decodifica um pacote recebido
+ *
+ * Campos de extensão e MAC (se houver) são ignorados.
+ *
+ * @return false se o buffer for menor que o cabeçalho NTP.
+ */
+bool NTPPacket::decode(const uint8_t *buf, size_t len)
+{
+    if (len < NTP_PACKET_SIZE)
+        return false;
+
+    leap = buf[0] >> 6;
+    version = (buf[0] >> 3) & 0x07;
+    mode = buf[0] & 0x07;
+    stratum = buf[1];
+    poll = (int8_t)buf[2];
+    precision = (int8_t)buf[3];
+    rootDelay = getU32(buf + 4);
+    rootDispersion = getU32(buf + 8);
+    referenceId = getU32(buf + 12);
+    referenceTs = getU64(buf + 16);
+    originTs = getU64(buf + 24);
+    receiveTs = getU64(buf + 32);
+    transmitTs = getU64(buf + 40);
+    return true;
+}
+
+// ----------------------------------------------------
+//
+//               NTPSample
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Calcula offset e atraso a partir dos quatro timestamps
+ *
+ * As diferenças são convertidas para microssegundos antes da soma, evitando
+ * overflow mesmo quando o relógio local ainda está em 1970.
+ */
+NTPSample NTPSample::fromExchange(const NTPPacket &reply, uint64_t t1, uint64_t t4)
+{
+    NTPSample sample = {};
+    sample.t1 = t1;
+    sample.t2 = reply.receiveTs;
+    sample.t3 = reply.transmitTs;
+    sample.t4 = t4;
+
+    int64_t forward = ntpDiffUs(sample.t2, sample.t1);
+    int64_t backward = ntpDiffUs(sample.t3, sample.t4);
+    sample.offsetUs = (forward + backward) / 2;
+    sample.delayUs = ntpDiffUs(t4, t1) - ntpDiffUs(sample.t3, sample.t2);
+    if (sample.delayUs < 0)
+        sample.delayUs = 0;
+
+    sample.rootDelayUs = ntpShortToUs(reply.rootDelay);
+    sample.rootDispersionUs = ntpShortToUs(reply.rootDispersion);
+    sample.stratum = reply.stratum;
+    sample.leap = reply.leap;
+    return sample;
+}
+
+// ----------------------------------------------------
+//
+//               Conversões de timestamp
+//
+// ----------------------------------------------------
+
+uint64_t ntpFromTimeval(const struct timeval &tv)
+{
+    uint64_t seconds = (uint32_t)((uint64_t)tv.tv_sec + NTP_UNIX_EPOCH_DELTA);
+    uint64_t fraction = ((uint64_t)tv.tv_usec << 32) / 1000000ULL;
+    return (seconds << 32) | fraction;
+}
+
+/**
+ * @brief Converte microssegundos desde 1970 para o formato NTP de 64 bits
+ *
+ * A fração é arredondada para o valor mais próximo, sem perder os
+ * submicrossegundos que o timeval descarta na volta.
+ */
+uint64_t ntpFromUnixUs(int64_t us)
+{
+    uint64_t seconds = (uint32_t)((uint64_t)(us / 1000000) + NTP_UNIX_EPOCH_DELTA);
+    uint64_t fraction = ((uint64_t)(us % 1000000) * 4294967296ULL + 500000ULL) / 1000000ULL;
+    return (seconds << 32) + fraction;
+}
+
+/**
+ * @brief Converte um timestamp NTP para timeval
+ *
+ * Segundos NTP são interpretados de forma que o resultado caia entre
+ * 1970 e 2106, o que cobre a virada de era NTP de 2036.
+ */
+struct timeval ntpToTimeval(uint64_t ntp)
+{
+    struct timeval tv;
+    tv.tv_sec = (time_t)(uint32_t)((uint32_t)(ntp >> 32) - NTP_UNIX_EPOCH_DELTA);
+    tv.tv_usec = (suseconds_t)(((ntp & 0xFFFFFFFFULL) * 1000000ULL) >> 32);
+    return tv;
+}
+
+/**
+ * @brief Diferença a - b em microssegundos
+ *
+ * A subtração é feita em aritmética modular de 64 bits, então o resultado
+ * é válido para diferenças de até ±68 anos, inclusive através da era.
+ */
+int64_t ntpDiffUs(uint64_t a, uint64_t b)
+{
+    int64_t diff = (int64_t)(a - b);
+    int64_t seconds = diff >> 32; // Deslocamento aritmético: arredonda para baixo
+    uint64_t fraction = (uint64_t)diff & 0xFFFFFFFFULL;
+    return seconds * 1000000LL + (int64_t)((fraction * 1000000ULL) >> 32);
+}
+
+uint32_t ntpShortToUs(uint32_t value)
+{
+    uint64_t us = ((uint64_t)value * 1000000ULL) >> 16;
+    return us > UINT32_MAX ? UINT32_MAX : (uint32_t)us;
+}
+
+/**
+ * @brief Microssegundos para o formato curto NTP (16.16 segundos)
+ */
+uint32_t ntpShortFromUs(uint32_t us)
+{
+    return (uint32_t)(((uint64_t)us << 16) / 1000000ULL);
+}
@@ -0,0 +1,85 @@
+#ifndef NTP_PACKET_H
+#define NTP_PACKET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <sys/time.h>
+
+constexpr uint16_t NTP_PORT = 123;
+constexpr size_t NTP_PACKET_SIZE = 48;
+constexpr uint32_t NTP_UNIX_EPOCH_DELTA = 2208988800UL; // 1900-01-01 → 1970-01-01
+
+constexpr uint8_t NTP_VERSION = 4;
+constexpr uint8_t NTP_MODE_CLIENT = 3;
+constexpr uint8_t NTP_MODE_SERVER = 4;
+constexpr uint8_t NTP_LEAP_NONE = 0;
+constexpr uint8_t NTP_LEAP_UNSYNC = 3;
+constexpr uint8_t NTP_MAX_STRATUM = 15;
+
+// Códigos Kiss-o'-Death no referenceId de respostas com stratum 0 (RFC 5905 §7.4)
+constexpr uint32_t NTP_KISS_RATE = 0x52415445; // "RATE": reduzir a taxa de pedidos
+constexpr uint32_t NTP_KISS_DENY = 0x44454E59; // "DENY": acesso negado
+constexpr uint32_t NTP_KISS_RSTR = 0x52535452; // "RSTR": acesso restrito
+
+/**
+ * @brief Representação decodificada do cabeçalho SNTPv4 (RFC 4330 / RFC 5905)
+ *
+ * Os timestamps são mantidos no formato NTP de 64 bits (32.32, segundos
+ * desde 1900) e os campos rootDelay/rootDispersion no formato curto
+ * NTP (16.16 segundos).
+ */
+struct NTPPacket
+{
+    uint8_t leap;
+    uint8_t version;
+    uint8_t mode;
+    uint8_t stratum;
+    int8_t poll;
+    int8_t precision;
+    uint32_t rootDelay;
+    uint32_t rootDispersion;
+    uint32_t referenceId;
+    uint64_t referenceTs;
+    uint64_t originTs;
+    uint64_t receiveTs;
+    uint64_t transmitTs;
+
+    static NTPPacket request(uint64_t transmitTs);
+
+    void encode(uint8_t *buf) const;
+    bool decode(const uint8_t *buf, size_t len);
+
+    static void setTransmitTs(uint8_t *buf, uint64_t transmitTs);
+};
+
+/**
+ * @brief Resultado de uma troca cliente/servidor
+ *
+ * t1..t4 seguem a nomenclatura da RFC 5905:
+ *  t1 = envio do cliente, t2 = recepção no servidor,
+ *  t3 = envio do servidor, t4 = recepção no cliente.
+ */
+struct NTPSample
+{
+    uint64_t t1;
+    uint64_t t2;
+    uint64_t t3;
+    uint64_t t4;
+    int64_t offsetUs;          // Offset do relógio local ((t2-t1)+(t3-t4))/2
+    int64_t delayUs;           // Atraso de ida e volta (t4-t1)-(t3-t2)
+    uint32_t rootDelayUs;      // Atraso acumulado até a referência primária
+    uint32_t rootDispersionUs; // Dispersão acumulada até a referência primária
+    uint8_t stratum;
+    uint8_t leap;
+
+    static NTPSample fromExchange(const NTPPacket &reply, uint64_t t1, uint64_t t4);
+};
+
+uint64_t ntpFromTimeval(const struct timeval &tv);
+uint64_t ntpFromUnixUs(int64_t us);
+struct timeval ntpToTimeval(uint64_t ntp);
+int64_t ntpDiffUs(uint64_t a, uint64_t b);
+uint32_t ntpShortToUs(uint32_t value);
+uint32_t ntpShortFromUs(uint32_t us);
+
+#endif // NTP_PACKET_H
@@ -0,0 +1,177 @@
+#include "NTPScheduler.h"
+#include "NTPSync.h"
+#include <algorithm>
+
+NTPScheduler::NTPScheduler(NTPTasking *tasking)
+    : _tasking(tasking), _started(false), _running(nullptr), _clocks{}
+{
+}
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Agendador usado por NTPSyncClock::begin() sem agendador explícito
+ *
+ * Nunca é destruído: a tarefa continua referenciando-o até o fim do
+ * programa.
+ */
+NTPScheduler &NTPScheduler::shared()
+{
+    static NTPScheduler *scheduler = new NTPScheduler();
+    return *scheduler;
+}
+
+/**
+ * @brief Registra uma instância e acorda a tarefa
+ *
+ * Cria a tarefa na primeira chamada. Registrar a mesma instância de novo
+ * apenas acorda a tarefa.
+ *
+ * @return false se o agendador já tiver NTP_MAX_CLOCKS instâncias ou se a
+ *         tarefa não puder ser criada.
+ */
+bool NTPScheduler::add(NTPSyncClock &clock)
+{
+    bool start = false;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (std::find(_clocks.begin(), _clocks.end(), &clock) == _clocks.end())
+        {
+            if (!_clocks.push_back(&clock))
+            {
+                NTP_LOGE("Agendador cheio: %s não registrado", clock.name());
+                return false;
+            }
+        }
+        if (_tasking == nullptr)
+            _tasking = clock.tasking();
+        start = !_started;
+        _started = true;
+    }
+
+    if (start)
+    {
+        if (!_tasking->start(task, "TimeSyncTaskNTP", NTP_SCHEDULER_STACK_SIZE, this, 1))
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _started = false;
+            _clocks.count = (uint8_t)(std::remove(_clocks.begin(), _clocks.end(), &clock) -
+                                      _clocks.begin());
+            NTP_LOGE("Falha ao criar a tarefa de sincronização");
+            return false;
+        }
+        NTP_LOGI("Tarefa de sincronização iniciada");
+    }
+    else
+    {
+        notify();
+    }
+    return true;
+}
+
+/**
+ * @brief Remove uma instância, esperando o loop() dela terminar
+ *
+ * Ao retornar, a tarefa não toca mais na instância, que pode ser
+ * destruída. Não deve ser chamada de dentro de um callback executado
+ * pela própria tarefa.
+ */
+void NTPScheduler::remove(NTPSyncClock &clock)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _clocks.count = (uint8_t)(std::remove(_clocks.begin(), _clocks.end(), &clock) -
+                              _clocks.begin());
+    _idle.wait(lock, [this, &clock]
+               { return _running != &clock; });
+}
+
+/**
+ * @brief Acorda a tarefa para reavaliar os prazos de todas as instâncias
+ */
+void NTPScheduler::notify()
+{
+    NTPTasking *tasking;
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        if (!_started)
+            return;
+        tasking = _tasking;
+    }
+    tasking->notify();
+}
+
+size_t NTPScheduler::size()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return _clocks.size();
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Chama loop() de cada instância uma vez
+ *
+ * A passada percorre uma cópia da lista tirada no início: um remove()
+ * durante loop() compacta _clocks sem fazer a passada pular a instância
+ * seguinte. Cada instância da cópia é conferida em _clocks antes de
+ * rodar, pois pode ter sido removida e destruída nesse meio tempo.
+ *
+ * _lock não é mantido durante loop(): uma instância lenta não bloqueia
+ * add()/remove() das demais.
+ *
+ * @return O menor dos intervalos devolvidos, ou 0 se alguma instância
+ *         tiver trabalho imediato.
+ */
+uint32_t NTPScheduler::runOnce()
+{
+    FixedList<NTPSyncClock *, NTP_MAX_CLOCKS> pass{};
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        pass = _clocks;
+    }
+
+    uint32_t waitMs = NTP_DISCIPLINE_TICK_MS; // Sem instâncias, apenas revisita a lista
+    for (NTPSyncClock *clock : pass)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            if (std::find(_clocks.begin(), _clocks.end(), clock) == _clocks.end())
+                continue;
+            _running = clock;
+        }
+
+        waitMs = std::min(waitMs, clock->loop());
+
+        {
+            std::lock_guard<std::mutex> lock(_lock);
+            _running = nullptr;
+        }
+        _idle.notify_all();
+    }
+    return waitMs;
+}
+
+void NTPScheduler::task(void *arg)
+{
+    NTPScheduler *scheduler = static_cast<NTPScheduler *>(arg);
+    while (true)
+    {
+        // Dorme até a próxima sincronização, compensação de frequência ou
+        // requestSync() de qualquer instância
+        uint32_t waitMs = scheduler->runOnce();
+        if (waitMs > 0)
+        {
+            // Ociosa: formata os logs pendentes, fora de qualquer lock
+            NTPLog::flush();
+            scheduler->_tasking->wait(waitMs);
+        }
+    }
+}
@@ -0,0 +1,56 @@
+#ifndef NTP_SCHEDULER_H
+#define NTP_SCHEDULER_H
+
+#include "FixedList.h"
+#include "hal/NTPHal.h"
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+class NTPSyncClock;
+
+constexpr uint8_t NTP_MAX_CLOCKS = 4;              // Instâncias por agendador
+constexpr uint32_t NTP_SCHEDULER_STACK_SIZE = 4096; // Pilha da tarefa compartilhada
+
+/**
+ * @brief Uma única tarefa que conduz várias instâncias de NTPSyncClock
+ *
+ * A tarefa chama loop() de cada instância registrada e dorme até o menor
+ * dos prazos devolvidos, ou até notify(). Assim, N relógios custam uma
+ * pilha, não N. A tarefa é criada no primeiro add() e usa o NTPTasking
+ * do construtor ou, se nenhum for dado, o da primeira instância
+ * registrada.
+ *
+ * Exemplo de uso:
+ * NTPScheduler scheduler;
+ * lan.begin(60, 5, scheduler);
+ * pool.begin(60, 5, scheduler);
+ */
+class NTPScheduler
+{
+public:
+    explicit NTPScheduler(NTPTasking *tasking = nullptr);
+
+    NTPScheduler(const NTPScheduler &) = delete;
+    NTPScheduler &operator=(const NTPScheduler &) = delete;
+
+    bool add(NTPSyncClock &clock);
+    void remove(NTPSyncClock &clock);
+    void notify();
+    size_t size();
+
+    static NTPScheduler &shared();
+
+private:
+    std::mutex _lock;
+    std::condition_variable _idle; // Sinalizado quando _running é liberado
+    NTPTasking *_tasking;
+    bool _started;
+    NTPSyncClock *_running; // Instância em loop() na tarefa, ou nullptr
+    FixedList<NTPSyncClock *, NTP_MAX_CLOCKS> _clocks;
+
+    uint32_t runOnce();
+    static void task(void *arg);
+};
+
+#endif // NTP_SCHEDULER_H
@@ -0,0 +1,187 @@
+#include "NTPStateStore.h"
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+static_assert(sizeof(NTPStateRecord) == 264, "Layout de NTPStateRecord mudou: incremente NTP_STATE_VERSION");
+
+static void slotKey(uint8_t slot, char *key, size_t len)
+{
+    snprintf(key, len, "state%u", (unsigned)slot);
+}
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @param name Namespace no NTPStorage; truncado em NTP_STATE_NAMESPACE_LEN - 1.
+ */
+NTPStateStore::NTPStateStore(const char *name)
+    : _last(),
+      _hasLast(false),
+      _slot(NTP_STATE_SLOTS - 1),
+      _lastWriteMs(0),
+      _writtenThisBoot(false),
+      _intervalMs(NTP_STATE_DEFAULT_INTERVAL_MS)
+{
+    snprintf(_name, sizeof(_name), "%s", name);
+}
+
+/**
+ * @brief Define o intervalo entre gravações sem mudança relevante
+ */
+void NTPStateStore::setInterval(uint32_t intervalMs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    _intervalMs = intervalMs;
+}
+
+/**
+ * @brief Lê o registro válido mais recente entre os slots
+ *
+ * @return false se nenhum slot tiver um registro válido da versão atual.
+ */
+bool NTPStateStore::load(NTPStorage *storage, NTPStateRecord &record)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    char key[12];
+    bool found = false;
+
+    std::lock_guard<std::mutex> storageGuard(storageLock());
+    storage->begin(_name, true);
+    for (uint8_t slot = 0; slot < NTP_STATE_SLOTS; slot++)
+    {
+        NTPStateRecord candidate;
+        slotKey(slot, key, sizeof(key));
+        if (storage->getBytes(key, &candidate, sizeof(candidate)) != sizeof(candidate) ||
+            !valid(candidate))
+            continue;
+
+        if (!found || (int32_t)(candidate.sequence - record.sequence) > 0)
+        {
+            record = candidate;
+            _slot = slot;
+            found = true;
+        }
+    }
+    storage->end();
+
+    if (found)
+    {
+        _last = record;
+        _hasLast = true;
+    }
+    return found;
+}
+
+/**
+ * @brief Verifica se o registro difere o bastante do último gravado
+ *
+ * @details
+ *     Novos endereços, mudança de deriva acima de
+ *     NTP_STATE_DRIFT_EPSILON_PPM ou de flags justificam a gravação na
+ *     hora. lastSync e o ponto de warm start avançam a cada sincronização
+ *     e só são gravados uma vez por boot e depois a cada intervalo
+ *     configurado. sequence e crc são ignorados.
+ */
+bool NTPStateStore::needsWrite(const NTPStateRecord &record, uint32_t nowMs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    if (!_hasLast || record.flags != _last.flags || record.addressCount != _last.addressCount)
+        return true;
+    for (uint8_t i = 0; i < record.addressCount; i++)
+    {
+        // O prazo de expiração muda a cada renovação; só o IP importa
+        if (record.addresses[i].hostHash != _last.addresses[i].hostHash ||
+            record.addresses[i].family != _last.addresses[i].family ||
+            memcmp(record.addresses[i].ip, _last.addresses[i].ip, sizeof(record.addresses[i].ip)) != 0)
+            return true;
+    }
+    if ((record.flags & NTPStateRecord::HasDrift) &&
+        std::fabs(record.driftPpm - _last.driftPpm) > NTP_STATE_DRIFT_EPSILON_PPM)
+        return true;
+
+    bool advanced = record.lastSync != _last.lastSync || record.warmRtcUs != _last.warmRtcUs;
+    return advanced && (!_writtenThisBoot || nowMs - _lastWriteMs >= _intervalMs);
+}
+
+/**
+ * @brief Grava o registro no próximo slot do rodízio
+ *
+ * Preenche versão, sequência e CRC. Bloqueia pelo tempo da escrita na
+ * flash; deve ser chamada fora do _mutex do NTPSync.
+ */
+bool NTPStateStore::write(NTPStorage *storage, const NTPStateRecord &record, uint32_t nowMs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    NTPStateRecord out = record;
+    out.version = NTP_STATE_VERSION;
+    out.reserved = 0;
+    out.sequence = _hasLast ? _last.sequence + 1 : 1;
+    out.crc = crc32(&out, offsetof(NTPStateRecord, crc));
+
+    uint8_t slot = (uint8_t)((_slot + 1) % NTP_STATE_SLOTS);
+    char key[12];
+    slotKey(slot, key, sizeof(key));
+
+    bool written;
+    {
+        std::lock_guard<std::mutex> storageGuard(storageLock());
+        if (!storage->begin(_name, false))
+            return false;
+        written = storage->putBytes(key, &out, sizeof(out)) == sizeof(out);
+        storage->end();
+    }
+    if (!written)
+        return false;
+
+    _last = out;
+    _hasLast = true;
+    _slot = slot;
+    _lastWriteMs = nowMs;
+    _writtenThisBoot = true;
+    return true;
+}
+
+/**
+ * @brief Lock de begin()...end() no NTPStorage, comum a todas as instâncias
+ */
+std::mutex &NTPStateStore::storageLock()
+{
+    static std::mutex lock;
+    return lock;
+}
+
+/**
+ * @brief CRC-32 (IEEE 802.3), sem tabela
+ */
+uint32_t NTPStateStore::crc32(const void *data, size_t len)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc ^= bytes[i];
+        for (uint8_t bit = 0; bit < 8; bit++)
+        {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1)));
+        }
+    }
+    return ~crc;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+bool NTPStateStore::valid(const NTPStateRecord &record)
+{
+    return record.version == NTP_STATE_VERSION &&
+           record.addressCount <= NTP_STATE_MAX_ADDRESSES &&
+           record.crc == crc32(&record, offsetof(NTPStateRecord, crc));
+}
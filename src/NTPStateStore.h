@@ -0,0 +1,98 @@
+#ifndef NTP_STATE_STORE_H
+#define NTP_STATE_STORE_H
+
+#include "hal/NTPHal.h"
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+
+constexpr uint8_t NTP_STATE_VERSION = 2;
+constexpr uint8_t NTP_STATE_SLOTS = 4;               // Registros em rodízio
+constexpr uint8_t NTP_STATE_MAX_ADDRESSES = 8;       // Endereços DNS salvos
+constexpr float NTP_STATE_DRIFT_EPSILON_PPM = 0.5f;  // Variação de deriva que justifica gravar
+constexpr uint32_t NTP_STATE_DEFAULT_INTERVAL_MS = 6 * 3600000UL;
+constexpr size_t NTP_STATE_NAMESPACE_LEN = 16;       // Limite do NVS, com o '\0'
+
+/**
+ * @brief Estado persistente do NTPSync, gravado como um único blob
+ *
+ * Layout fixo, sem ponteiros. sequence cresce a cada gravação e crc cobre
+ * todos os bytes anteriores a ele. Registros de outra versão são
+ * ignorados na leitura.
+ */
+struct NTPStateRecord
+{
+    enum Flags : uint8_t
+    {
+        HasDrift = 1 << 0, // driftPpm válido
+        HasWarm = 1 << 1   // warm* válidos (plataforma com relógio RTC)
+    };
+
+    struct Address
+    {
+        uint32_t hostHash;   // FNV-1a do hostname
+        uint32_t expiresUtc; // Instante UTC em que o endereço expira
+        uint8_t family;      // NTPFamily
+        uint8_t ip[16];
+        uint8_t reserved[3];
+    };
+
+    uint8_t version;
+    uint8_t flags;
+    uint8_t addressCount;
+    uint8_t reserved;
+    uint32_t sequence;
+    uint32_t lastSync;    // Timestamp da última sincronização
+    float driftPpm;       // Deriva do oscilador
+    int64_t warmUtcUs;    // UTC no instante de warmRtcUs
+    int64_t warmRtcUs;    // NTPClock::rtcUs()
+    uint32_t warmErrorUs; // Erro máximo no mesmo instante
+    Address addresses[NTP_STATE_MAX_ADDRESSES];
+    uint32_t crc;
+};
+
+/**
+ * @brief Persistência do estado com gravações agrupadas e rodízio de slots
+ *
+ * O registro é gravado num de NTP_STATE_SLOTS slots, em rodízio, e a
+ * leitura escolhe o slot válido (versão e CRC) de maior sequência. Uma
+ * gravação interrompida por queda de energia invalida apenas o próprio
+ * slot e o registro anterior continua disponível.
+ *
+ * needsWrite() decide se vale a pena gravar: só quando algo relevante
+ * mudou (endereços, deriva além de NTP_STATE_DRIFT_EPSILON_PPM) ou quando
+ * o intervalo configurado passou desde a última gravação.
+ *
+ * O acesso ao NTPStorage é serializado por um lock próprio, para que a
+ * gravação aconteça fora do _mutex do NTPSync. Cada instância grava no
+ * seu namespace; storageLock() serializa begin()...end() entre instâncias
+ * que compartilham o mesmo NTPStorage.
+ */
+class NTPStateStore
+{
+public:
+    explicit NTPStateStore(const char *name = "ntp");
+
+    const char *name() const { return _name; }
+    void setInterval(uint32_t intervalMs);
+    bool load(NTPStorage *storage, NTPStateRecord &record);
+    bool needsWrite(const NTPStateRecord &record, uint32_t nowMs);
+    bool write(NTPStorage *storage, const NTPStateRecord &record, uint32_t nowMs);
+
+    static uint32_t crc32(const void *data, size_t len);
+    static std::mutex &storageLock();
+
+private:
+    std::mutex _lock;
+    char _name[NTP_STATE_NAMESPACE_LEN];
+    NTPStateRecord _last; // Último registro lido ou gravado
+    bool _hasLast;
+    uint8_t _slot;        // Slot de _last
+    uint32_t _lastWriteMs;
+    bool _writtenThisBoot;
+    uint32_t _intervalMs;
+
+    static bool valid(const NTPStateRecord &record);
+};
+
+#endif // NTP_STATE_STORE_H
@@ -1,422 +1,2448 @@
 #include "NTPSync.h"
-#include <Arduino.h>
-#include <WiFi.h>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 
-Preferences NTPSync::_prefs;
-NTPSync::Timeval NTPSync::_timeval;
-bool NTPSync::_timeSyncked = false;
-uint32_t NTPSync::_syncInterval = 3600000;
-uint32_t NTPSync::_retryInterval = 300000;
-std::mutex NTPSync::_mutex;
-bool NTPSync::_logEnabled = true;
-tm NTPSync::_timeinfo;
+/**
+ * @brief FNV-1a do hostname, identifica os endereços salvos no Preferences
+ */
+static uint32_t hostnameHash(const char *hostname)
+{
+    uint32_t h = 2166136261u;
+    for (; *hostname != '\0'; hostname++)
+    {
+        h = (h ^ (uint8_t)*hostname) * 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief Separa hostname e porta de uma entrada de servidor
+ *
+ * Aceita "host", "host:porta", "[IPv6]:porta" e IPv6 sem colchetes (sem
+ * porta).
+ *
+ * @return false se o hostname não couber em NTP_HOSTNAME_LEN.
+ */
+static bool splitServer(const char *server, char *hostname, uint16_t &port)
+{
+    const char *begin = server;
+    const char *end = server + strlen(server);
+    const char *colon = strrchr(server, ':');
+    port = NTP_PORT;
+
+    if (*server == '[')
+    {
+        const char *close = strchr(server, ']');
+        if (close != nullptr)
+        {
+            begin = server + 1;
+            end = close;
+            if (close[1] == ':')
+                port = (uint16_t)atoi(close + 2);
+        }
+    }
+    else if (colon != nullptr && strchr(server, ':') == colon)
+    {
+        end = colon;
+        port = (uint16_t)atoi(colon + 1);
+    }
+
+    size_t len = (size_t)(end - begin);
+    if (len >= NTP_HOSTNAME_LEN)
+        return false;
+    memcpy(hostname, begin, len);
+    hostname[len] = '\0';
+    return true;
+}
+
+/**
+ * @brief Domínio de tempo independente do relógio do sistema
+ *
+ * Usa um NTPNetwork próprio e um NTPSoftClock sobre o relógio nativo: as
+ * correções ficam na instância, sem settimeofday()/adjtime(). O
+ * armazenamento e as tarefas são os nativos.
+ *
+ * @param name Namespace de persistência (até 15 caracteres), único por
+ *             instância.
+ */
+NTPSyncClock::NTPSyncClock(const char *name) : NTPSyncClock(name, ntpDefaultPlatform())
+{
+    _ownNetwork.reset(ntpCreateNetwork());
+    _platform.network = _ownNetwork.get();
+    _platform.clock = &_softClock;
+    publishStatus();
+}
+
+/**
+ * @brief Domínio de tempo sobre backends fornecidos por quem chama
+ *
+ * @param name Namespace de persistência (até 15 caracteres), único por
+ *             instância.
+ * @param platform Backends a usar; os ponteiros devem permanecer válidos
+ *                 enquanto a instância existir.
+ */
+NTPSyncClock::NTPSyncClock(const char *name, const NTPPlatform &platform)
+    : _softClock(ntpDefaultPlatform().clock),
+      _platform(platform),
+      _scheduler(nullptr),
+      _syncInterval(3600000),
+      _retryInterval(300000),
+      _timeinfo(),
+      _timeval(),
+      _localTime(),
+      _timeSyncked(false),
+      _adaptivePoll(false),
+      _packetTimeout(NTP_DEFAULT_PACKET_TIMEOUT_MS),
+      _syncMode(SyncMode::Sequential),
+      _quorum(0),
+      _offsetUs(0),
+      _jitterUs(0),
+      _job(),
+      _scheduled(false),
+      _nextSyncMs(0),
+      _lastTickMs(0),
+      _completed(),
+      _completedCount(0),
+      _dnsTtl(NTP_DNS_DEFAULT_TTL_S),
+      _dnsPending(0),
+      _source(NTPTimeSource::None),
+      _errorUs(NTP_ERROR_UNKNOWN),
+      _errorBaseUs(0),
+      _store(name),
+      _persistPending(false),
+      _persistMarkMs(0),
+      _counters(),
+      _serverState(ServerStopped),
+      _serverTask(false),
+      _serverPort(0),
+      _serveBatch(),
+      _serveRequests(0),
+      _serveReplies(0),
+      _serveDropped(0),
+      _rateIntervalMs(NTP_RATE_INTERVAL_MS),
+      _rateBurst(NTP_RATE_BURST),
+      _jitterPercent(NTP_SCHEDULE_JITTER_PERCENT),
+      _startupSpreadMs(NTP_STARTUP_SPREAD_MS),
+      _anchored(false),
+      _anchorMonoUs(0),
+      _anchorUtcUs(0)
+{
+    publishStatus(); // nowMicros() e getStatus() válidos antes de begin()
+}
+
+NTPSyncClock::~NTPSyncClock()
+{
+    end();
+}
+
+/**
+ * @brief Instância padrão, que disciplina o relógio do sistema
+ *
+ * Usa os backends nativos e o namespace "ntp" das versões anteriores.
+ */
+NTPSyncClock &NTPSync::clock()
+{
+    static NTPSyncClock instance("ntp", ntpDefaultPlatform());
+    return instance;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Liga ou desliga os logs em tempo de execução
+ *
+ * As mensagens vão para o buffer de NTPLog e são formatadas depois, fora
+ * da sincronização. Níveis acima de NTP_LOG_LEVEL nem são compilados.
+ */
+void NTPSync::logControl(bool enabled)
+{
+    NTPLog::setEnabled(enabled);
+}
+
+/**
+ * @brief Inicializa a instância no agendador compartilhado
+ *
+ * Carrega o estado da sincroniza o de tempo do Preferences e inicializa a
+ * tarefa de sincroniza o de tempo. A primeira sincronização acontece
+ * após um atraso aleatório de até setScheduleJitter() startupSpreadMs,
+ * para que dispositivos que reiniciam juntos não consultem os servidores
+ * no mesmo instante.
+ *
+ * @param syncInterval INTERVALO DE TEMPO (em minutos) entre solicita es
+ *                     de sincroniza o de tempo com o servidor NTP.
+ * @param retryInterval INTERVALO DE TEMPO (em minutos) entre tentativas
+ *                     de sincroniza o de tempo com o servidor NTP.
+ */
+void NTPSyncClock::begin(uint32_t syncInterval, uint32_t retryInterval)
+{
+    begin(syncInterval, retryInterval, NTPScheduler::shared());
+}
+
+/**
+ * @brief Inicializa a instância em um agendador específico
+ *
+ * Instâncias no mesmo agendador compartilham uma única tarefa. Chamar
+ * begin() de novo troca os intervalos e, se for outro agendador, muda a
+ * instância de agendador.
+ *
+ * @param syncInterval Minutos entre sincronizações.
+ * @param retryInterval Minutos entre tentativas após uma falha.
+ * @param scheduler Agendador que conduz loop(); deve existir enquanto a
+ *                  instância estiver registrada.
+ */
+void NTPSyncClock::begin(uint32_t syncInterval, uint32_t retryInterval, NTPScheduler &scheduler)
+{
+    NTPScheduler *previous;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        _syncInterval = syncInterval * MINUTES_TO_MS;
+        _retryInterval = retryInterval * MINUTES_TO_MS;
+
+        if (systemDomain())
+            NTPLog::setClock(_platform.clock);
+        loadTimeFromPrefs();
+        _scheduled = true;
+        _nextSyncMs = _platform.clock->millis();
+        if (_startupSpreadMs > 0)
+            _nextSyncMs += _platform.clock->random() % _startupSpreadMs;
+        previous = _scheduler;
+        _scheduler = &scheduler;
+    }
+
+    // Fora do _mutex: remove() espera o loop() em andamento
+    if (previous != nullptr && previous != &scheduler)
+        previous->remove(*this);
+    if (!scheduler.add(*this))
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _scheduler = nullptr;
+    }
+}
+
+/**
+ * @brief Desfaz begin(): sai do agendador, desliga o servidor e cancela
+ *        a sincronização em andamento
+ *
+ * Ao retornar, nenhuma tarefa da biblioteca usa mais a instância. Chamada
+ * também pelo destrutor.
+ */
+void NTPSyncClock::end()
+{
+    NTPScheduler *scheduler;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        scheduler = _scheduler;
+        _scheduler = nullptr;
+        _scheduled = false;
+    }
+    if (scheduler != nullptr)
+        scheduler->remove(*this);
+    stopServer();
+    cancelSync();
+}
+
+/**
+ * @brief Tenta sincronizar o tempo com os servidores NTP
+ *
+ * Versão bloqueante de requestSync(): conduz a sincronização na tarefa
+ * que chamou até o fim. Se já houver uma sincronização em andamento,
+ * espera por ela. _mutex só é mantido durante cada passo (no máximo
+ * NTP_ASYNC_POLL_MS), nunca durante o backoff.
+ *
+ * @param maxRetries Número máximo de tentativas por servidor NTP
+ *                   (apenas no modo sequencial)
+ *
+ * @return true se o tempo for sincronizado, ou se os servidores
+ *         responderam sem amostra nova e o tempo segue sincronizado
+ *         (SyncResult::Unchanged); false caso contrário
+ */
+bool NTPSyncClock::syncTime(uint8_t maxRetries)
+{
+    struct Waiter
+    {
+        std::atomic<bool> done;
+        SyncResult result;
+    } waiter{{false}, SyncResult::Failed};
+
+    SyncCallback onDone = [](SyncResult result, const NTPStatus &, void *arg)
+    {
+        Waiter *w = (Waiter *)arg;
+        w->result = result;
+        w->done.store(true, std::memory_order_release);
+    };
+
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (!startJob(maxRetries, onDone, &waiter, 0))
+            return false;
+    }
+
+    while (!waiter.done.load(std::memory_order_acquire))
+    {
+        uint32_t waitMs = loop();
+        if (waitMs > 0 && !waiter.done.load(std::memory_order_acquire))
+            _platform.clock->sleepMs(std::min(waitMs, NTP_ASYNC_POLL_MS));
+    }
+    return waiter.result == SyncResult::Success ||
+           (waiter.result == SyncResult::Unchanged && isTimeSynced());
+}
+
+/**
+ * @brief Pede uma sincronização sem bloquear
+ *
+ * @details
+ *     A sincronização é conduzida como uma máquina de estados pela tarefa
+ *     de fundo (após begin()) ou por chamadas a loop(). Se já houver uma
+ *     sincronização em andamento, o pedido se junta a ela.
+ *
+ *     Para usar notificação de tarefa no ESP32, chame xTaskNotifyGive()
+ *     dentro do callback.
+ *
+ * @param callback Chamado uma vez com o resultado; pode ser nulo.
+ * @param arg Repassado ao callback.
+ * @param timeoutMs Prazo para concluir; ao esgotar, a sincronização é
+ *                  interrompida com SyncResult::Timeout. 0 = sem prazo.
+ *
+ * @return false se já houver NTP_MAX_SYNC_LISTENERS pedidos aguardando.
+ */
+bool NTPSyncClock::requestSync(SyncCallback callback, void *arg, uint32_t timeoutMs)
+{
+    bool started;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        started = startJob(3, callback, arg, timeoutMs);
+    }
+    if (started)
+        wake();
+    return started;
+}
+
+/**
+ * @brief Interrompe a sincronização em andamento
+ *
+ * Os callbacks pendentes recebem SyncResult::Cancelled antes do retorno.
+ */
+void NTPSyncClock::cancelSync()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_job.state != JobState::Idle)
+            finishJob(SyncResult::Cancelled);
+    }
+    deliverCompleted();
+}
+
+/**
+ * @brief Verifica se há uma sincronização em andamento, sem lock
+ */
+bool NTPSyncClock::isSyncPending()
+{
+    return _status.read().syncing;
+}
+
+/**
+ * @brief Avança a sincronização e as tarefas periódicas
+ *
+ * @details
+ *     Executa um passo da sincronização em andamento (bloqueando no máximo
+ *     NTP_ASYNC_POLL_MS à espera de respostas), inicia a sincronização
+ *     periódica quando chega a hora (após begin()), aplica a compensação
+ *     de frequência e entrega os callbacks concluídos.
+ *
+ *     A tarefa de fundo chama loop() continuamente. Sem begin(), a
+ *     aplicação pode chamá-la no seu próprio laço para conduzir os pedidos
+ *     de requestSync().
+ *
+ * @return Tempo em milissegundos até a próxima chamada necessária; 0 se
+ *         houver trabalho imediato.
+ */
+uint32_t NTPSyncClock::loop()
+{
+    uint32_t waitMs;
+    uint32_t now;
+    bool persist = false;
+    NTPStateRecord record;
+    NTPStorage *storage;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        now = _platform.clock->millis();
+        storage = _platform.storage;
+
+        if (now - _lastTickMs >= NTP_DISCIPLINE_TICK_MS)
+        {
+            _lastTickMs = now;
+            persist = _source == NTPTimeSource::Ntp; // Gravação periódica
+            int64_t correction = _discipline.tick(now);
+            if (correction != 0)
+            {
+                slewClock(correction);
+            }
+        }
+        uint32_t tickWaitMs = NTP_DISCIPLINE_TICK_MS - (now - _lastTickMs);
+
+        // Renovações de DNS continuam depois que a sincronização termina
+        if (_dnsPending > 0)
+        {
+            pollLookups(now);
+            tickWaitMs = std::min(tickWaitMs, NTP_ASYNC_POLL_MS);
+        }
+
+        if (_job.state == JobState::Idle && _scheduled && (int32_t)(now - _nextSyncMs) >= 0)
+        {
+            startJob(3, nullptr, nullptr, 0);
+        }
+
+        if (_job.state != JobState::Idle)
+            waitMs = std::min(stepJob(), tickWaitMs);
+        else if (_scheduled)
+            waitMs = std::min(_nextSyncMs - now, tickWaitMs);
+        else
+            waitMs = tickWaitMs;
+
+        // Agrupa as alterações de uma sincronização e grava depois dela
+        if (_persistPending && _job.state == JobState::Idle)
+        {
+            uint32_t elapsed = now - _persistMarkMs;
+            if (elapsed >= NTP_PERSIST_DELAY_MS)
+                persist = true;
+            else
+                waitMs = std::min(waitMs, NTP_PERSIST_DELAY_MS - elapsed);
+        }
+        if (persist)
+        {
+            _persistPending = false;
+            snapshotState(record);
+        }
+    }
+    deliverCompleted();
+
+    // A escrita na flash acontece fora do _mutex
+    if (persist && _store.needsWrite(record, now))
+        _store.write(storage, record, now);
+    return waitMs;
+}
+
+/**
+ * @brief Verifica se o tempo foi sincronizado com sucesso
+ *
+ * Não usa o mutex: lê o último estado publicado e nunca espera pela
+ * tarefa de sincronização.
+ *
+ * @return true se o tempo estiver sincronizado, false caso contrário
+ */
+bool NTPSyncClock::isTimeSynced()
+{
+    return _status.read().synced;
+}
+
+/**
+ * @brief Verifica se há algum horário válido, sincronizado ou restaurado
+ *
+ * @return true se o tempo estiver sincronizado ou houver um horário salvo
+ */
+bool NTPSyncClock::hasTimeval()
+{
+    NTPStatus status = _status.read();
+    return status.synced || status.lastSync > 0;
+}
+
+time_t NTPSyncClock::getLastTimeSync()
+{
+    return _status.read().lastSync;
+}
+
+/**
+ * @brief Horário local atual no fuso configurado, sem localtime()
+ *
+ * @param timeinfo Recebe a data e hora locais, com tm_isdst preenchido.
+ * @return true se houver um horário válido (ver hasTimeval()).
+ */
+bool NTPSyncClock::getLocalTime(struct tm &timeinfo)
+{
+    NTPStatus status = _status.read();
+    _localTime.toLocal(currentTime(), timeinfo);
+    return status.synced || status.lastSync > 0;
+}
+
+/**
+ * @brief Converte um instante qualquer para a hora local no fuso
+ *        configurado, como localtime_r()
+ *
+ * Sem mutex: usa o cache do dia local (LocalTimeCache), então instantes
+ * do mesmo dia custam uma subtração e algumas divisões. Pode ser chamada
+ * de qualquer tarefa, por exemplo para agrupar amostras por hora local.
+ */
+void NTPSyncClock::getLocalTime(time_t utc, struct tm &timeinfo)
+{
+    _localTime.toLocal(utc, timeinfo);
+}
+
+/**
+ * @brief Retorna uma cópia consistente do estado da sincronização
+ *
+ * A leitura é feita por seqlock, sem mutex, e pode ser chamada de laços
+ * críticos em qualquer tarefa. O horário corrigido atual pode ser obtido
+ * com status.utcUs() a partir do relógio monotônico da plataforma
+ * (esp_timer_get_time() no ESP32).
+ *
+ * @return Estado publicado na última alteração.
+ */
+NTPStatus NTPSyncClock::getStatus()
+{
+    return _status.read();
+}
+
+/**
+ * @brief Horário UTC atual com o intervalo de confiança, sem lock
+ *
+ * @details
+ *     Após uma sincronização, o erro é a distância à raiz do servidor
+ *     escolhido e cresce à tolerância de frequência (PHI) desde então.
+ *     Após um warm start, parte do erro salvo somado à tolerância do
+ *     relógio RTC pelo tempo em que o dispositivo ficou desligado ou em
+ *     deep sleep. Permite registrar dados com horário logo no boot, antes
+ *     da primeira sincronização.
+ *
+ * @return Estimativa do horário; source == NTPTimeSource::None se nenhum
+ *         horário for conhecido.
+ */
+NTPTimeEstimate NTPSyncClock::getTimeEstimate()
+{
+    NTPStatus status = _status.read();
+    int64_t monotonicUs = _platform.clock->monotonicUs();
+    return {status.utcUs(monotonicUs), status.errorUs(monotonicUs), status.source};
+}
+
+/**
+ * @brief Horário UTC atual em microssegundos, interpolado sem lock
+ *
+ * @details
+ *     Parte do último ponto de sincronização e avança com o relógio
+ *     monotônico da plataforma (esp_timer no ESP32, CLOCK_MONOTONIC no
+ *     host), corrigido pela frequência estimada. Não chama time() nem
+ *     gettimeofday(): custa uma leitura de seqlock, uma do relógio
+ *     monotônico e algumas multiplicações, e pode ser chamada de
+ *     qualquer tarefa.
+ *
+ *     Entre as compensações de frequência, que avançam o relógio do
+ *     sistema em degraus a cada 16 s, o valor pode diferir de
+ *     gettimeofday() por até 16 s × a deriva estimada.
+ *
+ * @param errorUs Se não for nulo, recebe o erro máximo, ou
+ *                NTP_ERROR_UNKNOWN sem sincronização nem warm start.
+ *
+ * @return Microssegundos desde 1970.
+ */
+int64_t NTPSyncClock::nowMicros(uint32_t *errorUs)
+{
+    NTPTimeBase base = _timeBase.read();
+    int64_t monotonicUs = _platform.clock->monotonicUs();
+    if (errorUs != nullptr)
+        *errorUs = base.errorUs(monotonicUs);
+    return base.utcUs(monotonicUs);
+}
+
+/**
+ * @brief Horário UTC atual no formato NTP de 64 bits (32.32), sem lock
+ *
+ * Mesma origem de nowMicros(), com a fração de segundo preservada.
+ *
+ * @param errorUs Se não for nulo, recebe o erro máximo.
+ */
+uint64_t NTPSyncClock::nowNtp64(uint32_t *errorUs)
+{
+    return ntpFromUnixUs(nowMicros(errorUs));
+}
+
+/**
+ * @brief Copia as métricas de saúde da sincronização, sem lock
+ *
+ * @details
+ *     Os contadores são atualizados pela tarefa de sincronização, que já
+ *     detém _mutex, e publicados por seqlock ao fim de cada
+ *     sincronização e de cada consulta DNS. A leitura nunca espera pela
+ *     tarefa; o texto para Prometheus ou JSON sai de
+ *     NTPMetrics::toPrometheus() e NTPMetrics::toJson().
+ *
+ * @param metrics Recebe o snapshot (~2 KB; evite alocá-lo na pilha de
+ *                tarefas pequenas).
+ */
+void NTPSyncClock::getMetrics(NTPMetrics &metrics)
+{
+    _metrics.read(metrics);
+    metrics.sinceLastSyncMs = metrics.everSynced ? _platform.clock->millis() - metrics.lastSyncMs : 0;
+    metrics.stackHighWater = _platform.tasking->stackHighWater();
+    metrics.serveRequests = _serveRequests.load(std::memory_order_relaxed);
+    metrics.serveReplies = _serveReplies.load(std::memory_order_relaxed);
+    metrics.serveDropped = _serveDropped.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Define o fuso horário e servidores NTP para sincronização de tempo
+ *
+ * @param timezone Fuso horário do local (ex. "America/Sao_Paulo")
+ * @param ntpServers Servidores NTP para sincronização de tempo
+ *                   (ex. {"pool.ntp.org", "a.st1.ntp.br", "ntp.cais.rnp.br"}).
+ *                   Uma porta diferente de 123 pode ser indicada com
+ *                   "host:porta" ou "[IPv6]:porta".
+ */
+void NTPSyncClock::setTimeval(const char *timezone, std::initializer_list<const char *> ntpServers)
+{
+    setTimeval(timezone, ntpServers.begin(), ntpServers.size());
+}
+
+/**
+ * @brief Variante com std::string, mantida por compatibilidade
+ */
+void NTPSyncClock::setTimeval(const char *timezone, const std::vector<std::string> &ntpServers)
+{
+    const char *list[NTP_MAX_SERVERS + 1];
+    size_t count = std::min(ntpServers.size(), (size_t)NTP_MAX_SERVERS + 1);
+    for (size_t i = 0; i < count; i++)
+    {
+        list[i] = ntpServers[i].c_str();
+    }
+    setTimeval(timezone, list, count);
+}
+
+/**
+ * @brief Define o fuso horário e a tabela de servidores
+ *
+ * @details
+ *     Os hostnames são copiados para a tabela de capacidade fixa
+ *     NTP_MAX_SERVERS; servidores além dela, ou com hostname maior que
+ *     NTP_HOSTNAME_LEN, são ignorados com um aviso. Depois desta chamada
+ *     a sincronização não aloca memória.
+ *
+ * @param ntpServers Vetor com count strings, no formato de setTimeval().
+ */
+void NTPSyncClock::setTimeval(const char *timezone, const char *const *ntpServers, size_t count)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        // A sincronização em andamento aponta para os servidores antigos
+        if (_job.state != JobState::Idle)
+            finishJob(SyncResult::Cancelled);
+
+        _timeval.zone = TimeZone();
+        if (timezone == nullptr || !TimeZone::find(timezone, _timeval.zone))
+        {
+            NTP_LOGW("Fuso desconhecido '%s', usando UTC", timezone);
+        }
+        _localTime.setZone(_timeval.zone);
+        updateDstStatus(currentTime());
+        applyTimezone();
+        publishStatus();
+
+        // Endereços já resolvidos continuam valendo para os mesmos hostnames,
+        // e as métricas seguem o servidor configurado; os novos começam
+        // zerados. Estáticos para não ocupar a pilha de quem chama, com um
+        // lock comum a todas as instâncias
+        cancelLookups();
+        static std::mutex scratchLock;
+        std::lock_guard<std::mutex> scratch(scratchLock);
+        static FixedList<NTPServer, NTP_MAX_SERVERS> previous;
+        previous = _timeval.servers;
+        _timeval.servers.clear();
+        uint32_t now = _platform.clock->millis();
+
+        static NTPServerMetrics oldMetrics[NTP_METRICS_MAX_SERVERS];
+        uint8_t oldCount = _counters.serverCount;
+        std::copy(_counters.servers, _counters.servers + oldCount, oldMetrics);
+        _counters.serverCount = 0;
+
+        for (size_t n = 0; n < count; n++)
+        {
+            const char *server = ntpServers[n] != nullptr ? ntpServers[n] : "";
+            if (_timeval.servers.full())
+            {
+                NTP_LOGW("Mais de %u servidores, ignorando %s", NTP_MAX_SERVERS, server);
+                break;
+            }
+
+            NTPServer entry = {};
+            if (!splitServer(server, entry.hostname, entry.address.port))
+            {
+                NTP_LOGW("Hostname longo demais, ignorando %s", server);
+                continue;
+            }
+
+            entry.numeric = ntpParseAddress(entry.hostname, entry.address);
+            entry.resolved = entry.numeric;
+            entry.dnsQuery = -1;
+            entry.expiresMs = now;
+            entry.tokens = _rateBurst;
+            entry.rateMarkMs = now;
+            entry.lastResponseTime = 1000;
+            entry.filter = ClockFilter();
+            for (const auto &old : previous)
+            {
+                if (!entry.numeric && old.resolved && strcmp(old.hostname, entry.hostname) == 0)
+                {
+                    uint16_t port = entry.address.port;
+                    entry.address = old.address;
+                    entry.address.port = port;
+                    entry.resolved = true;
+                    entry.expiresMs = old.expiresMs;
+                    // O limite de taxa e o KoD valem para o mesmo servidor
+                    entry.demoted = old.demoted;
+                    entry.tokens = old.tokens;
+                    entry.rateMarkMs = old.rateMarkMs;
+                    entry.rateIntervalMs = old.rateIntervalMs;
+                    break;
+                }
+            }
+
+            NTPServerMetrics &metrics = _counters.servers[_counters.serverCount];
+            metrics = {};
+            // Aspas e barras quebrariam os exportadores
+            size_t len = 0;
+            for (const char *c = server; *c != '\0'; c++)
+            {
+                if (len + 1 >= sizeof(metrics.hostname))
+                    break;
+                if (*c != '"' && *c != '\\' && (uint8_t)*c >= ' ')
+                    metrics.hostname[len++] = *c;
+            }
+            for (uint8_t i = 0; i < oldCount; i++)
+            {
+                if (strcmp(oldMetrics[i].hostname, metrics.hostname) == 0)
+                {
+                    metrics = oldMetrics[i];
+                    break;
+                }
+            }
+            entry.metricsSlot = _counters.serverCount++;
+            _timeval.servers.push_back(entry);
+        }
+        publishMetrics();
+    }
+    deliverCompleted();
+}
+
+/**
+ * @brief Define os intervalos de sincroniza o e retry para a classe NTPSync
+ *
+ * @param syncInterval INTERVALO DE TEMPO (em minutos) entre solicita es
+ *                     de sincroniza o de tempo com o servidor NTP.
+ * @param retryInterval INTERVALO DE TEMPO (em minutos) entre tentativas
+ *                     de sincroniza o de tempo com o servidor NTP.
+ */
+void NTPSyncClock::setSyncIntervals(uint32_t syncInterval, uint32_t retryInterval)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _syncInterval = syncInterval * MINUTES_TO_MS;
+    _retryInterval = retryInterval * MINUTES_TO_MS;
+}
+
+/**
+ * @brief Define a estratégia de consulta aos servidores
+ *
+ * @param mode SyncMode::Sequential consulta um servidor por vez com
+ *             retentativas; SyncMode::Parallel envia o pedido a todos os
+ *             servidores resolvidos ao mesmo tempo.
+ * @param quorum No modo paralelo, número de respostas que encerra a coleta
+ *               antes do timeout. 0 espera todos os servidores.
+ */
+void NTPSyncClock::setSyncMode(SyncMode mode, uint8_t quorum)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _syncMode = mode;
+    _quorum = quorum;
+}
+
+/**
+ * @brief Ativa o intervalo de sincronização adaptativo
+ *
+ * @details
+ *     Com o modo adaptativo, o intervalo começa em minInterval e dobra
+ *     enquanto o offset, o jitter e a deriva medidos indicarem que o erro
+ *     ao fim do intervalo seguinte continua dentro de errorBudgetMs. Ao
+ *     surgir deriva ou jitter maiores, o intervalo é reduzido à metade.
+ *     O intervalo de retry após falhas continua fixo.
+ *
+ * @param enabled true ativa o modo adaptativo; false volta ao intervalo
+ *                fixo de setSyncIntervals.
+ * @param minInterval Menor intervalo (em minutos).
+ * @param maxInterval Maior intervalo (em minutos).
+ * @param errorBudgetMs Erro máximo aceitável entre sincronizações.
+ */
+void NTPSyncClock::setAdaptivePolling(bool enabled, uint32_t minInterval, uint32_t maxInterval,
+                                 uint32_t errorBudgetMs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _adaptivePoll = enabled;
+    _discipline.setPollLimits(minInterval * MINUTES_TO_MS, maxInterval * MINUTES_TO_MS,
+                              errorBudgetMs * 1000);
+}
+
+/**
+ * @brief Retorna o tempo até a próxima sincronização
+ *
+ * @param success Resultado da última tentativa de sincronização.
+ *
+ * @return Intervalo em milissegundos: o de retry após falha, o adaptativo
+ *         se ativo ou o fixo configurado.
+ */
+uint32_t NTPSyncClock::getSyncDelay(bool success)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    return syncDelay(success);
+}
+
+/**
+ * @brief Define o offset a partir do qual o relógio é ajustado por salto
+ *
+ * @param thresholdMs Offsets menores que esse limite são corrigidos
+ *                    gradualmente (slew), sem saltos no horário.
+ */
+void NTPSyncClock::setStepThreshold(uint32_t thresholdMs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _discipline.setStepThreshold(thresholdMs * 1000);
+}
+
+/**
+ * @brief Aplica a compensação de frequência acumulada desde a última
+ *        chamada.
+ *
+ * Chamada periodicamente pela tarefa de sincronização para que a deriva
+ * estimada do oscilador seja corrigida entre as sincronizações.
+ */
+void NTPSyncClock::disciplineTick()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    int64_t correction = _discipline.tick(_platform.clock->millis());
+    if (correction != 0)
+    {
+        slewClock(correction);
+    }
+}
+
+/**
+ * @brief Substitui os backends de rede, relógio, armazenamento e tarefas
+ *
+ * Por padrão são usados os backends nativos (ntpDefaultPlatform). Deve
+ * ser chamada antes de begin().
+ *
+ * @param platform Backends a usar; os ponteiros devem permanecer válidos.
+ */
+void NTPSyncClock::setPlatform(const NTPPlatform &platform)
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (_job.state != JobState::Idle)
+            finishJob(SyncResult::Cancelled);
+        cancelLookups();
+        _platform = platform;
+        _anchored = false; // O ponto de sincronização era do relógio anterior
+        if (systemDomain())
+            NTPLog::setClock(platform.clock);
+        publishStatus();
+    }
+    deliverCompleted();
+}
+
+/**
+ * @brief Define por quanto tempo um endereço resolvido fica em cache
+ *
+ * Vale quando o backend não informa o TTL do registro DNS, o que
+ * acontece tanto no lwIP quanto com getaddrinfo(). Após o prazo, o
+ * endereço continua sendo usado enquanto é renovado em segundo plano.
+ *
+ * @param ttlSec Segundos, entre NTP_DNS_MIN_TTL_S e NTP_DNS_MAX_TTL_S.
+ */
+void NTPSyncClock::setDnsTtl(uint32_t ttlSec)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _dnsTtl = std::min(std::max(ttlSec, NTP_DNS_MIN_TTL_S), NTP_DNS_MAX_TTL_S);
+}
+
+/**
+ * @brief Limita a taxa de pedidos a cada servidor (token bucket)
+ *
+ * @details
+ *     Cada servidor acumula até burst pedidos, recarregados um a cada
+ *     intervalMs. Sem pedido disponível, o servidor é pulado na rodada,
+ *     como se não estivesse resolvido. Um KoD RATE dobra o intervalo
+ *     daquele servidor, mesmo com o limite desligado.
+ *
+ * @param intervalMs Intervalo médio mínimo entre pedidos; 0 desliga.
+ * @param burst Pedidos seguidos permitidos (retentativas), no mínimo 1.
+ */
+void NTPSyncClock::setRateLimit(uint32_t intervalMs, uint8_t burst)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _rateIntervalMs = intervalMs;
+    _rateBurst = std::max<uint8_t>(burst, 1);
+    for (auto &server : _timeval.servers)
+    {
+        server.tokens = std::min(server.tokens, _rateBurst);
+    }
+}
+
+/**
+ * @brief Espalha as sincronizações periódicas no tempo
+ *
+ * @details
+ *     Cada agendamento é antecipado por um valor aleatório de até
+ *     percent% do intervalo, e a primeira sincronização após begin() é
+ *     adiada por até startupSpreadMs. Dispositivos que reiniciam juntos
+ *     após uma queda de energia deixam de consultar os servidores em
+ *     sincronia.
+ *
+ * @param percent Antecipação máxima, de 0 (desligado) a 50.
+ * @param startupSpreadMs Atraso máximo da primeira sincronização.
+ */
+void NTPSyncClock::setScheduleJitter(uint8_t percent, uint32_t startupSpreadMs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _jitterPercent = std::min<uint8_t>(percent, 50);
+    _startupSpreadMs = startupSpreadMs;
+}
+
+/**
+ * @brief Define o intervalo entre gravações do estado sem mudança relevante
+ *
+ * Endereços novos e mudanças de deriva são gravados logo após a
+ * sincronização; o horário da última sincronização e o ponto de warm
+ * start, só uma vez por boot e depois a cada intervalo.
+ *
+ * @param interval Intervalo em minutos (padrão 360).
+ */
+void NTPSyncClock::setPersistInterval(uint32_t interval)
+{
+    _store.setInterval(interval * MINUTES_TO_MS);
+}
+
+/**
+ * @brief Grava o estado imediatamente, mesmo sem mudança relevante
+ *
+ * Útil antes de deep sleep, para que o warm start do próximo boot parta
+ * do erro atual. Bloqueia pelo tempo da escrita na flash, sem _mutex.
+ *
+ * @return false se a gravação falhar.
+ */
+bool NTPSyncClock::saveState()
+{
+    NTPStateRecord record;
+    NTPStorage *storage;
+    uint32_t now;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        snapshotState(record);
+        storage = _platform.storage;
+        now = _platform.clock->millis();
+        _persistPending = false;
+    }
+    return _store.write(storage, record, now);
+}
+
+/**
+ * @brief Define o tempo máximo de espera por uma resposta NTP
+ *
+ * @param timeoutMs Timeout por pacote em milissegundos. Um servidor que não
+ *                  responde custa no máximo esse tempo por tentativa.
+ */
+void NTPSyncClock::setPacketTimeout(uint16_t timeoutMs)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    _packetTimeout = timeoutMs;
+}
+
+/**
+ * @brief Liga o modo servidor: responde pedidos NTP da rede local
+ *
+ * @details
+ *     As respostas saem do relógio disciplinado, com stratum um acima do
+ *     par do sistema e o atraso e a dispersão até a referência primária
+ *     acumulados (RFC 5905 §7.3). Antes da primeira sincronização pelo
+ *     NTP, as respostas levam leap = 3 e stratum 0, que os clientes
+ *     descartam.
+ *
+ *     Os pedidos são lidos em lotes de até NTP_SERVER_BATCH e respondidos
+ *     no próprio buffer pré-alocado, sem alocação nem _mutex por pacote.
+ *     Uma tarefa própria conduz o servidor; se a plataforma não criar
+ *     tarefas auxiliares, a aplicação deve chamar serveRequests() no seu
+ *     laço.
+ *
+ * @param port Porta UDP; 0 escolhe uma livre (ver getServerPort()).
+ *
+ * @return false se o socket não puder ser aberto ou o servidor já
+ *         estiver ativo.
+ */
+bool NTPSyncClock::startServer(uint16_t port)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_serverState.load() != ServerStopped)
+        return false;
+    if (!_platform.network->listen(port))
+    {
+        NTP_LOGE("Falha ao abrir a porta %u do modo servidor", port);
+        return false;
+    }
+
+    _serverPort = port;
+    _serverState.store(ServerRunning);
+    _serverTask = _platform.tasking->spawn(serverTask, "NTPServerTask", 4096, this, 2);
+    NTP_LOGI("Modo servidor na porta %u", port);
+    return true;
+}
+
+/**
+ * @brief Desliga o modo servidor e fecha o socket
+ *
+ * Espera a tarefa do servidor terminar o lote em andamento, no máximo
+ * NTP_SERVER_POLL_MS.
+ */
+void NTPSyncClock::stopServer()
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    uint8_t running = ServerRunning;
+    if (!_serverState.compare_exchange_strong(running, ServerStopping))
+        return;
+    while (_serverTask && _serverState.load() != ServerStopped)
+    {
+        _platform.clock->sleepMs(1);
+    }
+    _serverState.store(ServerStopped);
+    _serverTask = false;
+    _platform.network->unlisten();
+    _serverPort = 0;
+}
+
+bool NTPSyncClock::isServerRunning()
+{
+    return _serverState.load(std::memory_order_relaxed) == ServerRunning;
+}
+
+/**
+ * @brief Porta do modo servidor, ou 0 se desligado
+ */
+uint16_t NTPSyncClock::getServerPort()
+{
+    return isServerRunning() ? _serverPort : 0;
+}
+
+/**
+ * @brief Responde um lote de pedidos do modo servidor
+ *
+ * @details
+ *     Espera por no máximo timeoutMs, lê o que houver na fila e responde
+ *     todos os pedidos válidos de uma vez. t2 é lido uma vez por lote e
+ *     t3 logo antes do envio. Só deve ser chamada pela aplicação quando
+ *     a tarefa do servidor não puder ser criada; nunca adquire _mutex.
+ *
+ * @return Respostas enviadas.
+ */
+size_t NTPSyncClock::serveRequests(uint32_t timeoutMs)
+{
+    if (_serverState.load(std::memory_order_acquire) != ServerRunning)
+        return 0;
+
+    int received = _platform.network->receiveBatch(_serveBatch, NTP_SERVER_BATCH, timeoutMs);
+    if (received <= 0)
+        return 0;
+
+    uint64_t t2 = ntpTime();
+    int64_t monotonicUs = _platform.clock->monotonicUs();
+    ServeState state = _serve.read();
+
+    // Compacta as respostas no início do lote
+    size_t replies = 0;
+    for (int i = 0; i < received; i++)
+    {
+        if (!buildReply(_serveBatch[i], state, t2, monotonicUs))
+            continue;
+        if ((size_t)i != replies)
+            _serveBatch[replies] = _serveBatch[i];
+        replies++;
+    }
+    _serveRequests.fetch_add((uint32_t)received, std::memory_order_relaxed);
+    _serveDropped.fetch_add((uint32_t)(received - replies), std::memory_order_relaxed);
+    if (replies == 0)
+        return 0;
+
+    uint64_t t3 = ntpTime();
+    for (size_t i = 0; i < replies; i++)
+    {
+        NTPPacket::setTransmitTs(_serveBatch[i].data, t3);
+    }
+    int sent = _platform.network->sendBatch(_serveBatch, replies);
+    if (sent <= 0)
+        return 0;
+    _serveReplies.fetch_add((uint32_t)sent, std::memory_order_relaxed);
+    return (size_t)sent;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Ordena os servidores NTP por performance
+ *
+ * @details
+ *     Essa função ordena os servidores NTP por performance,
+ *     priorizando servidores resolvidos e não rebaixados por KoD e, entre
+ *     eles, os de menor distância de sincronização calculada pelo filtro
+ *     de relógio.
+ *     Servidores ainda sem amostras ficam depois dos já medidos.
+ */
+void NTPSyncClock::sortServersByPerformance()
+{
+    uint32_t now = _platform.clock->millis();
+    std::sort(_timeval.servers.begin(), _timeval.servers.end(),
+              [now](const NTPServer &a, const NTPServer &b)
+              {
+                  bool usableA = a.resolved && !a.demoted;
+                  bool usableB = b.resolved && !b.demoted;
+                  if (usableA != usableB)
+                      return usableA;
+                  if (a.filter.valid() != b.filter.valid())
+                      return a.filter.valid();
+                  if (a.filter.valid())
+                      return a.filter.rootDistanceUs(now) < b.filter.rootDistanceUs(now);
+                  return a.lastResponseTime < b.lastResponseTime;
+              });
+}
+
+/**
+ * @brief Inicia as consultas DNS dos servidores sem endereço ou expirados
+ *
+ * @details
+ *     Todas as consultas são iniciadas de uma vez e correm em paralelo no
+ *     backend de rede. Servidores com IP numérico nunca são consultados e
+ *     uma consulta que falhou só é repetida após NTP_DNS_MIN_TTL_S.
+ *
+ * @param now millis() atual.
+ */
+void NTPSyncClock::startLookups(uint32_t now)
+{
+    for (auto &server : _timeval.servers)
+    {
+        if (server.numeric || server.dnsQuery >= 0 || (int32_t)(now - server.expiresMs) < 0)
+            continue;
+
+        int query = _platform.network->resolveStart(server.hostname);
+        if (query < 0)
+            continue; // Sem consultas livres: tenta de novo no próximo passo
+
+        server.dnsQuery = (int8_t)query;
+        server.dnsStartMs = now;
+        _dnsPending++;
+
+        NTP_LOGD("Resolvendo %s...", server.hostname);
+    }
+}
+
+/**
+ * @brief Coleta os resultados das consultas DNS em andamento
+ *
+ * @details
+ *     O endereço fica em cache pelo TTL informado pelo backend ou, se
+ *     desconhecido, por _dnsTtl. Quando o IP muda, o histórico do filtro
+ *     de relógio e as restrições de KoD são descartados, já que pertencem
+ *     a outra máquina. Consultas
+ *     sem resposta após NTP_DNS_TIMEOUT_MS são abandonadas.
+ *
+ * @param now millis() atual.
+ */
+void NTPSyncClock::pollLookups(uint32_t now)
+{
+    for (auto &server : _timeval.servers)
+    {
+        if (server.dnsQuery < 0)
+            continue;
+
+        NTPAddress address = server.address;
+        uint32_t ttlSec = 0;
+        int result = _platform.network->resolveResult(server.dnsQuery, address, ttlSec);
+        if (result == 0)
+        {
+            if (now - server.dnsStartMs < NTP_DNS_TIMEOUT_MS)
+                continue;
+            _platform.network->resolveCancel(server.dnsQuery);
+            result = -1;
+        }
+
+        server.dnsQuery = -1;
+        _dnsPending--;
+        _counters.dnsLookups++;
+        _counters.dnsLatency.record((uint64_t)(now - server.dnsStartMs) * 1000);
+        publishMetrics();
+
+        if (result < 0)
+        {
+            _counters.dnsFailures++;
+            server.expiresMs = now + NTP_DNS_MIN_TTL_S * 1000;
+            NTP_LOGW("Falha ao resolver %s", server.hostname);
+            continue;
+        }
+
+        if (ttlSec == 0)
+            ttlSec = _dnsTtl;
+        ttlSec = std::min(std::max(ttlSec, NTP_DNS_MIN_TTL_S), NTP_DNS_MAX_TTL_S);
+
+        if (!server.resolved || address != server.address)
+        {
+            server.filter = ClockFilter();
+            server.failureCount = 0;
+            server.demoted = false;
+            server.rateIntervalMs = 0;
+        }
+        server.address = address;
+        server.resolved = true;
+        server.expiresMs = now + ttlSec * 1000;
+        NTP_LOGI("Resolvido %s → %s (TTL %lu s)", server.hostname, server.address, ttlSec);
+    }
+}
+
+/**
+ * @brief Abandona as consultas DNS em andamento
+ */
+void NTPSyncClock::cancelLookups()
+{
+    for (auto &server : _timeval.servers)
+    {
+        if (server.dnsQuery >= 0)
+        {
+            _platform.network->resolveCancel(server.dnsQuery);
+            server.dnsQuery = -1;
+        }
+    }
+    _dnsPending = 0;
+}
+
+/**
+ * @brief Monta o registro persistente com o estado atual.
+ *
+ * O registro guarda o timestamp da última sincronização, a deriva do
+ * oscilador, quando já estimada, e os endereços resolvidos. Se a
+ * plataforma tiver um relógio RTC, guarda também o par UTC/RTC e o erro
+ * máximo atuais, usados por warmStart() no próximo boot.
+ *
+ * Deve ser chamada com _mutex adquirido; a gravação fica para
+ * NTPStateStore::write(), fora do lock.
+ */
+void NTPSyncClock::snapshotState(NTPStateRecord &record)
+{
+    memset(&record, 0, sizeof(record));
+    record.lastSync = (uint32_t)_timeval.lastSync;
+    if (_discipline.frequencyKnown())
+    {
+        record.flags |= NTPStateRecord::HasDrift;
+        record.driftPpm = (float)_discipline.frequencyPpm();
+    }
+
+    int64_t rtcUs;
+    if (_errorUs != NTP_ERROR_UNKNOWN && _platform.clock->rtcUs(rtcUs))
+    {
+        NTPStatus status;
+        struct timeval tv;
+        _platform.clock->now(tv);
+        status.monotonicBaseUs = _errorBaseUs;
+        status.maxErrorUs = _errorUs;
+        status.errorPpm = NTP_PHI_PPM;
+
+        record.flags |= NTPStateRecord::HasWarm;
+        record.warmUtcUs = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+        record.warmRtcUs = rtcUs;
+        record.warmErrorUs = status.errorUs(_platform.clock->monotonicUs());
+    }
+    saveAddresses(record);
+}
+
+/**
+ * @brief Carrega o estado da sincroniza o de tempo do Preferences.
+ *
+ * Carrega o timestamp da última sincronização, a deriva do oscilador e
+ * os endereços do registro mais recente. Com o relógio RTC ainda válido,
+ * o horário atual é extrapolado por warmStart(); caso contrário, o tempo
+ * do sistema só é alterado se estiver atrás do último horário salvo. Com
+ * a deriva restaurada, a compensação de frequência começa antes da
+ * primeira sincronização.
+ *
+ * Sem registro válido, lê as chaves "lastSync" e "drift" gravadas por
+ * versões anteriores.
+ */
+void NTPSyncClock::loadTimeFromPrefs()
+{
+    NTPStorage *prefs = _platform.storage;
+    NTPStateRecord record;
+    bool loaded = _store.load(prefs, record);
+    if (!loaded)
+    {
+        memset(&record, 0, sizeof(record));
+        std::lock_guard<std::mutex> storageGuard(NTPStateStore::storageLock());
+        prefs->begin(_store.name(), true);
+        record.lastSync = prefs->getU32("lastSync", 0);
+        if (prefs->isKey("drift"))
+        {
+            record.flags |= NTPStateRecord::HasDrift;
+            record.driftPpm = prefs->getFloat("drift", 0);
+        }
+        prefs->end();
+    }
+
+    _timeval.lastSync = record.lastSync;
+    if (record.flags & NTPStateRecord::HasDrift)
+    {
+        _discipline.setFrequency(record.driftPpm);
+    }
+    applyTimezone();
+
+    if (!warmStart(record) && _timeval.lastSync > 0)
+    {
+        // Só avança o relógio: um RTC que manteve a hora não volta para lastSync
+        time_t now = currentTime();
+        if (now < _timeval.lastSync)
+        {
+            _platform.clock->step((int64_t)(_timeval.lastSync - now) * 1000000LL);
+            NTP_LOGI("Hora carregada das preferências: %lld", (long long)_timeval.lastSync);
+        }
+        if (_source == NTPTimeSource::None)
+            _source = NTPTimeSource::Saved;
+    }
+    loadAddresses(record);
+    updateDstStatus(currentTime());
+    publishStatus();
+}
+
+/**
+ * @brief Extrapola o horário atual a partir do estado salvo
+ *
+ * @details
+ *     O tempo decorrido desde a gravação do registro vem do relógio RTC,
+ *     corrigido pela deriva estimada do oscilador (o RTC é calibrado pelo
+ *     cristal principal e herda seu erro). O erro máximo é o erro salvo
+ *     mais a tolerância do RTC e PHI pelo tempo decorrido.
+ *
+ *     O relógio do sistema só é ajustado se estiver fora do intervalo de
+ *     confiança, o que preserva a hora mantida pelo sistema em deep sleep.
+ *
+ * @return false se o registro não tiver o ponto de warm start ou o relógio
+ *         RTC tiver sido zerado desde então.
+ */
+bool NTPSyncClock::warmStart(const NTPStateRecord &record)
+{
+    int64_t rtcUs;
+    if (!(record.flags & NTPStateRecord::HasWarm) || !_platform.clock->rtcUs(rtcUs))
+        return false;
+    if (rtcUs < record.warmRtcUs)
+        return false;
+
+    double elapsedUs = (double)(rtcUs - record.warmRtcUs);
+    int64_t utcUs = record.warmUtcUs + (int64_t)(elapsedUs * (1.0 + _discipline.frequencyPpm() / 1e6));
+    double errorUs = record.warmErrorUs +
+                     elapsedUs * (_platform.clock->rtcTolerancePpm() + NTP_PHI_PPM) / 1e6;
+
+    _source = NTPTimeSource::WarmStart;
+    _errorUs = (uint32_t)std::min(errorUs, (double)(NTP_ERROR_UNKNOWN - 1));
+    _errorBaseUs = _platform.clock->monotonicUs();
+
+    struct timeval tv;
+    _platform.clock->now(tv);
+    int64_t deltaUs = utcUs - ((int64_t)tv.tv_sec * 1000000LL + tv.tv_usec);
+    if ((uint64_t)std::llabs(deltaUs) > _errorUs)
+        _platform.clock->step(deltaUs);
+
+    NTP_LOGI("Warm start: %lld s desde o último registro, erro ±%lu ms",
+             (long long)(elapsedUs / 1e6), _errorUs / 1000);
+    return true;
+}
+
+/**
+ * @brief Copia os endereços resolvidos dos servidores para o registro
+ *
+ * Cada entrada guarda o hash do hostname, o IP e o instante UTC em que o
+ * endereço expira.
+ */
+void NTPSyncClock::saveAddresses(NTPStateRecord &record)
+{
+    uint32_t now = _platform.clock->millis();
+    time_t utc = currentTime();
+
+    for (const auto &server : _timeval.servers)
+    {
+        if (record.addressCount >= NTP_STATE_MAX_ADDRESSES)
+            break;
+        if (server.numeric || !server.resolved)
+            continue;
+
+        int32_t remainingMs = (int32_t)(server.expiresMs - now);
+        NTPStateRecord::Address &entry = record.addresses[record.addressCount++];
+        entry.hostHash = hostnameHash(server.hostname);
+        entry.family = (uint8_t)server.address.family;
+        memcpy(entry.ip, server.address.ip, sizeof(entry.ip));
+        entry.expiresUtc = (uint32_t)(utc + std::max(remainingMs, (int32_t)0) / 1000);
+    }
+}
+
+/**
+ * @brief Restaura os endereços salvos por saveAddresses()
+ *
+ * @details
+ *     Permite que a primeira sincronização após o boot vá direto a um IP
+ *     que já respondeu, sem esperar o DNS. Endereços já expirados também
+ *     são restaurados: são usados enquanto a renovação corre em segundo
+ *     plano. Deve ser chamada com o relógio já restaurado.
+ */
+void NTPSyncClock::loadAddresses(const NTPStateRecord &record)
+{
+    uint32_t now = _platform.clock->millis();
+    time_t utc = currentTime();
+
+    for (uint8_t i = 0; i < record.addressCount; i++)
+    {
+        const NTPStateRecord::Address &entry = record.addresses[i];
+        for (auto &server : _timeval.servers)
+        {
+            if (server.numeric || server.resolved || hostnameHash(server.hostname) != entry.hostHash)
+                continue;
+
+            int64_t remaining = std::min((int64_t)entry.expiresUtc - utc, (int64_t)NTP_DNS_MAX_TTL_S);
+            server.address.family = entry.family <= (uint8_t)NTPFamily::IPv6 ? (NTPFamily)entry.family
+                                                                              : NTPFamily::None;
+            memcpy(server.address.ip, entry.ip, sizeof(entry.ip));
+            server.resolved = server.address.isSet();
+            server.expiresMs = now + (uint32_t)std::max(remaining, (int64_t)0) * 1000;
+            NTP_LOGD("Endereço salvo de %s: %s", server.hostname, server.address);
+        }
+    }
+}
+
+/**
+ * @brief Atualiza o offset UTC e o estado do horário de verão.
+ *
+ * Consulta as regras do fuso configurado (tzdata compilado em
+ * TimeZoneData.cpp) para o instante informado, pelo cache do dia local:
+ * só a primeira chamada do dia ou após uma transição faz a busca.
+ *
+ * @param now Timestamp atual.
+ */
+void NTPSyncClock::updateDstStatus(time_t now)
+{
+    _timeval.utc_offset = _localTime.offsetAt(now, &_timeval.dst_active);
+}
+
+/**
+ * @brief Inicia uma sincronização ou junta um pedido à que está em andamento.
+ *
+ * Deve ser chamada com _mutex adquirido.
+ *
+ * @return false se não houver espaço para mais um callback.
+ */
+bool NTPSyncClock::startJob(uint8_t maxRetries, SyncCallback callback, void *arg,
+                       uint32_t timeoutMs)
+{
+    if (callback != nullptr && _job.state != JobState::Idle &&
+        _job.listenerCount >= NTP_MAX_SYNC_LISTENERS)
+        return false;
+
+    uint32_t now = _platform.clock->millis();
+    if (_job.state == JobState::Idle)
+    {
+        _job.state = JobState::Resolve;
+        _job.mode = _syncMode;
+        _job.maxRetries = maxRetries > 0 ? maxRetries : 1;
+        _job.attempt = 0;
+        _job.server = 0;
+        _job.hasDeadline = false;
+        _job.startMs = now;
+        _job.answered = 0;
+        _job.pending.clear();
+        _job.listenerCount = 0;
+        publishStatus();
+    }
+
+    if (callback != nullptr)
+    {
+        _job.listeners[_job.listenerCount++] = {callback, arg, SyncResult::Failed};
+    }
+
+    // Com vários pedidos, vale o prazo mais curto
+    if (timeoutMs > 0)
+    {
+        uint32_t deadline = now + timeoutMs;
+        if (!_job.hasDeadline || (int32_t)(deadline - _job.deadlineMs) < 0)
+        {
+            _job.deadlineMs = deadline;
+            _job.hasDeadline = true;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Executa um passo da sincronização em andamento.
+ *
+ * @return Tempo até o próximo passo necessário, em milissegundos.
+ */
+uint32_t NTPSyncClock::stepJob()
+{
+    uint32_t now = _platform.clock->millis();
+    if (_job.hasDeadline && (int32_t)(now - _job.deadlineMs) >= 0)
+    {
+        NTP_LOGW("Prazo da sincronização esgotado");
+        finishJob(SyncResult::Timeout);
+        return 0;
+    }
+
+    switch (_job.state)
+    {
+    case JobState::Resolve:
+        return jobResolve();
+    case JobState::Send:
+        return jobSend();
+    case JobState::Receive:
+        return jobReceive();
+    case JobState::Backoff:
+    {
+        uint32_t elapsed = now - _job.waitStartMs;
+        if (elapsed >= _job.waitMs)
+        {
+            _job.state = JobState::Send;
+            return 0;
+        }
+        uint32_t remaining = _job.waitMs - elapsed;
+        if (_job.hasDeadline)
+            remaining = std::min(remaining, _job.deadlineMs - now);
+        return remaining;
+    }
+    default:
+        return 0;
+    }
+}
+
+/**
+ * @brief Verifica a rede, resolve e ordena os servidores e abre o socket.
+ */
+uint32_t NTPSyncClock::jobResolve()
+{
+    if (!_platform.network->connected())
+    {
+        NTP_LOGW("WiFi desconectado");
+        finishJob(SyncResult::NoNetwork);
+        return 0;
+    }
+
+    // Só espera pelo DNS dos servidores sem endereço; os expirados seguem
+    // com o endereço anterior enquanto são renovados
+    uint32_t now = _platform.clock->millis();
+    startLookups(now);
+    pollLookups(now);
+
+    bool resolved = false;
+    for (const auto &server : _timeval.servers)
+    {
+        if (!server.resolved && server.dnsQuery >= 0)
+            return NTP_ASYNC_POLL_MS;
+        resolved |= server.resolved;
+    }
+
+    if (!resolved)
+    {
+        NTP_LOGE("Falha ao resolver servidores NTP");
+        finishJob(SyncResult::DnsFailed);
+        return 0;
+    }
+
+    // Ordena servidores por performance
+    sortServersByPerformance();
+
+    NTP_LOGD("Iniciando sincronização");
+
+    if (!_platform.network->open())
+    {
+        finishJob(SyncResult::Failed);
+        return 0;
+    }
+
+    _job.state = JobState::Send;
+    return 0;
+}
+
+/**
+ * @brief Envia os pedidos da próxima rodada.
+ *
+ * @details
+ *     No modo paralelo envia um pedido para cada servidor resolvido; no
+ *     sequencial, apenas para o servidor da tentativa atual. Servidores
+ *     rebaixados por KoD ou sem pedido disponível no token bucket são
+ *     pulados. As respostas são coletadas por jobReceive() pelo mesmo
+ *     socket.
+ */
+uint32_t NTPSyncClock::jobSend()
+{
+    NTPNetwork *network = _platform.network;
+    uint8_t buf[NTP_PACKET_SIZE];
+    NTPAddress from;
+
+    // Descarta respostas atrasadas de consultas anteriores
+    while (network->receive(buf, sizeof(buf), from, 0) > 0)
+    {
+    }
+
+    _job.pending.clear();
+    _job.answered = 0;
+    bool sendFailed = false;
+
+    uint32_t now = _platform.clock->millis();
+    size_t first = (_job.mode == SyncMode::Parallel) ? 0 : _job.server;
+    for (size_t i = first; i < _timeval.servers.size(); i++)
+    {
+        NTPServer &server = _timeval.servers[i];
+        if (!server.resolved || server.demoted)
+            continue;
+        if (!takeToken(server, now))
+        {
+            if (NTPServerMetrics *metrics = serverMetrics(server))
+                metrics->throttled++;
+            NTP_LOGD("Limite de taxa atingido para %s", server.hostname);
+            continue;
+        }
+
+        if (_job.mode == SyncMode::Sequential)
+        {
+            NTP_LOGD("Attempt %d with server: %s", _job.attempt + 1, server.hostname);
+        }
 
-// ----------------------------------------------------
-//
-//               Funções Públicas
-//
-// ----------------------------------------------------
+        // O pedido leva um timestamp aproximado, que só identifica a
+        // resposta; t1 é o instante da transmissão medido pelo backend
+        uint64_t origin = ntpTime();
+        NTPPacket::request(origin).encode(buf);
+        int64_t txMonotonicUs;
+        bool sent = network->sendStamped(server.address, buf, sizeof(buf), txMonotonicUs);
+        uint64_t t1 = ntpTimeAt(txMonotonicUs);
+        if (NTPServerMetrics *metrics = serverMetrics(server))
+            metrics->requests++;
+        if (!sent)
+            sendFailed = true;
 
-void NTPSync::logControl(bool enabled)
-{
-    _logEnabled = enabled;
+        // No modo sequencial, uma falha de envio conta como tentativa sem
+        // resposta
+        if (sent || _job.mode == SyncMode::Sequential)
+        {
+            _job.pending.push_back({&server, origin, t1, false, false});
+        }
+
+        if (_job.mode == SyncMode::Sequential)
+        {
+            if (i != _job.server)
+                _job.attempt = 0;
+            _job.server = i;
+            break;
+        }
+    }
+
+    if (_job.pending.empty())
+    {
+        finishJob(SyncResult::Failed);
+        return 0;
+    }
+
+    size_t count = _job.pending.size();
+    _job.quorum = (_job.mode == SyncMode::Parallel && _quorum > 0)
+                      ? (uint8_t)std::min<size_t>(_quorum, count)
+                      : 0;
+    _job.state = JobState::Receive;
+    _job.waitStartMs = _platform.clock->millis();
+    if (sendFailed && _job.mode == SyncMode::Sequential)
+        _job.waitStartMs -= _packetTimeout;
+    return 0;
 }
 
 /**
- * @brief Inicializa a classe NTPSync
- *
- * Carrega o estado da sincroniza o de tempo do Preferences e inicializa a
- * tarefa de sincroniza o de tempo.
+ * @brief Coleta respostas até todas chegarem, o quorum ou o timeout.
  *
- * @param syncInterval INTERVALO DE TEMPO (em minutos) entre solicita es
- *                     de sincroniza o de tempo com o servidor NTP.
- * @param retryInterval INTERVALO DE TEMPO (em minutos) entre tentativas
- *                     de sincroniza o de tempo com o servidor NTP.
+ * @details
+ *     Cada chamada espera no máximo NTP_ASYNC_POLL_MS por um datagrama,
+ *     para que cancelamentos e novos pedidos sejam atendidos rápido. t4 é
+ *     o instante de chegada informado pelo backend (timestamp do kernel
+ *     ou do lwIP), sem a espera até a tarefa acordar.
  */
-void NTPSync::begin(uint32_t syncInterval, uint32_t retryInterval)
+uint32_t NTPSyncClock::jobReceive()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    uint32_t elapsed = _platform.clock->millis() - _job.waitStartMs;
+    bool quorumReached = _job.quorum > 0 && _job.answered >= _job.quorum;
+    if (elapsed >= _packetTimeout || _job.answered >= _job.pending.size() || quorumReached)
+    {
+        jobEvaluate();
+        return 0;
+    }
 
-    _syncInterval = syncInterval * MINUTES_TO_MS;
-    _retryInterval = retryInterval * MINUTES_TO_MS;
+    uint8_t buf[NTP_PACKET_SIZE];
+    NTPAddress from;
+    uint32_t waitMs = std::min<uint32_t>(_packetTimeout - elapsed, NTP_ASYNC_POLL_MS);
+    int64_t rxMonotonicUs;
+    int len = _platform.network->receiveStamped(buf, sizeof(buf), from, waitMs, rxMonotonicUs);
+    if (len < 0)
+    {
+        jobEvaluate();
+        return 0;
+    }
+    if (len == 0)
+        return 0;
 
-    loadTimeFromPrefs();
-    startTask();
+    uint64_t t4 = ntpTimeAt(rxMonotonicUs);
+    NTPPacket reply;
+    if (!reply.decode(buf, (size_t)len))
+        return 0;
+
+    for (auto &p : _job.pending)
+    {
+        if (p.answered || p.server->address != from)
+            continue;
+        if (!validateReply(reply, p.origin))
+        {
+            // Só conta respostas a este pedido; as demais podem ser de
+            // outro servidor no mesmo endereço
+            if (reply.originTs != p.origin)
+                continue;
+            p.rejected = true;
+            if (reply.stratum == 0)
+                handleKiss(*p.server, reply.referenceId, _platform.clock->millis());
+            if (NTPServerMetrics *metrics = serverMetrics(*p.server))
+            {
+                if (reply.stratum == 0)
+                    metrics->kod++;
+                else
+                    metrics->rejected++;
+            }
+            continue;
+        }
+
+        recordSample(*p.server, NTPSample::fromExchange(reply, p.t1, t4));
+        p.server->failureCount = 0;
+        p.answered = true;
+        _job.answered++;
+        break;
+    }
+    return 0;
 }
 
 /**
- * @brief Tenta sincronizar o tempo com os servidores NTP
- *
- * Primeiramente, resolve todos os servidores NTP configurados e ordena-os
- * por performance. Em seguida, tenta sincronizar o tempo com cada servidor
- * NTP, em ordem de performance. Caso uma tentativa falhe, aumenta o
- * intervalo entre tentativas com um backoff exponencial.
+ * @brief Aplica o resultado de uma rodada de consultas.
  *
- * @param maxRetries Número máximo de tentativas por servidor NTP
- *
- * @return true se o tempo for sincronizado, false caso contrário
+ * @details
+ *     No modo paralelo, o offset vem da seleção e combinação entre todos
+ *     os servidores (selectAndApply), que descarta falsetickers. No
+ *     sequencial, vem do filtro do servidor que respondeu; sem resposta, a
+ *     próxima tentativa acontece após o backoff exponencial.
  */
-bool NTPSync::syncTime(uint8_t maxRetries)
+void NTPSyncClock::jobEvaluate()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    if (WiFi.status() != WL_CONNECTED)
+    uint32_t now = _platform.clock->millis();
+    for (auto &p : _job.pending)
     {
-        if (_logEnabled)
-        {
-            // Serial0.printf("[NTP Sync] WiFi desconectado\n");
-        }
-        _timeSyncked = false;
-        return false;
+        if (p.answered)
+            continue;
+        NTPServerMetrics *metrics = serverMetrics(*p.server);
+        if (metrics != nullptr && !p.rejected)
+            metrics->timeouts++;
+
+        // Endereço que parou de responder (ex.: rotação do pool): renova
+        // o DNS antes de o TTL expirar
+        if (++p.server->failureCount >= NTP_DNS_MAX_FAILURES && !p.server->numeric &&
+            (int32_t)(now - p.server->expiresMs) < 0)
+            p.server->expiresMs = now;
     }
 
-    // Resolve todos os servidores uma vez
-    if (!resolveAllServers())
+    if (_job.mode == SyncMode::Parallel)
     {
-        if (_logEnabled)
-        {
-            // Serial0.printf("Falha ao resolver servidores NTP\n");
-        }
-        return false;
+        SyncResult result = SyncResult::Failed;
+        if (_job.answered > 0 && (_job.quorum == 0 || _job.answered >= _job.quorum))
+            result = selectAndApply();
+        if (result == SyncResult::Success)
+            NTP_LOGI("%u/%u servidores responderam, offset %lld us, jitter %lu us", _job.answered,
+                     _job.pending.size(), _offsetUs, _jitterUs);
+        finishJob(result);
+        return;
     }
 
-    // Ordena servidores por performance
-    sortServersByPerformance();
+    NTPServer &server = _timeval.servers[_job.server];
+    if (_job.answered > 0 && !server.filter.fresh())
+    {
+        // O servidor respondeu, mas o filtro ainda escolhe uma amostra
+        // anterior à última correção: o relógio segue como está e a
+        // próxima consulta sai no intervalo normal, ao mesmo servidor
+        NTP_LOGI("Nenhuma amostra nova de %s desde a última correção", server.hostname);
+        finishJob(SyncResult::Unchanged);
+        return;
+    }
+    if (_job.answered > 0)
+    {
+        _jitterUs = server.filter.jitterUs();
+        correctClock(server.filter.offsetUs(), server.filter.maxErrorUs(_platform.clock->millis()),
+                     server);
+
+        time_t now = currentTime();
+        _localTime.toLocal(now, _timeinfo);
+        NTP_LOGI("Time synchronized successfully with %s (offset %lld us)", server.hostname,
+                 server.lastOffsetUs);
+        finishJob(SyncResult::Success);
+        return;
+    }
 
-    if (_logEnabled)
+    NTP_LOGW("Failed to get time from NTP");
+
+    if (++_job.attempt >= _job.maxRetries)
     {
-        // Serial0.printf("Iniciando sincronização\n");
+        _job.attempt = 0;
+        _job.server++;
     }
 
-    for (auto &server : _timeval.servers)
+    bool remaining = false;
+    for (size_t i = _job.server; i < _timeval.servers.size() && !remaining; i++)
     {
-        if (!server.resolved)
-            continue;
-        for (uint8_t attempt = 0; attempt < maxRetries; attempt++)
-        {
-            if (_logEnabled)
-            {
-                // Serial0.printf("Attempt %d with server: %s (%s)\n", attempt + 1, server.hostname.c_str(), server.ip.c_str());
-            }
+        remaining = _timeval.servers[i].resolved && !_timeval.servers[i].demoted;
+    }
+    if (!remaining)
+    {
+        finishJob(SyncResult::Failed);
+        return;
+    }
 
-            if (syncWithServer(server))
-            {
-                _timeSyncked = true;
-                _timeval.lastSync = time(nullptr);
-                server.failureCount = 0;
-                saveTimeToPrefs();
+    _job.state = JobState::Backoff;
+    _job.waitStartMs = _platform.clock->millis();
+    _job.waitMs = getExponentialBackoffDelay(server.failureCount);
+}
 
-                return true;
-            }
-            server.failureCount++;
-            uint32_t delayMs = getExponentialBackoffDelay(server.failureCount);
-            delay(delayMs);
-        }
+/**
+ * @brief Encerra a sincronização, publica o resultado e agenda a próxima.
+ *
+ * @details
+ *     Os callbacks ficam em _completed e são chamados por
+ *     deliverCompleted() depois que _mutex é liberado.
+ */
+void NTPSyncClock::finishJob(SyncResult result)
+{
+    if (_job.state == JobState::Idle)
+        return;
+    if (_job.state != JobState::Resolve)
+        _platform.network->close();
+
+    _job.state = JobState::Idle;
+    _job.pending.clear();
+    uint32_t now = _platform.clock->millis();
+
+    switch (result)
+    {
+    case SyncResult::Success:
+        _timeSyncked = true;
+        _timeval.lastSync = currentTime();
+        updateDstStatus(_timeval.lastSync);
+        _persistPending = true;
+        _persistMarkMs = now;
+        _counters.syncSuccess++;
+        _counters.syncDuration.record((uint64_t)(now - _job.startMs) * 1000);
+        _counters.everSynced = true;
+        _counters.lastSyncMs = now;
+        break;
+    case SyncResult::Failed:
+    case SyncResult::NoNetwork:
+        NTP_LOGE("Todos os servidores falharam");
+        _timeSyncked = false;
+        if (result == SyncResult::Failed)
+            _counters.syncFailed++;
+        else
+            _counters.syncNoNetwork++;
+        break;
+    case SyncResult::DnsFailed:
+        _counters.syncDnsFailed++;
+        break;
+    case SyncResult::Timeout:
+        _counters.syncTimeout++;
+        break;
+    case SyncResult::Cancelled:
+        _counters.syncCancelled++;
+        break;
+    case SyncResult::Unchanged:
+        // Sem correção: _timeSyncked e lastSync continuam os da última
+        _counters.syncUnchanged++;
+        break;
     }
+    _counters.offsetUs = _offsetUs;
+    _counters.jitterUs = _jitterUs;
+    publishStatus();
+    publishMetrics();
 
-    if (_logEnabled)
+    if (_scheduled)
     {
-        // Serial0.printf("Todos os servidores falharam\n");
+        bool answered = result == SyncResult::Success || result == SyncResult::Unchanged;
+        uint32_t delay = jitterDelay(syncDelay(answered));
+        _nextSyncMs = _platform.clock->millis() + delay;
     }
-    _timeSyncked = false;
 
-    return false;
+    for (uint8_t i = 0; i < _job.listenerCount; i++)
+    {
+        if (_completedCount < sizeof(_completed) / sizeof(_completed[0]))
+        {
+            _completed[_completedCount] = _job.listeners[i];
+            _completed[_completedCount++].result = result;
+        }
+    }
+    _job.listenerCount = 0;
 }
 
 /**
- * @brief Verifica se o tempo foi sincronizado com sucesso
- *
- * @return true se o tempo estiver sincronizado, false caso contrário
+ * @brief Chama os callbacks das sincronizações concluídas, sem _mutex.
  */
-bool NTPSync::isTimeSynced()
+void NTPSyncClock::deliverCompleted()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _timeSyncked;
+    SyncListener done[sizeof(_completed) / sizeof(_completed[0])];
+    uint8_t count;
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        count = _completedCount;
+        std::copy(_completed, _completed + count, done);
+        _completedCount = 0;
+    }
+    if (count == 0)
+        return;
+
+    NTPStatus status = _status.read();
+    for (uint8_t i = 0; i < count; i++)
+    {
+        done[i].callback(done[i].result, status, done[i].arg);
+    }
 }
 
-bool NTPSync::hasTimeval()
+/**
+ * @brief Tempo até a próxima sincronização periódica (sem lock).
+ */
+uint32_t NTPSyncClock::syncDelay(bool success)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return isTimeSynced() || _timeval.lastSync > 0;
+    if (!success)
+        return _retryInterval;
+    if (_adaptivePoll && _discipline.pollIntervalMs() > 0)
+        return _discipline.pollIntervalMs();
+    return _syncInterval;
 }
 
-time_t NTPSync::getLastTimeSync()
+/**
+ * @brief Grava no servidor os dados de uma resposta válida.
+ */
+void NTPSyncClock::recordSample(NTPServer &server, const NTPSample &sample)
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    return _timeval.lastSync;
+    server.lastResponseTime = (uint32_t)(sample.delayUs / 1000);
+    server.stratum = sample.stratum;
+    server.leap = sample.leap;
+    server.lastOffsetUs = sample.offsetUs;
+    server.rootDispersionUs = sample.rootDispersionUs;
+    server.filter.add(sample, _platform.clock->millis());
+
+    if (NTPServerMetrics *metrics = serverMetrics(server))
+    {
+        metrics->replies++;
+        metrics->offsetUs = server.filter.offsetUs();
+        metrics->jitterUs = server.filter.jitterUs();
+        metrics->stratum = sample.stratum;
+        metrics->rtt.record((uint64_t)std::max<int64_t>(sample.delayUs, 0));
+        metrics->offset.record((uint64_t)std::llabs(sample.offsetUs));
+    }
 }
 
 /**
- * @brief Define o fuso horário e servidores NTP para sincronização de tempo
+ * @brief Seleciona os servidores confiáveis e corrige o relógio.
  *
- * @param timezone Fuso horário do local (ex. "America/Sao_Paulo")
- * @param ntpServers Vetor de servidores NTP para sincroniza o de tempo
- *                   (ex. {"pool.ntp.org", "a.st1.ntp.br", "ntp.cais.rnp.br"})
+ * @details
+ *     Usa a saída do filtro de cada servidor como candidato, descarta os
+ *     falsetickers pelo algoritmo de interseção e aplica a média ponderada
+ *     dos sobreviventes. Todos os filtros votam, mas só os de amostra
+ *     ainda não usada (ClockFilter::fresh()) entram na média.
+ *
+ * @return Failed se não houver maioria concordante; Unchanged se nenhum
+ *         sobrevivente tiver amostra nova, com o relógio intocado.
  */
-void NTPSync::setTimeval(const char *timezone, const std::vector<std::string> &ntpServers)
+NTPSyncClock::SyncResult NTPSyncClock::selectAndApply()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
+    ClockCandidate candidates[NTP_MAX_CANDIDATES];
+    size_t count = 0;
+    uint32_t now = _platform.clock->millis();
 
-    _timeval.time_zone = timezone ? String(timezone) : "";
-    auto it = TIMEZONE_OFFSETS.find(std::string(timezone));
-    _timeval.utc_offset = 0;
-    if (it != TIMEZONE_OFFSETS.end())
+    for (const auto &server : _timeval.servers)
     {
-        _timeval.utc_offset = (it->second) * 3600;
+        if (count >= NTP_MAX_CANDIDATES)
+            break;
+        if (!server.resolved || !server.filter.valid())
+            continue;
+        candidates[count++] = {server.filter.offsetUs(), server.filter.rootDistanceUs(now),
+                               server.filter.jitterUs(), server.filter.stratum(),
+                               server.filter.maxErrorUs(now), server.filter.fresh()};
     }
 
-    _timeval.servers.clear();
+    ClockSelect::Result result;
+    if (!ClockSelect::combine(candidates, count, result))
+    {
+        NTP_LOGW("Sem maioria entre %u servidores", count);
+        return SyncResult::Failed;
+    }
+    if (!result.fresh)
+    {
+        NTP_LOGI("Nenhuma amostra nova entre %u servidores desde a última correção", count);
+        return SyncResult::Unchanged;
+    }
 
-    for (const auto &server : ntpServers)
+    // Par do sistema (RFC 5905 §11.2.3): o de menor distância entre os
+    // que concordam com o resultado, repassado aos clientes do modo servidor
+    const NTPServer *peer = nullptr;
+    uint32_t peerDistance = UINT32_MAX;
+    for (const auto &server : _timeval.servers)
     {
-        _timeval.servers.push_back({
-            String(server.c_str()), // hostname
-            "",                     // ip
-            false,                  // resolved
-            1000,                   // lastResponseTime
-            0,                      // stratum
-            0                       // failureCount
-        });
+        if (!server.resolved || !server.filter.fresh())
+            continue;
+        uint32_t distance = server.filter.rootDistanceUs(now);
+        if (std::llabs(server.filter.offsetUs() - result.offsetUs) <= (int64_t)distance &&
+            distance < peerDistance)
+        {
+            peer = &server;
+            peerDistance = distance;
+        }
     }
+    if (peer == nullptr)
+        return SyncResult::Failed;
+
+    _jitterUs = result.jitterUs;
+    correctClock(result.offsetUs, result.maxErrorUs, *peer);
+    return SyncResult::Success;
 }
 
 /**
- * @brief Define os intervalos de sincroniza o e retry para a classe NTPSync
+ * @brief Publica o estado atual para os leitores sem lock.
  *
- * @param syncInterval INTERVALO DE TEMPO (em minutos) entre solicita es
- *                     de sincroniza o de tempo com o servidor NTP.
- * @param retryInterval INTERVALO DE TEMPO (em minutos) entre tentativas
- *                     de sincroniza o de tempo com o servidor NTP.
+ * Deve ser chamada com _mutex adquirido, após qualquer alteração em
+ * _timeSyncked, _timeval.lastSync, _offsetUs ou no relógio do sistema.
+ * Também publica o ponto de sincronização de nowMicros().
  */
-void NTPSync::setSyncIntervals(uint32_t syncInterval, uint32_t retryInterval)
+void NTPSyncClock::publishStatus()
 {
-    std::lock_guard<std::mutex> lock(_mutex);
-    _syncInterval = syncInterval * MINUTES_TO_MS;
-    _retryInterval = retryInterval * MINUTES_TO_MS;
-}
+    NTPStatus status;
+    struct timeval tv;
+    _platform.clock->now(tv);
+    status.monotonicBaseUs = _platform.clock->monotonicUs();
+    status.utcBaseUs = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec;
+    status.offsetUs = _offsetUs;
+    status.jitterUs = _jitterUs;
+    status.lastSync = _timeval.lastSync;
+    status.synced = _timeSyncked;
+    status.zone = _timeval.zone;
+    status.syncing = _job.state != JobState::Idle;
+    status.source = _source;
+    status.errorPpm = NTP_PHI_PPM;
+    status.maxErrorUs = NTP_ERROR_UNKNOWN;
+    if (_errorUs != NTP_ERROR_UNKNOWN)
+    {
+        NTPStatus base = status;
+        base.monotonicBaseUs = _errorBaseUs;
+        base.maxErrorUs = _errorUs;
+        status.maxErrorUs = base.errorUs(status.monotonicBaseUs);
+    }
+    _status.write(status);
 
-// ----------------------------------------------------
-//
-//               Funções Privadas
-//
-// ----------------------------------------------------
+    // Sem correção pelo NTP, interpola a partir do relógio da plataforma
+    NTPTimeBase base;
+    base.monotonicBaseUs = _anchored ? _anchorMonoUs : status.monotonicBaseUs;
+    base.utcBaseUs = _anchored ? _anchorUtcUs : status.utcBaseUs;
+    base.errorBaseUs = _errorBaseUs;
+    base.rateFrac = _discipline.frequencyKnown()
+                        ? (int32_t)(_discipline.frequencyPpm() * 4294.967296)
+                        : 0;
+    base.maxErrorUs = _errorUs;
+    base.errorPpm = NTP_PHI_PPM;
+    base.source = _source;
+    _timeBase.write(base);
+}
 
 /**
- * @brief Ordena os servidores NTP por performance
+ * @brief Publica _counters para getMetrics().
  *
- * @details
- *     Essa função ordena os servidores NTP por performance,
- *     priorizando servidores resolvidos e com menor tempo de resposta.
+ * Deve ser chamada com _mutex adquirido, que serializa as escritas.
  */
-void NTPSync::sortServersByPerformance()
+void NTPSyncClock::publishMetrics()
 {
-    std::sort(_timeval.servers.begin(), _timeval.servers.end(),
-              [](const NTPServer &a, const NTPServer &b)
-              {
-                  // Prioriza servidores resolvidos e com menor tempo de resposta
-                  if (a.resolved != b.resolved)
-                      return a.resolved;
-                  return a.lastResponseTime < b.lastResponseTime;
-              });
+    _metrics.write(_counters);
+}
+
+/**
+ * @brief Métricas do servidor, ou nullptr além de NTP_METRICS_MAX_SERVERS.
+ */
+NTPServerMetrics *NTPSyncClock::serverMetrics(const NTPServer &server)
+{
+    if (server.metricsSlot >= _counters.serverCount)
+        return nullptr;
+    return &_counters.servers[server.metricsSlot];
 }
 
 /**
- * @brief Resolve todos os servidores NTP configurados
+ * @brief Corrige o relógio e marca as amostras novas dos filtros como usadas.
  *
  * @details
- *     Essa função resolve todos os servidores NTP configurados
- *     e retorna true se todos os servidores forem resolvidos
- *     com sucesso.
+ *     Após um step, os históricos deixam de ser comparáveis com o relógio
+ *     e os filtros são esvaziados. Após um slew não há o que descontar:
+ *     a correção é aplicada aos poucos, e as amostras já usadas deixam de
+ *     ser fresh().
  *
- * @return true se todos os servidores forem resolvidos com sucesso,
- *         false caso contrário
+ * @param maxErrorUs Limite do erro da medida, que passa a ser o erro
+ *                   máximo do relógio. Durante um slew, soma-se a parte
+ *                   do offset que ainda pode estar pendente.
+ * @param peer Par do sistema, anunciado pelo modo servidor.
  */
-bool NTPSync::resolveAllServers()
+void NTPSyncClock::correctClock(int64_t offsetUs, uint32_t maxErrorUs, const NTPServer &peer)
 {
-    bool allResolved = true;
-    for (auto &server : _timeval.servers)
+    // Lidos antes do step, que já incluiria o offset
+    struct timeval tv;
+    _platform.clock->now(tv);
+    int64_t monotonicUs = _platform.clock->monotonicUs();
+
+    ClockDiscipline::Action action = applyOffset(offsetUs);
+    if (action == ClockDiscipline::Action::Ignore)
     {
-        if (!server.resolved)
-        {
-            if (!resolveServer(server))
-            {
-                allResolved = false;
-            }
-        }
+        markSamplesUsed(action);
+        return;
     }
-    return allResolved;
+    _offsetUs = offsetUs;
+    _source = NTPTimeSource::Ntp;
+    _errorUs = maxErrorUs;
+    if (action == ClockDiscipline::Action::Slew)
+        _errorUs += (uint32_t)std::min<int64_t>(std::llabs(offsetUs), NTP_ERROR_UNKNOWN / 2);
+    _errorBaseUs = monotonicUs;
+    _anchored = true;
+    _anchorMonoUs = monotonicUs;
+    _anchorUtcUs = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec + offsetUs;
+    _discipline.adjustPoll(offsetUs, _jitterUs);
+    publishStatus();
+    publishServe(peer);
+    markSamplesUsed(action);
 }
 
 /**
- * @brief Resolve o endereço IP de um servidor NTP a partir de seu hostname.
- *
- * @param server Referência para o objeto NTPServer que contém o hostname a ser resolvido.
+ * @brief Impede que as amostras anteriores à correção sejam usadas.
  *
- * @return true se o endereço IP for resolvido com sucesso e atualizado no servidor,
- *         false caso contrário.
+ * @param action Ação aplicada; após um step os filtros são esvaziados.
  */
-bool NTPSync::resolveServer(NTPServer &server)
+void NTPSyncClock::markSamplesUsed(ClockDiscipline::Action action)
 {
-    if (server.resolved)
-        return true;
-
-    if (_logEnabled)
+    for (auto &server : _timeval.servers)
     {
-        // Serial0.printf("Resolvendo %s...\n", server.hostname.c_str());
-        // Serial0.printf("DNS atual: %s\n", WiFi.dnsIP().toString().c_str());
+        if (action == ClockDiscipline::Action::Step)
+            server.filter.reset();
+        else
+            server.filter.markUsed();
     }
+}
 
-    IPAddress ip;
-    // WiFi.setDNS("8.8.8.8", "8.8.4.4");
-    if (!WiFi.hostByName(server.hostname.c_str(), ip) || ip == IPAddress(0, 0, 0, 0))
+/**
+ * @brief Publica os dados do par do sistema para o modo servidor.
+ *
+ * Deve ser chamada com _mutex adquirido, logo após a correção do
+ * relógio, que serve de referenceTs.
+ */
+void NTPSyncClock::publishServe(const NTPServer &peer)
+{
+    ServeState state;
+    state.synced = true;
+    state.leap = peer.leap;
+    state.stratum = (uint8_t)std::min<uint32_t>(peer.filter.stratum() + 1u, NTP_MAX_STRATUM);
+    if (peer.address.family == NTPFamily::IPv4)
+    {
+        const uint8_t *ip = peer.address.ip;
+        state.referenceId = ((uint32_t)ip[0] << 24) | ((uint32_t)ip[1] << 16) |
+                            ((uint32_t)ip[2] << 8) | ip[3];
+    }
+    else
     {
-        if (_logEnabled)
+        // RFC 5905 usa os 4 primeiros bytes do MD5; qualquer hash serve à
+        // detecção de laços entre servidores
+        uint32_t h = 2166136261u;
+        for (uint8_t byte : peer.address.ip)
         {
-            // Serial0.printf("Falha ao resolver %s\n", server.hostname.c_str());
+            h = (h ^ byte) * 16777619u;
         }
-        return false;
+        state.referenceId = h;
     }
+    uint64_t delayUs = (uint64_t)peer.filter.rootDelayUs() +
+                       (uint64_t)std::max<int64_t>(peer.filter.delayUs(), 0);
+    state.rootDelayUs = (uint32_t)std::min<uint64_t>(delayUs, NTP_MAX_DISPERSION_US);
+    state.referenceTs = ntpTime();
+    state.maxErrorUs = _errorUs;
+    state.errorBaseUs = _errorBaseUs;
+    _serve.write(state);
+}
 
-    server.resolved = true;
-    server.ip = ip.toString();
+/**
+ * @brief Valida um pedido do modo servidor e o substitui pela resposta.
+ *
+ * O transmit timestamp fica zerado; serveRequests() o grava no lote
+ * inteiro antes do envio.
+ *
+ * @param t2 Horário de recepção do lote.
+ * @param monotonicUs NTPClock::monotonicUs() em t2, para envelhecer o erro.
+ *
+ * @return false se o datagrama não for um pedido de cliente.
+ */
+bool NTPSyncClock::buildReply(NTPDatagram &datagram, const ServeState &state, uint64_t t2,
+                         int64_t monotonicUs)
+{
+    NTPPacket request;
+    if (!request.decode(datagram.data, datagram.len))
+        return false;
+    if (request.mode != NTP_MODE_CLIENT || request.version < 1 || request.version > NTP_VERSION)
+        return false;
 
-    if (_logEnabled)
+    NTPPacket reply = {};
+    reply.version = request.version;
+    reply.mode = NTP_MODE_SERVER;
+    reply.poll = request.poll;
+    reply.precision = NTP_SERVER_PRECISION;
+    reply.originTs = request.transmitTs;
+    reply.receiveTs = t2;
+    if (state.synced)
     {
-        // Serial0.printf("Resolvido %s → %s\n", server.hostname.c_str(), server.ip.c_str());
+        // Dispersão: erro máximo do relógio, crescendo a PHI desde a correção
+        uint64_t ageUs = (uint64_t)std::max<int64_t>(monotonicUs - state.errorBaseUs, 0);
+        uint64_t errorUs = state.maxErrorUs + ageUs * NTP_PHI_PPM / 1000000;
+        reply.leap = state.leap;
+        reply.stratum = state.stratum;
+        reply.rootDelay = ntpShortFromUs(state.rootDelayUs);
+        reply.rootDispersion =
+            ntpShortFromUs((uint32_t)std::min<uint64_t>(errorUs, NTP_MAX_DISPERSION_US));
+        reply.referenceId = state.referenceId;
+        reply.referenceTs = state.referenceTs;
     }
-
+    else
+    {
+        reply.leap = NTP_LEAP_UNSYNC;
+        reply.rootDispersion = ntpShortFromUs(NTP_MAX_DISPERSION_US);
+    }
+    reply.encode(datagram.data);
+    datagram.len = NTP_PACKET_SIZE;
     return true;
 }
 
 /**
- * @brief Salva o estado da sincroniza o de tempo no Preferences.
+ * @brief Consome um pedido do token bucket do servidor.
  *
- * O Preferences é um sistema de armazenamento de dados no ESP32 que
- * permite armazenar pequenas quantidades de dados persistente no
- * dispositivo.
+ * O intervalo de recarga é o maior entre o global (setRateLimit()) e o
+ * exigido pelo servidor via KoD RATE.
  *
- * Este método salva o timestamp da última sincronização bem como o
- * fuso horário no Preferences.
+ * @return false se o servidor não puder receber um pedido agora.
  */
-void NTPSync::saveTimeToPrefs()
+bool NTPSyncClock::takeToken(NTPServer &server, uint32_t now)
 {
-    _prefs.begin("ntp", false);
-    _prefs.putULong("lastSync", _timeval.lastSync);
-    _prefs.putInt("utcOffset", _timeval.utc_offset);
-    _prefs.end();
+    uint32_t interval = std::max(_rateIntervalMs, server.rateIntervalMs);
+    if (interval == 0)
+        return true;
+
+    uint32_t refill = (now - server.rateMarkMs) / interval;
+    if (refill > 0)
+    {
+        server.tokens = (uint8_t)std::min<uint64_t>((uint64_t)server.tokens + refill, _rateBurst);
+        server.rateMarkMs += refill * interval;
+    }
+    if (server.tokens >= _rateBurst)
+        server.rateMarkMs = now; // Cheio: o tempo parado não vira crédito
+    if (server.tokens == 0)
+        return false;
+    server.tokens--;
+    return true;
 }
 
 /**
- * @brief Carrega o estado da sincroniza o de tempo do Preferences.
+ * @brief Reage a um Kiss-o'-Death (RFC 5905 §7.4).
  *
- * Carrega o timestamp da última sincroniza o bem como o fuso horário
- * do Preferences e seta o tempo do sistema. Caso não haja um valor
- * salvo, deixa o tempo do sistema como está e não altera o fuso
- * horário.
+ * @details
+ *     RATE dobra o intervalo mínimo entre pedidos ao servidor, até
+ *     NTP_RATE_MAX_INTERVAL_MS, e esvazia o token bucket. DENY e RSTR
+ *     rebaixam o servidor: ele deixa de receber pedidos e de participar
+ *     da seleção até que o DNS devolva outro endereço, renovação que é
+ *     antecipada para agora. Outros códigos só contam como rejeição.
  *
- * @return true se o estado foi carregado com sucesso, false caso
- *         contrário.
+ * @param code referenceId da resposta com stratum 0.
  */
-void NTPSync::loadTimeFromPrefs()
+void NTPSyncClock::handleKiss(NTPServer &server, uint32_t code, uint32_t now)
 {
-    _prefs.begin("ntp", true);
-    _timeval.lastSync = _prefs.getULong("lastSync", 0);
-    _timeval.utc_offset = _prefs.getInt("utcOffset", _timeval.utc_offset); // Default UTC-3
-    _prefs.end();
-
-    if (_timeval.lastSync > 0)
+    switch (code)
     {
-        struct timeval tv = {.tv_sec = _timeval.lastSync};
-        settimeofday(&tv, nullptr);
-
-        if (_logEnabled)
-        {
-            // Serial0.printf("Hora carregada das preferências: %s\n", ctime(&_timeval.lastSync));
-        }
+    case NTP_KISS_RATE:
+    {
+        uint64_t interval =
+            std::max(std::max(_rateIntervalMs, server.rateIntervalMs), NTP_RATE_INTERVAL_MS);
+        server.rateIntervalMs = (uint32_t)std::min<uint64_t>(interval * 2, NTP_RATE_MAX_INTERVAL_MS);
+        server.tokens = 0;
+        server.rateMarkMs = now;
+        NTP_LOGW("KoD RATE de %s: no máximo um pedido a cada %lu s", server.hostname,
+                 server.rateIntervalMs / 1000);
+        break;
+    }
+    case NTP_KISS_DENY:
+    case NTP_KISS_RSTR:
+        server.demoted = true;
+        server.filter = ClockFilter();
+        if (!server.numeric)
+            server.expiresMs = now;
+        NTP_LOGW("KoD DENY/RSTR de %s: servidor rebaixado", server.hostname);
+        break;
+    default:
+        break;
     }
 }
 
 /**
- * @brief Atualiza o estado do horário de ver o no Brasil.
- *
- * A regra simplificada para horário de verão no Brasil é a seguinte:
- * - Outubro a Fevereiro: horário de verão está ativo.
- * - Março a Setembro: horário de verão está inativo.
+ * @brief Antecipa o agendamento por um valor aleatório.
  *
- * @param now Timestamp atual.
+ * @return delayMs menos até _jitterPercent% dele.
  */
-void NTPSync::updateDstStatus(time_t now)
+uint32_t NTPSyncClock::jitterDelay(uint32_t delayMs)
 {
-    struct tm *tm = localtime(&now);
-    // Regra simplificada para horário de verão no Brasil (Outubro a Fevereiro)
-    _timeval.dst_active = (tm->tm_mon > 9 || tm->tm_mon < 2);
+    uint32_t spread = (uint32_t)((uint64_t)delayMs * _jitterPercent / 100);
+    if (spread == 0)
+        return delayMs;
+    return delayMs - _platform.clock->random() % (spread + 1);
 }
 
 /**
- * @brief Inicia a tarefa de sincronização de tempo.
+ * @brief Verifica as condições mínimas de uma resposta SNTP (RFC 4330 §5).
+ *
+ * @param reply Pacote decodificado.
+ * @param t1 Timestamp enviado no pedido; deve voltar no campo origin.
  *
- * Essa tarefa executa a função timeSyncTask, que verifica se o horário
- * está sincronizado e, caso não está, tenta sincronizar o horário
- * com o servidor NTP.
+ * @return true se a resposta puder ser usada para corrigir o relógio.
  */
-void NTPSync::startTask()
+bool NTPSyncClock::validateReply(const NTPPacket &reply, uint64_t t1)
 {
-    xTaskCreatePinnedToCore(
-        timeSyncTaskNTP,
-        "TimeSyncTaskNTP",
-        4096,
-        nullptr,
-        1,
-        nullptr,
-        0);
-    if (_logEnabled)
-    {
-        // Serial0.printf("Tarefa de sincronização iniciada\n");
-    }
+    if (reply.mode != NTP_MODE_SERVER)
+        return false;
+    if (reply.version < 3 || reply.version > NTP_VERSION)
+        return false;
+    if (reply.originTs != t1)
+        return false; // Resposta a outro pedido ou forjada
+    if (reply.leap == NTP_LEAP_UNSYNC)
+        return false;
+    if (reply.stratum == 0 || reply.stratum > 15)
+        return false; // Kiss-o'-Death ou servidor sem referência
+    if (reply.transmitTs == 0)
+        return false;
+    return true;
 }
 
 /**
- * @brief Sincroniza o horário com um servidor NTP.
+ * @brief Ajusta o relógio do sistema pelo offset medido.
  *
  * @details
- *     Essa função configura o horário com o offset de fuso horário
- *     e ip do servidor NTP e, em seguida, tenta obter o horário
- *     atual do servidor NTP com o timeout de 10 segundos.
- *
- *     Se o horário for obtido com sucesso, o horário atual é
- *     atualizado e o tempo de resposta do servidor NTP é
- *     gravado.
+ *     O offset passa pela disciplina de relógio, que atualiza a
+ *     estimativa de frequência e decide entre slew (ajuste gradual),
+ *     step (acima do limite configurado) ou descartar a amostra (spike
+ *     ou medição de frequência em curso).
  *
- * @param server Referência para o objeto NTPServer que contém
- *               o ip do servidor NTP.
+ * @param offsetUs Offset em microssegundos a ser somado ao relógio.
  *
- * @return true se o horário for sincronizado com sucesso,
- *         false caso contrário.
+ * @return Ação aplicada; Ignore se a amostra foi descartada e o relógio
+ *         não foi alterado.
  */
-bool NTPSync::syncWithServer(NTPServer &server)
+ClockDiscipline::Action NTPSyncClock::applyOffset(int64_t offsetUs)
 {
-    configTime(_timeval.utc_offset, 0, server.ip.c_str());
-
-    if (!getLocalTime(&_timeinfo, 10000))
-    { // Timeout de 10 segundos
-        if (_logEnabled)
-        {
-            // Serial0.printf("Failed to get time from NTP\n");
-        }
-        return false;
+    ClockDiscipline::Action action = _discipline.update(offsetUs, _platform.clock->millis());
+    // O offset foi medido contra o horário sem o slew ainda pendente: o
+    // pendente é substituído pela correção nova, em vez de somar-se a ela
+    int64_t pendingUs = 0;
+    if (action != ClockDiscipline::Action::Ignore)
+        pendingUs = _platform.clock->pendingSlewUs();
+    switch (action)
+    {
+    case ClockDiscipline::Action::Step:
+        if (pendingUs != 0)
+            slewClock(-pendingUs);
+        stepClock(offsetUs);
+        break;
+    case ClockDiscipline::Action::Slew:
+        slewClock(offsetUs - pendingUs);
+        break;
+    default:
+        NTP_LOGW("Offset de %lld us descartado pela disciplina", offsetUs);
+        break;
     }
+    return action;
+}
 
-    time_t now = time(nullptr);
-    server.lastResponseTime = millis() - (now - _timeval.lastSync) * 1000;
+/**
+ * @brief Adiciona uma correção ao ajuste gradual em andamento.
+ */
+void NTPSyncClock::slewClock(int64_t offsetUs)
+{
+    _platform.clock->slew(offsetUs);
+}
 
-    if (_logEnabled)
-    {
-        char timeStr[64];
-        strftime(timeStr, sizeof(timeStr), "%d/%m/%Y %H:%M:%S", &_timeinfo);
-        // Serial0.printf("Time synchronized successfully: %s\n", timeStr);
-    }
+/**
+ * @brief Ajusta o relógio do sistema de uma vez.
+ */
+void NTPSyncClock::stepClock(int64_t offsetUs)
+{
+    _platform.clock->step(offsetUs);
+    NTP_LOGI("Relógio ajustado por step em %lld us", offsetUs);
+}
 
-    return true;
+/**
+ * @brief Aplica o fuso horário configurado à variável TZ.
+ *
+ * Substitui o efeito colateral de configTime(): localtime() e strftime()
+ * da aplicação continuam retornando o horário local, com horário de verão.
+ */
+void NTPSyncClock::applyTimezone()
+{
+    if (!systemDomain())
+        return;
+    setenv("TZ", _timeval.zone.posix(), 1);
+    tzset();
+}
+
+/**
+ * @brief Horário atual da plataforma no formato NTP de 64 bits.
+ */
+uint64_t NTPSyncClock::ntpTime()
+{
+    struct timeval tv;
+    _platform.clock->now(tv);
+    return ntpFromTimeval(tv);
+}
+
+/**
+ * @brief Horário NTP em um instante passado de NTPClock::monotonicUs()
+ *
+ * Converte os timestamps de transmissão e de chegada dos backends: o
+ * horário atual menos a idade do instante. monotonicUs = 0 (backend sem
+ * timestamp) devolve o horário atual.
+ */
+uint64_t NTPSyncClock::ntpTimeAt(int64_t monotonicUs)
+{
+    int64_t ageUs = monotonicUs != 0 ? _platform.clock->monotonicUs() - monotonicUs : 0;
+    uint64_t now = ntpTime();
+    if (ageUs <= 0)
+        return now;
+    ageUs = std::min<int64_t>(ageUs, NTP_ERROR_UNKNOWN); // Mantém o shift abaixo de 64 bits
+    return now - (((uint64_t)ageUs << 32) / 1000000ULL);
+}
+
+/**
+ * @brief Horário atual da plataforma em segundos desde 1970.
+ */
+time_t NTPSyncClock::currentTime()
+{
+    struct timeval tv;
+    _platform.clock->now(tv);
+    return tv.tv_sec;
 }
 
 /**
@@ -426,22 +2452,50 @@ bool NTPSync::syncWithServer(NTPServer &server)
  *
  * @return O tempo de atraso calculado em milissegundos, limitado por um valor máximo.
  */
-time_t NTPSync::getExponentialBackoffDelay(uint32_t failureCount)
+time_t NTPSyncClock::getExponentialBackoffDelay(uint32_t failureCount)
 {
     const uint32_t baseDelay = 1000; // 1 segundo base
     const uint32_t maxDelay = 60000; // 1 minuto máximo
-    uint32_t delay = baseDelay * (1 << (failureCount - 1));
-    return min(delay, maxDelay);
+    // 2^6 s já passa do máximo; limitar o expoente evita o shift indefinido
+    uint32_t exponent = std::min<uint32_t>(failureCount ? failureCount - 1 : 0, 6);
+    uint32_t delay = baseDelay * (1u << exponent);
+    return std::min(delay, maxDelay);
 }
 
-void timeSyncTaskNTP(void *param)
+/**
+ * @brief Acorda quem conduz loop(): o agendador, após begin(), ou a
+ *        tarefa da plataforma
+ */
+void NTPSyncClock::wake()
 {
-    while (true)
+    NTPScheduler *scheduler;
     {
-        bool success = false;
-        success = NTPSync::syncTime();
+        std::lock_guard<std::mutex> lock(_mutex);
+        scheduler = _scheduler;
+    }
+    if (scheduler != nullptr)
+        scheduler->notify();
+    else
+        _platform.tasking->notify();
+}
+
+/**
+ * @brief Indica se a instância é a padrão de NTPSync
+ *
+ * Só ela altera estado global do processo: a variável TZ e o relógio
+ * dos logs.
+ */
+bool NTPSyncClock::systemDomain() const
+{
+    return this == &NTPSync::clock();
+}
 
-        uint32_t delayTime = success ? NTPSync::_syncInterval : NTPSync::_retryInterval;
-        vTaskDelay(pdMS_TO_TICKS(delayTime));
+void NTPSyncClock::serverTask(void *arg)
+{
+    NTPSyncClock *self = static_cast<NTPSyncClock *>(arg);
+    while (self->_serverState.load(std::memory_order_acquire) == ServerRunning)
+    {
+        self->serveRequests(NTP_SERVER_POLL_MS);
     }
-}
\ No newline at end of file
+    self->_serverState.store(ServerStopped, std::memory_order_release);
+}
@@ -2,75 +2,546 @@
 #define NTP_SYNC_H
 
 // #include <LogLibrary.h>
-#include "utc.h"
-#include <HTTPClient.h>
-#include <Preferences.h>
+#include "ClockDiscipline.h"
+#include "ClockFilter.h"
+#include "FixedList.h"
+#include "LocalTimeCache.h"
+#include "NTPLog.h"
+#include "NTPMetrics.h"
+#include "NTPPacket.h"
+#include "NTPScheduler.h"
+#include "NTPStateStore.h"
+#include "NTPTimeFormat.h"
+#include "SeqLock.h"
+#include "TimeZone.h"
+#include "hal/NTPHal.h"
 #include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <initializer_list>
+#include <memory>
 #include <mutex>
+#include <string>
 #include <vector>
 
 constexpr uint32_t MINUTES_TO_MS = 60000;
+constexpr uint16_t NTP_DEFAULT_PACKET_TIMEOUT_MS = 500;
+constexpr uint32_t NTP_ASYNC_POLL_MS = 10;       // Maior bloqueio de um passo da sincronização
+constexpr uint8_t NTP_MAX_SYNC_LISTENERS = 4;    // Pedidos simultâneos por sincronização
+constexpr uint32_t NTP_DNS_TIMEOUT_MS = 5000;    // Espera máxima por uma consulta DNS
+constexpr uint32_t NTP_DNS_DEFAULT_TTL_S = 3600; // Cache quando o backend não informa o TTL
+constexpr uint32_t NTP_DNS_MIN_TTL_S = 60;       // Também o intervalo entre tentativas após falha
+constexpr uint32_t NTP_DNS_MAX_TTL_S = 86400;
+constexpr uint32_t NTP_DNS_MAX_FAILURES = 3;     // Falhas seguidas que invalidam o endereço
+constexpr uint32_t NTP_PERSIST_DELAY_MS = 1000;  // Espera após a sincronização antes de gravar
+constexpr uint32_t NTP_SERVER_POLL_MS = 100;     // Espera máxima da tarefa do modo servidor
+constexpr int8_t NTP_SERVER_PRECISION = -20;     // log2 da resolução do relógio (~1 µs)
+constexpr uint32_t NTP_RATE_INTERVAL_MS = 8000;  // Intervalo médio mínimo entre pedidos a um servidor
+constexpr uint8_t NTP_RATE_BURST = 4;            // Pedidos seguidos permitidos a um servidor
+constexpr uint32_t NTP_RATE_MAX_INTERVAL_MS = 131072000; // Teto após KoD RATE (2^17 s, maxpoll)
+constexpr uint8_t NTP_SCHEDULE_JITTER_PERCENT = 10; // Antecipação aleatória máxima do agendamento
+constexpr uint32_t NTP_STARTUP_SPREAD_MS = 5000; // Atraso aleatório máximo da primeira sincronização
+constexpr uint8_t NTP_MAX_SERVERS = 8;           // Capacidade da tabela de servidores
+constexpr size_t NTP_HOSTNAME_LEN = 64;          // Inclui o '\0'
+
+static_assert(NTP_MAX_SERVERS <= NTP_METRICS_MAX_SERVERS, "Cada servidor precisa de um slot de métricas");
+
+constexpr uint32_t NTP_ERROR_UNKNOWN = UINT32_MAX;
+
+/**
+ * @brief Origem do horário atual do sistema
+ */
+enum class NTPTimeSource : uint8_t
+{
+    None,      // Nenhum horário conhecido
+    Saved,     // Último horário salvo: apenas um limite inferior
+    WarmStart, // Extrapolado no boot a partir do estado salvo
+    Ntp        // Sincronizado com os servidores
+};
+
+/**
+ * @brief Estado da sincronização publicado para leitura sem lock
+ *
+ * monotonicBaseUs e utcBaseUs foram lidos no mesmo instante e permitem
+ * estimar o horário UTC atual a partir do relógio monotônico. O erro
+ * máximo cresce a partir de maxErrorUs à taxa de errorPpm.
+ */
+struct NTPStatus
+{
+    int64_t monotonicBaseUs; // NTPClock::monotonicUs() na publicação
+    int64_t utcBaseUs;       // UTC em microssegundos desde 1970 no mesmo instante
+    int64_t offsetUs;        // Último offset aplicado ao relógio
+    uint32_t jitterUs;       // Jitter do sistema na última sincronização
+    time_t lastSync;         // Timestamp da última sincronização
+    bool synced;             // Resultado da última tentativa
+    TimeZone zone;           // Fuso configurado em setTimeval()
+    bool syncing;            // Sincronização em andamento
+    NTPTimeSource source;    // Origem do horário
+    uint32_t maxErrorUs;     // Erro máximo em monotonicBaseUs, ou NTP_ERROR_UNKNOWN
+    uint32_t errorPpm;       // Crescimento do erro máximo
+
+    int64_t utcUs(int64_t monotonicUs) const
+    {
+        return utcBaseUs + (monotonicUs - monotonicBaseUs);
+    }
+
+    uint32_t errorUs(int64_t monotonicUs) const
+    {
+        if (maxErrorUs == NTP_ERROR_UNKNOWN)
+            return NTP_ERROR_UNKNOWN;
+        uint64_t error = maxErrorUs + (uint64_t)(monotonicUs - monotonicBaseUs) * errorPpm / 1000000;
+        return (uint32_t)std::min<uint64_t>(error, NTP_ERROR_UNKNOWN - 1);
+    }
+};
+
+/**
+ * @brief Horário atual com intervalo de confiança
+ *
+ * O UTC real está em [utcUs - errorUs, utcUs + errorUs]. errorUs vale
+ * NTP_ERROR_UNKNOWN quando não há limite conhecido.
+ */
+struct NTPTimeEstimate
+{
+    int64_t utcUs; // Microssegundos desde 1970
+    uint32_t errorUs;
+    NTPTimeSource source;
+
+    int64_t earliestUs() const { return utcUs - errorUs; }
+    int64_t latestUs() const { return utcUs + errorUs; }
+};
 
 /**
- * @brief Classe para sincronização de tempo via NTP com persistência e fallback
+ * @brief Ponto de sincronização usado por nowMicros() e nowNtp64()
+ *
+ * utcBaseUs é o UTC verdadeiro em monotonicBaseUs, já com o offset que o
+ * slew ainda não aplicou. Dali em diante o horário avança com o relógio
+ * monotônico, corrigido pela frequência estimada pela disciplina
+ * (rateFrac, em unidades de 2^-32), sem degraus a cada compensação.
+ */
+struct NTPTimeBase
+{
+    int64_t monotonicBaseUs;
+    int64_t utcBaseUs;
+    int64_t errorBaseUs;  // NTPClock::monotonicUs() de maxErrorUs
+    int32_t rateFrac;     // Correção de frequência × 2^32 (1 ppm ≈ 4295)
+    uint32_t maxErrorUs;  // Erro máximo em errorBaseUs, ou NTP_ERROR_UNKNOWN
+    uint32_t errorPpm;
+    NTPTimeSource source;
+
+    int64_t utcUs(int64_t monotonicUs) const
+    {
+        // Em duas partes para não estourar 64 bits após ~50 dias sem sincronizar
+        int64_t elapsed = monotonicUs - monotonicBaseUs;
+        int64_t high = (elapsed >> 20) * rateFrac;
+        int64_t low = (elapsed & 0xFFFFF) * rateFrac;
+        return utcBaseUs + elapsed + (high >> 12) + (low >> 32);
+    }
+
+    uint32_t errorUs(int64_t monotonicUs) const
+    {
+        if (maxErrorUs == NTP_ERROR_UNKNOWN)
+            return NTP_ERROR_UNKNOWN;
+        uint64_t error = maxErrorUs + (uint64_t)(monotonicUs - errorBaseUs) * errorPpm / 1000000;
+        return (uint32_t)std::min<uint64_t>(error, NTP_ERROR_UNKNOWN - 1);
+    }
+};
+
+/**
+ * @brief Domínio de tempo sincronizado via NTP, com persistência e fallback
+ *
+ * Cada instância tem seus servidores, estado, namespace de persistência e
+ * agendamento. As instâncias são grandes (~10 KB): declare-as como
+ * globais, nunca na pilha. NTPSync é a fachada estática sobre a instância
+ * padrão, que disciplina o relógio do sistema.
  *
  * Exemplo de uso:
- * NTPSync::setTimeval("America/Sao_Paulo",{"pool.ntp.org", "br.pool.ntp.org"});
- * NTPSync::begin();
+ * NTPSyncClock reference("ntp_ref");  // Relógio próprio, sem tocar no do sistema
+ * reference.setTimeval("UTC", {"pool.ntp.org"});
+ * reference.begin();                  // Mesma tarefa da instância padrão
  */
-class NTPSync
+class NTPSyncClock
 {
 public:
-    static uint32_t _retryInterval;
-    static uint32_t _syncInterval;
-    static std::mutex _mutex;
+    enum class SyncMode
+    {
+        Sequential, // Um servidor por vez, com retentativas e backoff
+        Parallel    // Todos os servidores de uma vez, um único timeout
+    };
 
-    static void logControl(bool enabled = true);
-    static void begin(uint32_t syncInterval = 3600000, uint32_t retryInterval = 300000);
-    static bool syncTime(uint8_t maxRetries = 3);
-    static bool isTimeSynced();
-    static bool hasTimeval();
-    static time_t getLastTimeSync();
+    enum class SyncResult : uint8_t
+    {
+        Success,
+        Failed,    // Nenhuma resposta válida ou sem maioria entre os servidores
+        NoNetwork, // Rede desconectada
+        DnsFailed, // Nenhum servidor pôde ser resolvido
+        Timeout,   // Prazo de requestSync() esgotado
+        Cancelled, // cancelSync(), setTimeval() ou setPlatform()
+        Unchanged  // Respostas válidas, mas nenhuma amostra nova desde a última correção
+    };
+
+    /**
+     * @brief Chamado ao fim de uma sincronização pedida por requestSync()
+     *
+     * Executa na tarefa que conduziu a sincronização (a tarefa de fundo ou
+     * quem chamou loop()/syncTime()), sem _mutex adquirido.
+     */
+    typedef void (*SyncCallback)(SyncResult result, const NTPStatus &status, void *arg);
+
+    explicit NTPSyncClock(const char *name);
+    NTPSyncClock(const char *name, const NTPPlatform &platform);
+    ~NTPSyncClock();
+
+    NTPSyncClock(const NTPSyncClock &) = delete;
+    NTPSyncClock &operator=(const NTPSyncClock &) = delete;
+
+    void begin(uint32_t syncInterval = 3600000, uint32_t retryInterval = 300000);
+    void begin(uint32_t syncInterval, uint32_t retryInterval, NTPScheduler &scheduler);
+    void end();
+    bool syncTime(uint8_t maxRetries = 3);
+    bool requestSync(SyncCallback callback = nullptr, void *arg = nullptr,
+                     uint32_t timeoutMs = 0);
+    void cancelSync();
+    bool isSyncPending();
+    uint32_t loop();
+    bool isTimeSynced();
+    bool hasTimeval();
+    time_t getLastTimeSync();
+    NTPStatus getStatus();
+    NTPTimeEstimate getTimeEstimate();
+    int64_t nowMicros(uint32_t *errorUs = nullptr);
+    uint64_t nowNtp64(uint32_t *errorUs = nullptr);
+    void getMetrics(NTPMetrics &metrics);
+    bool getLocalTime(struct tm &timeinfo);
+    void getLocalTime(time_t utc, struct tm &timeinfo);
+
+    void setTimeval(const char *timezone, std::initializer_list<const char *> ntpServers);
+    void setTimeval(const char *timezone, const std::vector<std::string> &ntpServers);
+    void setTimeval(const char *timezone, const char *const *ntpServers, size_t count);
 
-    static void
-    setTimeval(const char *timezone, const std::vector<std::string> &ntpServers);
+    void setSyncIntervals(uint32_t syncInterval, uint32_t retryInterval);
+    void setPacketTimeout(uint16_t timeoutMs);
+    void setSyncMode(SyncMode mode, uint8_t quorum = 0);
+    void setStepThreshold(uint32_t thresholdMs);
+    void setAdaptivePolling(bool enabled, uint32_t minInterval = 1, uint32_t maxInterval = 1440,
+                            uint32_t errorBudgetMs = 50);
+    void setDnsTtl(uint32_t ttlSec);
+    void setRateLimit(uint32_t intervalMs = NTP_RATE_INTERVAL_MS, uint8_t burst = NTP_RATE_BURST);
+    void setScheduleJitter(uint8_t percent = NTP_SCHEDULE_JITTER_PERCENT,
+                           uint32_t startupSpreadMs = NTP_STARTUP_SPREAD_MS);
+    void setPersistInterval(uint32_t interval);
+    bool saveState();
+    uint32_t getSyncDelay(bool success);
+    void disciplineTick();
+    void setPlatform(const NTPPlatform &platform);
 
-    static void setSyncIntervals(uint32_t syncInterval, uint32_t retryInterval);
+    bool startServer(uint16_t port = NTP_PORT);
+    void stopServer();
+    bool isServerRunning();
+    uint16_t getServerPort();
+    size_t serveRequests(uint32_t timeoutMs);
+
+    const char *name() const { return _store.name(); }
+    NTPClock *clock() const { return _platform.clock; }
+    NTPTasking *tasking() const { return _platform.tasking; }
 
 private:
+    /**
+     * @brief Entrada da tabela de servidores
+     *
+     * Campos lidos a cada pacote ficam no início, seguidos do filtro e,
+     * por último, do hostname, usado apenas no DNS e nos logs.
+     */
     struct NTPServer
     {
-        String hostname;
-        String ip;
-        bool resolved;
-        uint32_t lastResponseTime;
-        uint8_t stratum; // Qualidade do servidor (0-15)
+        NTPAddress address; // IP resolvido e porta UDP
+        bool resolved;      // address utilizável, mesmo que expirado
+        bool numeric;       // hostname é um IP: dispensa o DNS
+        bool demoted;       // KoD DENY/RSTR: não recebe pedidos até mudar de endereço
+        uint8_t tokens;     // Pedidos disponíveis no token bucket
+        uint8_t stratum;    // Qualidade do servidor (0-15)
+        uint8_t leap;       // Indicador de segundo bissexto
+        uint8_t metricsSlot; // Índice em NTPMetrics::servers
+        int8_t dnsQuery;    // Consulta em andamento em NTPNetwork, ou -1
+        uint32_t lastResponseTime; // Atraso de ida e volta medido (ms)
         uint32_t failureCount;
+        uint32_t rootDispersionUs; // Dispersão informada pelo servidor
+        uint32_t expiresMs; // millis() a partir do qual o endereço é renovado
+        uint32_t dnsStartMs;
+        uint32_t rateMarkMs;     // millis() da última recarga do token bucket
+        uint32_t rateIntervalMs; // Intervalo exigido por KoD RATE, ou 0
+        int64_t lastOffsetUs; // Offset da última resposta válida
+        ClockFilter filter;   // Histórico das últimas 8 amostras
+        char hostname[NTP_HOSTNAME_LEN];
+    };
+    enum class JobState : uint8_t
+    {
+        Idle,
+        Resolve, // Verifica a rede, resolve os servidores e abre o socket
+        Send,    // Envia o(s) pedido(s)
+        Receive, // Coleta respostas até o timeout de pacote
+        Backoff  // Espera antes da próxima tentativa (modo sequencial)
+    };
+
+    struct SyncListener
+    {
+        SyncCallback callback;
+        void *arg;
+        SyncResult result;
+    };
+
+    struct PendingQuery
+    {
+        NTPServer *server;
+        uint64_t origin; // Transmit timestamp do pedido, devolvido pelo servidor
+        uint64_t t1;     // Instante da transmissão informado pelo backend
+        bool answered;
+        bool rejected; // Respondeu, mas a resposta foi descartada
+    };
+
+    /**
+     * @brief Sincronização em andamento, avançada por stepJob()
+     */
+    struct SyncJob
+    {
+        JobState state;
+        SyncMode mode;
+        uint8_t maxRetries;
+        uint8_t attempt;        // Tentativa atual no servidor (modo sequencial)
+        size_t server;          // Próximo servidor (modo sequencial)
+        bool hasDeadline;
+        uint32_t deadlineMs;    // millis() limite para concluir
+        uint32_t startMs;       // millis() do início, para NTPMetrics::syncDuration
+        uint32_t waitStartMs;   // Início do timeout de pacote ou do backoff
+        uint32_t waitMs;
+        size_t answered;
+        uint8_t quorum;
+        FixedList<PendingQuery, NTP_MAX_SERVERS> pending;
+        SyncListener listeners[NTP_MAX_SYNC_LISTENERS];
+        uint8_t listenerCount;
     };
+
+    /**
+     * @brief Dados do par do sistema usados nas respostas do modo servidor
+     *
+     * Publicados por seqlock: a tarefa do servidor nunca espera por _mutex.
+     */
+    struct ServeState
+    {
+        bool synced;          // Relógio corrigido pelo NTP
+        uint8_t leap;
+        uint8_t stratum;      // Stratum do par do sistema + 1
+        uint32_t referenceId; // IPv4 do par, ou hash do IPv6
+        uint32_t rootDelayUs; // Atraso do par até a referência primária
+        uint64_t referenceTs; // Última correção do relógio
+        uint32_t maxErrorUs;  // Erro máximo em errorBaseUs
+        int64_t errorBaseUs;  // NTPClock::monotonicUs()
+    };
+
+    enum ServerState : uint8_t
+    {
+        ServerStopped,
+        ServerRunning,
+        ServerStopping // Aguardando a tarefa do servidor encerrar
+    };
+
     struct Timeval
     {
-        String time_zone;
-        std::vector<NTPServer> servers; // Usando vector para flexibilidade
+        TimeZone zone;
+        FixedList<NTPServer, NTP_MAX_SERVERS> servers;
         int32_t utc_offset;             // Offset em segundos (-3h = -10800)
         bool dst_active;                // Horário de verão
         time_t lastSync;                // Timestamp da última sincronização
     };
 
-    static tm _timeinfo;
-    static Preferences _prefs;
-    static Timeval _timeval;
-    static bool _timeSyncked;
-    static bool _logEnabled;
-
-    static void sortServersByPerformance();
-    static bool resolveAllServers();
-    static bool resolveServer(NTPServer &server);
-    static void saveTimeToPrefs();
-    static void loadTimeFromPrefs();
-    static void updateDstStatus(time_t now);
-    static void startTask();
-    static bool syncWithServer(NTPServer &server);
+    std::mutex _mutex;
+    std::unique_ptr<NTPNetwork> _ownNetwork; // Criado pelo construtor de domínio independente
+    NTPSoftClock _softClock;                 // Relógio do domínio independente
+    NTPPlatform _platform;
+    NTPScheduler *_scheduler; // Agendador de begin(), ou nullptr
+    uint32_t _syncInterval;
+    uint32_t _retryInterval;
+    tm _timeinfo;
+    Timeval _timeval;
+    LocalTimeCache _localTime; // Conversões no fuso de _timeval.zone
+    bool _timeSyncked;
+    SeqLock<NTPStatus> _status;
+    bool _adaptivePoll;
+    uint16_t _packetTimeout;
+    SyncMode _syncMode;
+    uint8_t _quorum;
+    int64_t _offsetUs;  // Último offset combinado aplicado
+    uint32_t _jitterUs; // Jitter do sistema após a seleção
+    ClockDiscipline _discipline;
+    SyncJob _job;
+    bool _scheduled;      // begin() foi chamado: sincronizações periódicas
+    uint32_t _nextSyncMs; // millis() da próxima sincronização periódica
+    uint32_t _lastTickMs; // millis() da última compensação de frequência
+    SyncListener _completed[2 * NTP_MAX_SYNC_LISTENERS]; // Aguardando entrega
+    uint8_t _completedCount;
+    uint32_t _dnsTtl;       // Segundos, quando o backend não informa o TTL
+    uint8_t _dnsPending;    // Consultas DNS em andamento
+    NTPTimeSource _source;
+    uint32_t _errorUs;      // Erro máximo em _errorBaseUs
+    int64_t _errorBaseUs;   // NTPClock::monotonicUs() da última estimativa do erro
+    NTPStateStore _store;
+    bool _persistPending;   // Estado alterado desde a última gravação
+    uint32_t _persistMarkMs;
+    NTPMetrics _counters;   // Atualizado com _mutex adquirido
+    SeqLock<NTPMetrics> _metrics; // Cópia publicada de _counters
+    SeqLock<ServeState> _serve;
+    std::atomic<uint8_t> _serverState;
+    bool _serverTask;       // Conduzido pela tarefa do servidor ou por serveRequests()
+    uint16_t _serverPort;
+    NTPDatagram _serveBatch[NTP_SERVER_BATCH]; // Pedidos, respondidos no próprio buffer
+    std::atomic<uint32_t> _serveRequests;
+    std::atomic<uint32_t> _serveReplies;
+    std::atomic<uint32_t> _serveDropped;
+    uint32_t _rateIntervalMs;
+    uint8_t _rateBurst;
+    uint8_t _jitterPercent;
+    uint32_t _startupSpreadMs;
+    SeqLock<NTPTimeBase> _timeBase;
+    bool _anchored;          // _anchorUtcUs vem de uma correção pelo NTP
+    int64_t _anchorMonoUs;
+    int64_t _anchorUtcUs;    // UTC verdadeiro em _anchorMonoUs
+
+    void sortServersByPerformance();
+    void startLookups(uint32_t now);
+    void pollLookups(uint32_t now);
+    void cancelLookups();
+    void snapshotState(NTPStateRecord &record);
+    void loadTimeFromPrefs();
+    void saveAddresses(NTPStateRecord &record);
+    void loadAddresses(const NTPStateRecord &record);
+    bool warmStart(const NTPStateRecord &record);
+    void updateDstStatus(time_t now);
+    void wake();
+    bool startJob(uint8_t maxRetries, SyncCallback callback, void *arg, uint32_t timeoutMs);
+    uint32_t stepJob();
+    uint32_t jobResolve();
+    uint32_t jobSend();
+    uint32_t jobReceive();
+    void jobEvaluate();
+    void finishJob(SyncResult result);
+    void deliverCompleted();
+    uint32_t syncDelay(bool success);
+    void recordSample(NTPServer &server, const NTPSample &sample);
+    bool takeToken(NTPServer &server, uint32_t now);
+    void handleKiss(NTPServer &server, uint32_t code, uint32_t now);
+    uint32_t jitterDelay(uint32_t delayMs);
+    static bool validateReply(const NTPPacket &reply, uint64_t t1);
+    void publishStatus();
+    void publishMetrics();
+    NTPServerMetrics *serverMetrics(const NTPServer &server);
+    SyncResult selectAndApply();
+    void correctClock(int64_t offsetUs, uint32_t maxErrorUs, const NTPServer &peer);
+    void markSamplesUsed(ClockDiscipline::Action action);
+    void publishServe(const NTPServer &peer);
+    static bool buildReply(NTPDatagram &datagram, const ServeState &state, uint64_t t2,
+                           int64_t monotonicUs);
+    ClockDiscipline::Action applyOffset(int64_t offsetUs);
+    void slewClock(int64_t offsetUs);
+    void stepClock(int64_t offsetUs);
+    void applyTimezone();
+    uint64_t ntpTime();
+    uint64_t ntpTimeAt(int64_t monotonicUs);
+    time_t currentTime();
+    bool systemDomain() const;
     static time_t getExponentialBackoffDelay(uint32_t failureCount);
+    static void serverTask(void *arg);
+};
+
+/**
+ * @brief Fachada estática sobre a instância padrão de NTPSyncClock
+ *
+ * Mantém a API original: cada função repassa para clock(), que usa os
+ * backends nativos (ntpDefaultPlatform()) e o namespace "ntp".
+ *
+ * Exemplo de uso:
+ * NTPSync::setTimeval("America/Sao_Paulo",{"pool.ntp.org", "br.pool.ntp.org"});
+ * NTPSync::begin();
+ */
+class NTPSync
+{
+public:
+    using SyncMode = NTPSyncClock::SyncMode;
+    using SyncResult = NTPSyncClock::SyncResult;
+    using SyncCallback = NTPSyncClock::SyncCallback;
+
+    static NTPSyncClock &clock();
+
+    static void logControl(bool enabled = true);
+    static void begin(uint32_t syncInterval = 3600000, uint32_t retryInterval = 300000)
+    {
+        clock().begin(syncInterval, retryInterval);
+    }
+    static bool syncTime(uint8_t maxRetries = 3) { return clock().syncTime(maxRetries); }
+    static bool requestSync(SyncCallback callback = nullptr, void *arg = nullptr,
+                            uint32_t timeoutMs = 0)
+    {
+        return clock().requestSync(callback, arg, timeoutMs);
+    }
+    static void cancelSync() { clock().cancelSync(); }
+    static bool isSyncPending() { return clock().isSyncPending(); }
+    static uint32_t loop() { return clock().loop(); }
+    static bool isTimeSynced() { return clock().isTimeSynced(); }
+    static bool hasTimeval() { return clock().hasTimeval(); }
+    static time_t getLastTimeSync() { return clock().getLastTimeSync(); }
+    static NTPStatus getStatus() { return clock().getStatus(); }
+    static NTPTimeEstimate getTimeEstimate() { return clock().getTimeEstimate(); }
+    static int64_t nowMicros(uint32_t *errorUs = nullptr) { return clock().nowMicros(errorUs); }
+    static uint64_t nowNtp64(uint32_t *errorUs = nullptr) { return clock().nowNtp64(errorUs); }
+    static void getMetrics(NTPMetrics &metrics) { clock().getMetrics(metrics); }
+    static bool getLocalTime(struct tm &timeinfo) { return clock().getLocalTime(timeinfo); }
+    static void getLocalTime(time_t utc, struct tm &timeinfo) { clock().getLocalTime(utc, timeinfo); }
+
+    static void setTimeval(const char *timezone, std::initializer_list<const char *> ntpServers)
+    {
+        clock().setTimeval(timezone, ntpServers);
+    }
+    static void setTimeval(const char *timezone, const std::vector<std::string> &ntpServers)
+    {
+        clock().setTimeval(timezone, ntpServers);
+    }
+    static void setTimeval(const char *timezone, const char *const *ntpServers, size_t count)
+    {
+        clock().setTimeval(timezone, ntpServers, count);
+    }
+
+    static void setSyncIntervals(uint32_t syncInterval, uint32_t retryInterval)
+    {
+        clock().setSyncIntervals(syncInterval, retryInterval);
+    }
+    static void setPacketTimeout(uint16_t timeoutMs) { clock().setPacketTimeout(timeoutMs); }
+    static void setSyncMode(SyncMode mode, uint8_t quorum = 0) { clock().setSyncMode(mode, quorum); }
+    static void setStepThreshold(uint32_t thresholdMs) { clock().setStepThreshold(thresholdMs); }
+    static void setAdaptivePolling(bool enabled, uint32_t minInterval = 1,
+                                   uint32_t maxInterval = 1440, uint32_t errorBudgetMs = 50)
+    {
+        clock().setAdaptivePolling(enabled, minInterval, maxInterval, errorBudgetMs);
+    }
+    static void setDnsTtl(uint32_t ttlSec) { clock().setDnsTtl(ttlSec); }
+    static void setRateLimit(uint32_t intervalMs = NTP_RATE_INTERVAL_MS,
+                             uint8_t burst = NTP_RATE_BURST)
+    {
+        clock().setRateLimit(intervalMs, burst);
+    }
+    static void setScheduleJitter(uint8_t percent = NTP_SCHEDULE_JITTER_PERCENT,
+                                  uint32_t startupSpreadMs = NTP_STARTUP_SPREAD_MS)
+    {
+        clock().setScheduleJitter(percent, startupSpreadMs);
+    }
+    static void setPersistInterval(uint32_t interval) { clock().setPersistInterval(interval); }
+    static bool saveState() { return clock().saveState(); }
+    static uint32_t getSyncDelay(bool success) { return clock().getSyncDelay(success); }
+    static void disciplineTick() { clock().disciplineTick(); }
+    static void setPlatform(const NTPPlatform &platform) { clock().setPlatform(platform); }
+
+    static bool startServer(uint16_t port = NTP_PORT) { return clock().startServer(port); }
+    static void stopServer() { clock().stopServer(); }
+    static bool isServerRunning() { return clock().isServerRunning(); }
+    static uint16_t getServerPort() { return clock().getServerPort(); }
+    static size_t serveRequests(uint32_t timeoutMs) { return clock().serveRequests(timeoutMs); }
 };
-void timeSyncTaskNTP(void *pvParameters);
+
 #endif // NTP_SYNC_H
\ No newline at end of file
@@ -0,0 +1,207 @@
+#include "NTPTimeFormat.h"
+#include <climits>
+#include <cstring>
+
+constexpr size_t NTP_PREFIX_LEN = 19;      // "2026-01-01T09:00:00" ou "01/01/2026 09:00:00"
+constexpr int64_t NTP_MIN_DAY = -719528;   // 0000-01-01
+constexpr int64_t NTP_MAX_DAY = 2932896;   // 9999-12-31
+
+static const char DIGIT_PAIRS[] = "00010203040506070809"
+                                  "10111213141516171819"
+                                  "20212223242526272829"
+                                  "30313233343536373839"
+                                  "40414243444546474849"
+                                  "50515253545556575859"
+                                  "60616263646566676869"
+                                  "70717273747576777879"
+                                  "80818283848586878889"
+                                  "90919293949596979899";
+
+// Divisor dos microssegundos para cada quantidade de dígitos da fração
+static const uint32_t FRACTION_DIVISOR[] = {1000000, 100000, 10000, 1000, 100, 10, 1};
+
+static inline void writePair(char *out, uint32_t value)
+{
+    memcpy(out, DIGIT_PAIRS + value * 2, 2);
+}
+
+static int64_t floorDiv(int64_t a, int64_t b)
+{
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+}
+
+/**
+ * @param zone Fuso da hora local; o padrão é UTC.
+ * @param layout Disposição dos campos.
+ * @param fractionDigits Casas decimais dos segundos, de 0 a NTP_TIME_MAX_FRACTION.
+ */
+NTPTimeFormatter::NTPTimeFormatter(const TimeZone &zone, Layout layout, uint8_t fractionDigits)
+    : _zone(zone),
+      _layout(layout),
+      _fractionDigits(fractionDigits > NTP_TIME_MAX_FRACTION ? NTP_TIME_MAX_FRACTION : fractionDigits),
+      _second(INT64_MIN),
+      _day(INT64_MIN),
+      _offset(INT32_MIN),
+      _span{INT64_MAX, INT64_MIN, 0, false}
+{
+    if (_layout == Layout::Rfc3339)
+    {
+        memcpy(_prefix, "0000-00-00T00:00:00", sizeof(_prefix));
+        // Só o fuso UTC usa "Z": nos demais o offset tem sempre 6 caracteres
+        _suffixLen = strcmp(_zone.name(), "UTC") == 0 ? 1 : 6;
+        memcpy(_suffix, "Z", 2);
+    }
+    else
+    {
+        memcpy(_prefix, "00/00/0000 00:00:00", sizeof(_prefix));
+        _suffixLen = 0;
+        _suffix[0] = '\0';
+    }
+    _length = (uint8_t)(NTP_PREFIX_LEN + (_fractionDigits > 0 ? _fractionDigits + 1 : 0) +
+                        _suffixLen);
+}
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Formata um instante em microssegundos desde 1970 (UTC)
+ *
+ * @param out Buffer de pelo menos length() + 1 (ou NTP_TIME_TEXT_LEN)
+ *            bytes; recebe a string terminada em '\0'.
+ *
+ * @return length(), ou 0 se o ano local estiver fora de 0000..9999.
+ */
+size_t NTPTimeFormatter::format(int64_t utcUs, char *out)
+{
+    int64_t second = floorDiv(utcUs, 1000000);
+    if (second != _second)
+        update(second);
+    if (_day < NTP_MIN_DAY || _day > NTP_MAX_DAY)
+    {
+        out[0] = '\0';
+        return 0;
+    }
+
+    memcpy(out, _prefix, NTP_PREFIX_LEN);
+    char *p = out + NTP_PREFIX_LEN;
+    if (_fractionDigits > 0)
+    {
+        *p++ = '.';
+        uint32_t fraction = (uint32_t)(utcUs - second * 1000000) / FRACTION_DIVISOR[_fractionDigits];
+        char *digit = p + _fractionDigits;
+        uint8_t left = _fractionDigits;
+        for (; left >= 2; left -= 2)
+        {
+            digit -= 2;
+            writePair(digit, fraction % 100);
+            fraction /= 100;
+        }
+        if (left > 0)
+            *--digit = (char)('0' + fraction);
+        p += _fractionDigits;
+    }
+    memcpy(p, _suffix, _suffixLen);
+    p[_suffixLen] = '\0';
+    return _length;
+}
+
+/**
+ * @brief Formata count instantes em registros de largura fixa
+ *
+ * O i-ésimo texto, terminado em '\0', começa em out + i * stride.
+ * Instantes próximos, como os de um lote de logs, reaproveitam o prefixo
+ * já formatado.
+ *
+ * @param stride Distância entre registros; pelo menos length() + 1.
+ *
+ * @return Instantes formatados: count, ou 0 se stride for pequeno demais.
+ */
+size_t NTPTimeFormatter::formatBatch(const int64_t *utcUs, size_t count, char *out, size_t stride)
+{
+    if (stride < (size_t)_length + 1)
+        return 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        format(utcUs[i], out + i * stride);
+    }
+    return count;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Atualiza o prefixo para um novo segundo, reescrevendo só os
+ *        campos que mudaram
+ *
+ * O fuso só é consultado fora do intervalo do último offset, isto é, numa
+ * transição ou num salto no tempo.
+ */
+void NTPTimeFormatter::update(int64_t utcSec)
+{
+    if (utcSec < _span.fromUtc || utcSec >= _span.untilUtc)
+        _span = _zone.span(utcSec);
+    int32_t offset = _span.offset;
+    int64_t local = utcSec + offset;
+    int64_t day = floorDiv(local, 86400);
+    if (day != _day)
+        writeDate(day);
+    writeTime((int32_t)(local - day * 86400));
+    if (offset != _offset)
+        writeOffset(offset);
+    _second = utcSec;
+}
+
+void NTPTimeFormatter::writeDate(int64_t days)
+{
+    _day = days;
+    if (days < NTP_MIN_DAY || days > NTP_MAX_DAY)
+        return;
+
+    struct tm date;
+    TimeZone::breakDown(days * 86400, date);
+    uint32_t year = (uint32_t)(date.tm_year + 1900);
+    char *y = _prefix + (_layout == Layout::Rfc3339 ? 0 : 6);
+    char *m = _prefix + (_layout == Layout::Rfc3339 ? 5 : 3);
+    char *d = _prefix + (_layout == Layout::Rfc3339 ? 8 : 0);
+    writePair(y, year / 100);
+    writePair(y + 2, year % 100);
+    writePair(m, (uint32_t)date.tm_mon + 1);
+    writePair(d, (uint32_t)date.tm_mday);
+}
+
+/**
+ * @brief Escreve HH:MM:SS, na mesma posição nos dois layouts
+ */
+void NTPTimeFormatter::writeTime(int32_t secondOfDay)
+{
+    uint32_t s = (uint32_t)secondOfDay;
+    writePair(_prefix + 11, s / 3600);
+    writePair(_prefix + 14, (s / 60) % 60);
+    writePair(_prefix + 17, s % 60);
+}
+
+/**
+ * @brief Escreve o offset como ±HH:MM; os segundos de offsets históricos
+ *        (LMT) são descartados, como exige a RFC 3339
+ */
+void NTPTimeFormatter::writeOffset(int32_t offset)
+{
+    _offset = offset;
+    if (_suffixLen != 6)
+        return;
+
+    uint32_t minutes = (uint32_t)(offset < 0 ? -offset : offset) / 60;
+    _suffix[0] = offset < 0 ? '-' : '+';
+    writePair(_suffix + 1, minutes / 60);
+    _suffix[3] = ':';
+    writePair(_suffix + 4, minutes % 60);
+    _suffix[6] = '\0';
+}
@@ -0,0 +1,68 @@
+#ifndef NTP_TIME_FORMAT_H
+#define NTP_TIME_FORMAT_H
+
+#include "TimeZone.h"
+#include <cstddef>
+#include <cstdint>
+
+constexpr size_t NTP_TIME_TEXT_LEN = 33;    // "2026-01-01T00:00:00.123456+14:00" com o '\0'
+constexpr uint8_t NTP_TIME_MAX_FRACTION = 6; // Dígitos da fração: a entrada é em microssegundos
+
+/**
+ * @brief Formatação de timestamps sem strftime() nem struct tm
+ *
+ * @details
+ *     Guarda o texto de data e hora do último segundo formatado. Dentro
+ *     do mesmo segundo, formatar é copiar esse prefixo e escrever a
+ *     fração; num segundo novo do mesmo dia, só a hora é reescrita, e a
+ *     data apenas quando o dia local muda. Os dígitos saem de uma tabela
+ *     de pares "00".."99", duas casas por acesso.
+ *
+ *     Todas as saídas de um formatador têm o mesmo tamanho, length(), o
+ *     que permite gravar lotes em registros de largura fixa. Anos fora de
+ *     0000..9999 resultam em string vazia.
+ *
+ *     Uma instância não é thread-safe: use uma por tarefa (cada uma ocupa
+ *     ~80 bytes).
+ *
+ * Exemplo de uso:
+ * NTPTimeFormatter formatter(NTPSync::getStatus().zone);
+ * char text[NTP_TIME_TEXT_LEN];
+ * formatter.format(NTPSync::nowMicros(), text); // "2026-01-01T09:00:00.123-03:00"
+ */
+class NTPTimeFormatter
+{
+public:
+    enum class Layout : uint8_t
+    {
+        Rfc3339,     // 2026-01-01T09:00:00.123-03:00 (Z no fuso UTC)
+        DayMonthYear // 01/01/2026 09:00:00.123, hora local sem offset
+    };
+
+    explicit NTPTimeFormatter(const TimeZone &zone = TimeZone(), Layout layout = Layout::Rfc3339,
+                              uint8_t fractionDigits = 3);
+
+    size_t length() const { return _length; }
+    size_t format(int64_t utcUs, char *out);
+    size_t formatBatch(const int64_t *utcUs, size_t count, char *out, size_t stride);
+
+private:
+    TimeZone _zone;
+    Layout _layout;
+    uint8_t _fractionDigits;
+    uint8_t _suffixLen;
+    uint8_t _length;
+    int64_t _second; // Segundo UTC de _prefix, ou INT64_MIN
+    int64_t _day;    // Dia local de _prefix, desde 1970-01-01
+    int32_t _offset; // Offset de _suffix
+    TZSpan _span;    // Intervalo em que _offset vale
+    char _prefix[20];
+    char _suffix[7];
+
+    void update(int64_t utcSec);
+    void writeDate(int64_t days);
+    void writeTime(int32_t secondOfDay);
+    void writeOffset(int32_t offset);
+};
+
+#endif // NTP_TIME_FORMAT_H
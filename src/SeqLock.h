@@ -0,0 +1,98 @@
+#ifndef SEQ_LOCK_H
+#define SEQ_LOCK_H
+
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+/**
+ * @brief Seqlock para um único escritor e leitores sem espera
+ *
+ * O escritor incrementa a sequência antes e depois de copiar os dados;
+ * o leitor copia os dados e repete se a sequência for ímpar ou tiver
+ * mudado durante a cópia. Os dados ficam em palavras atômicas relaxadas,
+ * então a leitura concorrente não é uma condição de corrida no modelo de
+ * memória do C++.
+ *
+ * Leitores nunca bloqueiam o escritor, e o escritor nunca espera pelos
+ * leitores. Escritas concorrentes devem ser serializadas por quem chama.
+ *
+ * @tparam T Tipo trivialmente copiável.
+ */
+template <typename T>
+class SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SeqLock requer tipo trivialmente copiável");
+
+public:
+    SeqLock() : _seq(0)
+    {
+        store(T{});
+    }
+
+    void write(const T &value)
+    {
+        uint32_t seq = _seq.load(std::memory_order_relaxed);
+        _seq.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        store(value);
+        _seq.store(seq + 2, std::memory_order_release);
+    }
+
+    T read() const
+    {
+        T value;
+        read(value);
+        return value;
+    }
+
+    // Para tipos grandes: lê direto no destino, sem cópia intermediária
+    void read(T &value) const
+    {
+        uint32_t before;
+        uint32_t after;
+        do
+        {
+            before = _seq.load(std::memory_order_acquire);
+            load(value);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            after = _seq.load(std::memory_order_relaxed);
+        } while ((before & 1) || before != after);
+    }
+
+private:
+    static constexpr size_t WORDS = (sizeof(T) + sizeof(uint32_t) - 1) / sizeof(uint32_t);
+
+    std::atomic<uint32_t> _seq;
+    std::atomic<uint32_t> _words[WORDS];
+
+    // Palavra a palavra, sem buffer do tamanho de T na pilha
+    void store(const T &value)
+    {
+        const uint8_t *src = (const uint8_t *)&value;
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            uint32_t word = 0;
+            memcpy(&word, src + i * sizeof(word), chunk(i));
+            _words[i].store(word, std::memory_order_relaxed);
+        }
+    }
+
+    void load(T &value) const
+    {
+        uint8_t *dst = (uint8_t *)&value;
+        for (size_t i = 0; i < WORDS; i++)
+        {
+            uint32_t word = _words[i].load(std::memory_order_relaxed);
+            memcpy(dst + i * sizeof(word), &word, chunk(i));
+        }
+    }
+
+    static constexpr size_t chunk(size_t i)
+    {
+        return (i + 1) * sizeof(uint32_t) <= sizeof(T) ? sizeof(uint32_t) : sizeof(T) - i * sizeof(uint32_t);
+    }
+};
+
+#endif // SEQ_LOCK_H
@@ -0,0 +1,281 @@
+#include "TimeZone.h"
+#include <algorithm>
+
+static const uint8_t DAYS_IN_MONTH[] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+
+static bool isLeap(int32_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static int64_t floorDiv(int64_t a, int64_t b)
+{
+    return a / b - ((a % b != 0) && ((a < 0) != (b < 0)));
+}
+
+/**
+ * @brief Dia da semana (0 = domingo) de um dia contado desde 1970-01-01
+ */
+static uint8_t weekday(int64_t days)
+{
+    return (uint8_t)(((days % 7) + 11) % 7);
+}
+
+static_assert([]
+              {
+                  TimeZone zone;
+                  return TimeZone::find("UTC", zone) && !TimeZone::find("Invalid/Zone", zone);
+              }(),
+              "Hash perfeito de TimeZoneNames.h inconsistente");
+
+// ----------------------------------------------------
+//
+//               Funções Públicas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Nome IANA do fuso ("UTC" por padrão)
+ */
+const char *TimeZone::name() const
+{
+    return _name == TZ_NO_ZONE ? "UTC" : TZ_NAME_KEYS[_name].data();
+}
+
+/**
+ * @brief String POSIX TZ equivalente, para setenv("TZ")
+ */
+const char *TimeZone::posix() const
+{
+    return _name == TZ_NO_ZONE ? "UTC0" : TZ_ZONES[TZ_NAME_ZONES[_name]].posix;
+}
+
+/**
+ * @brief Offset local (segundos a leste de UTC) em vigor no instante utc
+ *
+ * @param utc Segundos desde 1970 (UTC).
+ * @param dst Se não nulo, recebe se o horário de verão está ativo.
+ */
+int32_t TimeZone::offsetAt(int64_t utc, bool *dst) const
+{
+    if (_name == TZ_NO_ZONE)
+    {
+        if (dst)
+            *dst = false;
+        return 0;
+    }
+
+    const TZZone &zone = TZ_ZONES[TZ_NAME_ZONES[_name]];
+    uint8_t type = zone.initialType;
+    const uint32_t *begin = TZ_TRANSITION_UTC + zone.first;
+    const uint32_t *end = begin + zone.count;
+    if (zone.count > 0 && utc >= (int64_t)*begin)
+    {
+        uint32_t key = utc > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)utc;
+        const uint32_t *it = std::upper_bound(begin, end, key);
+        type = TZ_TRANSITION_TYPE[(it - 1) - TZ_TRANSITION_UTC];
+    }
+
+    if (type == TZ_RULE_TYPE)
+        return ruleOffset(TZ_RULES[zone.rule], utc, dst);
+
+    if (dst)
+        *dst = TZ_TYPES[type].dst != 0;
+    return TZ_TYPES[type].offset;
+}
+
+/**
+ * @brief Offset em vigor no instante utc e até quando ele vale
+ *
+ * @details
+ * Mesmo resultado de offsetAt(), mais as transições vizinhas: enquanto
+ * um instante estiver em [fromUtc, untilUtc), o offset dele é o mesmo,
+ * sem nova busca.
+ */
+TZSpan TimeZone::span(int64_t utc) const
+{
+    TZSpan span = {INT64_MIN, INT64_MAX, 0, false};
+    if (_name == TZ_NO_ZONE)
+        return span;
+
+    const TZZone &zone = TZ_ZONES[TZ_NAME_ZONES[_name]];
+    uint8_t type = zone.initialType;
+    const uint32_t *begin = TZ_TRANSITION_UTC + zone.first;
+    const uint32_t *end = begin + zone.count;
+    if (zone.count > 0 && utc >= (int64_t)*begin)
+    {
+        uint32_t key = utc > (int64_t)UINT32_MAX ? UINT32_MAX : (uint32_t)utc;
+        const uint32_t *it = std::upper_bound(begin, end, key);
+        type = TZ_TRANSITION_TYPE[(it - 1) - TZ_TRANSITION_UTC];
+        span.fromUtc = *(it - 1);
+        if (it != end)
+            span.untilUtc = *it;
+    }
+    else if (zone.count > 0)
+    {
+        span.untilUtc = *begin;
+    }
+
+    if (type == TZ_RULE_TYPE)
+    {
+        ruleSpan(TZ_RULES[zone.rule], utc, span);
+        return span;
+    }
+
+    span.offset = TZ_TYPES[type].offset;
+    span.dst = TZ_TYPES[type].dst != 0;
+    return span;
+}
+
+/**
+ * @brief Converte utc para a hora local decomposta, como localtime_r()
+ */
+void TimeZone::toLocal(int64_t utc, struct tm &out) const
+{
+    bool dst;
+    int32_t offset = offsetAt(utc, &dst);
+    breakDown(utc + offset, out);
+    out.tm_isdst = dst ? 1 : 0;
+}
+
+/**
+ * @brief Decompõe segundos desde 1970 em data e hora (calendário gregoriano)
+ *
+ * @details
+ * Algoritmo civil_from_days de H. Hinnant, sem tabelas nem laços.
+ * tm_isdst é zerado.
+ */
+void TimeZone::breakDown(int64_t seconds, struct tm &out)
+{
+    int64_t days = floorDiv(seconds, 86400);
+    int32_t secs = (int32_t)(seconds - days * 86400);
+
+    int64_t z = days + 719468;
+    int64_t era = floorDiv(z, 146097);
+    uint32_t doe = (uint32_t)(z - era * 146097);
+    uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    uint32_t mp = (5 * doy + 2) / 153;
+    uint32_t day = doy - (153 * mp + 2) / 5 + 1;
+    uint32_t month = mp < 10 ? mp + 3 : mp - 9;
+    int32_t year = (int32_t)(yoe + era * 400) + (month <= 2);
+
+    out.tm_year = year - 1900;
+    out.tm_mon = (int)month - 1;
+    out.tm_mday = (int)day;
+    out.tm_hour = secs / 3600;
+    out.tm_min = (secs / 60) % 60;
+    out.tm_sec = secs % 60;
+    out.tm_wday = weekday(days);
+    out.tm_yday = (int)(days - daysFromCivil(year, 1, 1));
+    out.tm_isdst = 0;
+}
+
+/**
+ * @brief Dias desde 1970-01-01 da data (ano, mês 1-12, dia 1-31)
+ */
+int64_t TimeZone::daysFromCivil(int32_t year, uint32_t month, uint32_t day)
+{
+    year -= month <= 2;
+    int64_t era = floorDiv(year, 400);
+    uint32_t yoe = (uint32_t)(year - era * 400);
+    uint32_t doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    uint32_t doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + (int64_t)doe - 719468;
+}
+
+// ----------------------------------------------------
+//
+//               Funções Privadas
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Avalia a regra POSIX no instante utc
+ *
+ * @details
+ * As transições do ano são calculadas a partir do ano em hora padrão
+ * local. O início é dado em hora padrão e o fim em horário de verão; no
+ * hemisfério sul o fim cai antes do início dentro do ano.
+ */
+int32_t TimeZone::ruleOffset(const TZRule &rule, int64_t utc, bool *dst)
+{
+    bool active = false;
+    if (rule.start.kind != TZRuleDate::None)
+    {
+        struct tm local;
+        breakDown(utc + rule.stdOffset, local);
+        int32_t year = local.tm_year + 1900;
+
+        int64_t start = ruleTransition(rule.start, year, rule.stdOffset);
+        int64_t end = ruleTransition(rule.end, year, rule.dstOffset);
+        active = start < end ? (utc >= start && utc < end) : !(utc >= end && utc < start);
+    }
+
+    if (dst)
+        *dst = active;
+    return active ? rule.dstOffset : rule.stdOffset;
+}
+
+/**
+ * @brief Restringe span às transições da regra em torno de utc
+ *
+ * As transições dos anos vizinhos cobrem os intervalos que atravessam a
+ * virada do ano, como o horário de verão do hemisfério sul.
+ */
+void TimeZone::ruleSpan(const TZRule &rule, int64_t utc, TZSpan &span)
+{
+    span.offset = ruleOffset(rule, utc, &span.dst);
+    if (rule.start.kind == TZRuleDate::None)
+        return;
+
+    struct tm local;
+    breakDown(utc + rule.stdOffset, local);
+    int32_t year = local.tm_year + 1900;
+    for (int32_t y = year - 1; y <= year + 1; y++)
+    {
+        int64_t edges[] = {ruleTransition(rule.start, y, rule.stdOffset),
+                           ruleTransition(rule.end, y, rule.dstOffset)};
+        for (int64_t edge : edges)
+        {
+            if (edge <= utc && edge > span.fromUtc)
+                span.fromUtc = edge;
+            if (edge > utc && edge < span.untilUtc)
+                span.untilUtc = edge;
+        }
+    }
+}
+
+/**
+ * @brief Instante UTC de uma transição da regra no ano dado
+ *
+ * @param offset Offset em vigor imediatamente antes da transição.
+ */
+int64_t TimeZone::ruleTransition(const TZRuleDate &date, int32_t year, int32_t offset)
+{
+    int64_t jan1 = daysFromCivil(year, 1, 1);
+    int64_t day;
+
+    switch (date.kind)
+    {
+    case TZRuleDate::Julian:
+        day = jan1 + date.yday - 1 + (isLeap(year) && date.yday >= 60);
+        break;
+    case TZRuleDate::DayOfYear:
+        day = jan1 + date.yday;
+        break;
+    default:
+    {
+        int64_t first = daysFromCivil(year, date.month, 1);
+        uint8_t length = DAYS_IN_MONTH[date.month - 1] + (date.month == 2 && isLeap(year));
+        day = first + (date.day + 7 - weekday(first)) % 7 + (date.week - 1) * 7;
+        while (day >= first + length)
+        {
+            day -= 7;
+        }
+        break;
+    }
+    }
+
+    return day * 86400 + date.time - offset;
+}
@@ -0,0 +1,168 @@
+#ifndef TIME_ZONE_H
+#define TIME_ZONE_H
+
+#include "TimeZoneNames.h"
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <string_view>
+
+constexpr uint8_t TZ_RULE_TYPE = 0xFF; // Transição a partir da qual vale a regra POSIX
+constexpr uint16_t TZ_NO_ZONE = 0xFFFF;
+
+/**
+ * @brief Offset local em vigor entre duas transições
+ */
+struct TZType
+{
+    int32_t offset; // Segundos a leste de UTC
+    uint8_t dst;
+};
+
+/**
+ * @brief Data de início ou fim do horário de verão numa regra POSIX TZ
+ *
+ * MonthWeekDay: "Mm.w.d" (semana 5 = última); Julian: "Jn" (1-365, sem
+ * 29/02); DayOfYear: "n" (0-365, com 29/02). time é a hora local da
+ * transição em segundos e pode ser negativa ou passar de 24 h.
+ */
+struct TZRuleDate
+{
+    enum Kind : uint8_t
+    {
+        None,
+        MonthWeekDay,
+        Julian,
+        DayOfYear
+    };
+
+    Kind kind;
+    uint8_t month;
+    uint8_t week;
+    uint8_t day;
+    uint16_t yday;
+    int32_t time;
+};
+
+/**
+ * @brief Regra POSIX TZ pré-compilada, válida após a última transição
+ */
+struct TZRule
+{
+    int32_t stdOffset; // Segundos a leste de UTC
+    int32_t dstOffset;
+    TZRuleDate start;
+    TZRuleDate end;
+};
+
+/**
+ * @brief Intervalo [fromUtc, untilUtc) em que o offset local não muda
+ */
+struct TZSpan
+{
+    int64_t fromUtc;  // INT64_MIN antes da primeira transição
+    int64_t untilUtc; // INT64_MAX sem transições futuras
+    int32_t offset;   // Segundos a leste de UTC
+    bool dst;
+};
+
+struct TZZone
+{
+    const char *posix;   // String POSIX TZ equivalente à regra
+    uint16_t rule;       // Índice em TZ_RULES
+    uint8_t initialType; // Tipo antes da primeira transição
+    uint16_t first;      // Primeira transição em TZ_TRANSITION_*
+    uint16_t count;
+};
+
+// Tabelas geradas por extras/tools/gen_tzdata.py (TimeZoneData.cpp)
+extern const TZType TZ_TYPES[];
+extern const TZRule TZ_RULES[];
+extern const uint32_t TZ_TRANSITION_UTC[];
+extern const uint8_t TZ_TRANSITION_TYPE[];
+extern const TZZone TZ_ZONES[];
+
+/**
+ * @brief FNV-1a de 32 bits, primeiro nível do hash perfeito dos nomes
+ */
+constexpr uint32_t tzHash(std::string_view name)
+{
+    uint32_t h = 2166136261u;
+    for (char c : name)
+    {
+        h = (h ^ (uint8_t)c) * 16777619u;
+    }
+    return h;
+}
+
+/**
+ * @brief Mistura o hash com a semente do balde (finalizador do MurmurHash3)
+ */
+constexpr uint32_t tzMix(uint32_t h, uint32_t seed)
+{
+    uint32_t x = h + seed * 0x9E3779B9u;
+    x ^= x >> 16;
+    x *= 0x85EBCA6Bu;
+    x ^= x >> 13;
+    x *= 0xC2B2AE35u;
+    x ^= x >> 16;
+    return x;
+}
+
+/**
+ * @brief Fuso horário IANA compilado a partir do tzdata
+ *
+ * As transições históricas ficam em tabelas constantes (flash) e, após a
+ * última delas, a regra POSIX do fuso é avaliada diretamente. A conversão
+ * UTC → local é uma busca binária nas transições do fuso, sem localtime()
+ * e sem interpretar strings TZ em tempo de execução.
+ *
+ * Os nomes ficam num hash perfeito gerado junto com as tabelas
+ * (TimeZoneNames.h): a busca calcula um hash, lê uma semente e compara um
+ * único nome, sem alocar memória, e pode ser avaliada em tempo de
+ * compilação.
+ *
+ * Um TimeZone construído por padrão representa UTC.
+ */
+class TimeZone
+{
+public:
+    constexpr TimeZone() : _name(TZ_NO_ZONE) {}
+
+    /**
+     * @brief Procura um fuso pelo nome IANA (ex.: "America/Sao_Paulo")
+     *
+     * @return false se o nome não existir; zone não é alterado.
+     */
+    static constexpr bool find(std::string_view name, TimeZone &zone)
+    {
+        uint32_t h = tzHash(name);
+        uint32_t slot = tzMix(h, TZ_HASH_SEEDS[h % TZ_HASH_BUCKETS]) % TZ_NAME_COUNT;
+        if (TZ_NAME_KEYS[slot] != name)
+            return false;
+        zone._name = (uint16_t)slot;
+        return true;
+    }
+
+    const char *name() const;
+    const char *posix() const;
+    int32_t offsetAt(int64_t utc, bool *dst = nullptr) const;
+    TZSpan span(int64_t utc) const;
+    int64_t toLocal(int64_t utc) const { return utc + offsetAt(utc); }
+    void toLocal(int64_t utc, struct tm &out) const;
+
+    static void breakDown(int64_t seconds, struct tm &out);
+    static int64_t daysFromCivil(int32_t year, uint32_t month, uint32_t day);
+
+    bool operator==(const TimeZone &other) const { return _name == other._name; }
+    bool operator!=(const TimeZone &other) const { return _name != other._name; }
+
+private:
+    uint16_t _name; // Posição em TZ_NAME_KEYS
+
+    static int32_t ruleOffset(const TZRule &rule, int64_t utc, bool *dst);
+    static void ruleSpan(const TZRule &rule, int64_t utc, TZSpan &span);
+    static int64_t ruleTransition(const TZRuleDate &date, int32_t year, int32_t offset);
+};
+
+#endif // TIME_ZONE_H
@@ -0,0 +1,3220 @@
+// Gerado por extras/tools/gen_tzdata.py a partir do tzdata 2025b (transições desde 1970). Não editar.
+
+#include "TimeZone.h"
+
+const TZType TZ_TYPES[] = {
+    {0, 0},
+    {10800, 0},
+    {3600, 1},
+    {3600, 0},
+    {7200, 1},
+    {-3600, 0},
+    {7200, 0},
+    {10800, 1},
+    {0, 1},
+    {-2670, 0},
+    {-39600, 0},
+    {-36000, 1},
+    {-36000, 0},
+    {-32400, 1},
+    {-32400, 0},
+    {-28800, 1},
+    {-14400, 0},
+    {-10800, 0},
+    {-7200, 1},
+    {-10800, 1},
+    {-18000, 0},
+    {-25200, 0},
+    {-21600, 1},
+    {-18000, 1},
+    {-21600, 0},
+    {-14400, 1},
+    {-16200, 0},
+    {-28800, 0},
+    {-25200, 1},
+    {-7200, 0},
+    {-13500, 0},
+    {-5400, 1},
+    {-9000, 1},
+    {-3600, 1},
+    {-12600, 0},
+    {-16200, 1},
+    {28800, 0},
+    {39600, 0},
+    {25200, 0},
+    {18000, 0},
+    {36000, 0},
+    {39600, 1},
+    {21600, 0},
+    {43200, 0},
+    {46800, 1},
+    {25200, 1},
+    {21600, 1},
+    {46800, 0},
+    {50400, 1},
+    {43200, 1},
+    {18000, 1},
+    {14400, 0},
+    {14400, 1},
+    {28800, 1},
+    {19800, 0},
+    {32400, 0},
+    {36000, 1},
+    {32400, 1},
+    {23400, 0},
+    {16200, 0},
+    {20700, 0},
+    {27000, 0},
+    {30600, 0},
+    {12600, 0},
+    {16200, 1},
+    {34200, 0},
+    {37800, 1},
+    {31500, 0},
+    {35100, 1},
+    {37800, 0},
+    {41400, 1},
+    {-43200, 0},
+    {50400, 0},
+    {45900, 0},
+    {49500, 1},
+    {-38400, 0},
+    {-34200, 0},
+    {41400, 0},
+    {45000, 1},
+    {-30600, 0},
+    {-37800, 0},
+    {-34200, 1},
+};
+
+const TZRule TZ_RULES[] = {
+    {0, 0, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {10800, 10800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {3600, 3600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {7200, 7200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 4, 5, 5, 0, 0}, {TZRuleDate::MonthWeekDay, 10, 5, 4, 0, 86400}},
+    {3600, 7200, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 10800}},
+    {-36000, -32400, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-32400, -28800, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-14400, -14400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-10800, -10800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-18000, -18000, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-21600, -21600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-25200, -21600, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-21600, -18000, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-25200, -25200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-18000, -14400, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-28800, -25200, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-14400, -10800, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-7200, -3600, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, -3600}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 0}},
+    {-18000, -14400, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 0}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 3600}},
+    {-10800, -7200, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {-7200, -7200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-14400, -10800, {TZRuleDate::MonthWeekDay, 9, 1, 6, 0, 86400}, {TZRuleDate::MonthWeekDay, 4, 1, 6, 0, 86400}},
+    {-12600, -9000, {TZRuleDate::MonthWeekDay, 3, 2, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 11, 1, 0, 0, 7200}},
+    {28800, 28800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {25200, 25200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {36000, 36000, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {36000, 39600, {TZRuleDate::MonthWeekDay, 10, 1, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 10800}},
+    {18000, 18000, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {43200, 46800, {TZRuleDate::MonthWeekDay, 9, 5, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 10800}},
+    {0, 7200, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 3600}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 10800}},
+    {43200, 43200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {14400, 14400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 0}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 0}},
+    {21600, 21600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {19800, 19800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {32400, 32400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 10800}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 14400}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 3, 4, 4, 0, 180000}, {TZRuleDate::MonthWeekDay, 10, 4, 4, 0, 180000}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 3, 4, 4, 0, 93600}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 7200}},
+    {16200, 16200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {20700, 20700, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {39600, 39600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {23400, 23400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {12600, 12600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-3600, 0, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 0}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 3600}},
+    {0, 3600, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 3600}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 7200}},
+    {-3600, -3600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {34200, 37800, {TZRuleDate::MonthWeekDay, 10, 1, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 10800}},
+    {34200, 34200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {31500, 31500, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {37800, 39600, {TZRuleDate::MonthWeekDay, 10, 1, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 7200}},
+    {-21600, -18000, {TZRuleDate::MonthWeekDay, 9, 1, 6, 0, 79200}, {TZRuleDate::MonthWeekDay, 4, 1, 6, 0, 79200}},
+    {3600, 0, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 3600}},
+    {-36000, -36000, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-39600, -39600, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-43200, -43200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-28800, -28800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {-32400, -32400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {46800, 46800, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {50400, 50400, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {7200, 10800, {TZRuleDate::MonthWeekDay, 3, 5, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 10, 5, 0, 0, 10800}},
+    {45900, 49500, {TZRuleDate::MonthWeekDay, 9, 5, 0, 0, 9900}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 13500}},
+    {-34200, -34200, {TZRuleDate::None, 0, 0, 0, 0, 0}, {TZRuleDate::None, 0, 0, 0, 0, 0}},
+    {39600, 43200, {TZRuleDate::MonthWeekDay, 10, 1, 0, 0, 7200}, {TZRuleDate::MonthWeekDay, 4, 1, 0, 0, 10800}},
+};
+
+const uint32_t TZ_TRANSITION_UTC[] = {
+    41468400u, 54774000u, 231724800u, 246236400u, 259545600u, 275274000u,
+    309740400u, 325468800u, 341802000u, 357523200u, 157770000u, 10364400u,
+    23587200u, 41900400u, 55123200u, 73522800u, 86745600u, 105058800u,
+    118281600u, 136594800u, 149817600u, 168130800u, 181353600u, 199753200u,
+    212976000u, 231289200u, 244512000u, 262825200u, 276048000u, 294361200u,
+    307584000u, 325983600u, 339206400u, 357519600u, 370742400u, 396399600u,
+    402278400u, 426812400u, 433814400u, 452214000u, 465436800u, 483750000u,
+    496972800u, 515286000u, 528508800u, 546822000u, 560044800u, 578444400u,
+    591667200u, 610412400u, 623203200u, 641516400u, 654739200u, 673052400u,
+    686275200u, 704674800u, 717897600u, 736210800u, 749433600u, 767746800u,
+    780969600u, 799020000u, 812322000u, 830469600u, 843771600u, 861919200u,
+    875221200u, 893368800u, 906670800u, 925423200u, 938725200u, 956872800u,
+    970174800u, 988322400u, 1001624400u, 1019772000u, 1033074000u, 1051221600u,
+    1064523600u, 1083276000u, 1096578000u, 1114725600u, 1128027600u, 1146175200u,
+    1158872400u, 1177624800u, 1189112400u, 1209074400u, 1219957200u, 1240524000u,
+    1250802000u, 1272578400u, 1281474000u, 1284069600u, 1285880400u, 1400191200u,
+    1403816400u, 1406844000u, 1411678800u, 1682632800u, 141264000u, 147222000u,
+    199756800u, 207702000u, 231292800u, 244249200u, 265507200u, 271033200u,
+    448243200u, 504918000u, 1212278400u, 1220223600u, 1243814400u, 1250809200u,
+    1272758400u, 1281222000u, 1301788800u, 1312066800u, 1335664800u, 1342749600u,
+    1345428000u, 1348970400u, 1367114400u, 1373162400u, 1376100000u, 1382839200u,
+    1396144800u, 1403920800u, 1406944800u, 1414288800u, 1427594400u, 1434247200u,
+    1437271200u, 1445738400u, 1459044000u, 1465092000u, 1468116000u, 1477792800u,
+    1490493600u, 1495332000u, 1498960800u, 1509242400u, 1521943200u, 1526176800u,
+    1529200800u, 1540692000u, 1557021600u, 1560045600u, 1587261600u, 1590890400u,
+    1618106400u, 1621130400u, 1648346400u, 1651975200u, 1679191200u, 1682215200u,
+    1710036000u, 1713060000u, 1740276000u, 1743904800u, 1771120800u, 1774144800u,
+    1801965600u, 1804989600u, 1832205600u, 1835834400u, 1863050400u, 1866074400u,
+    1893290400u, 1896919200u, 1924135200u, 1927159200u, 1954980000u, 1958004000u,
+    1985220000u, 1988848800u, 2016064800u, 2019088800u, 2046304800u, 2049933600u,
+    2077149600u, 2080778400u, 2107994400u, 2111018400u, 2138234400u, 2141863200u,
+    2169079200u, 2172103200u, 2199924000u, 2202948000u, 2230164000u, 2233792800u,
+    2261008800u, 2264032800u, 2291248800u, 2294877600u, 2322093600u, 2325722400u,
+    2352938400u, 2355962400u, 2383178400u, 2386807200u, 2414023200u, 2417047200u,
+    2444868000u, 2447892000u, 2475108000u, 2478736800u, 2505952800u, 2508976800u,
+    2536192800u, 2539821600u, 2567037600u, 2570666400u, 2597882400u, 2600906400u,
+    2628122400u, 2631751200u, 2658967200u, 2661991200u, 2689812000u, 2692836000u,
+    2720052000u, 2723680800u, 2750896800u, 2753920800u, 2781136800u, 2784765600u,
+    2811981600u, 2815610400u, 2842826400u, 2845850400u, 2873066400u, 2876695200u,
+    2903911200u, 2906935200u, 2934756000u, 2937780000u, 2964996000u, 2968624800u,
+    2995840800u, 2998864800u, 3026080800u, 3029709600u, 3056925600u, 3060554400u,
+    3087770400u, 3090794400u, 3118010400u, 3121639200u, 3148855200u, 3151879200u,
+    3179700000u, 3182724000u, 3209940000u, 3213568800u, 3240784800u, 3243808800u,
+    3271024800u, 3274653600u, 3301869600u, 3305498400u, 3332714400u, 3335738400u,
+    3362954400u, 3366583200u, 3393799200u, 3396823200u, 3424644000u, 3427668000u,
+    3454884000u, 3458512800u, 3485728800u, 3488752800u, 3515968800u, 3519597600u,
+    3546813600u, 3549837600u, 3577658400u, 3580682400u, 3607898400u, 3611527200u,
+    3638743200u, 3641767200u, 3669588000u, 3672612000u, 3699828000u, 3703456800u,
+    141264000u, 147222000u, 199756800u, 207702000u, 231292800u, 244249200u,
+    265507200u, 271033200u, 448243200u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    198291600u, 199756800u, 207702000u, 231292800u, 244249200u, 265507200u,
+    271033200u, 1212278400u, 1220223600u, 1243814400u, 1250809200u, 1272758400u,
+    1281222000u, 1301788800u, 1312066800u, 1335664800u, 1342749600u, 1345428000u,
+    1348970400u, 1367114400u, 1373162400u, 1376100000u, 1382839200u, 1396144800u,
+    1403920800u, 1406944800u, 1414288800u, 1427594400u, 1434247200u, 1437271200u,
+    1445738400u, 1459044000u, 1465092000u, 1468116000u, 1477792800u, 1490493600u,
+    1495332000u, 1498960800u, 1509242400u, 1521943200u, 1526176800u, 1529200800u,
+    1540692000u, 1557021600u, 1560045600u, 1587261600u, 1590890400u, 1618106400u,
+    1621130400u, 1648346400u, 1651975200u, 1679191200u, 1682215200u, 1710036000u,
+    1713060000u, 1740276000u, 1743904800u, 1771120800u, 1774144800u, 1801965600u,
+    1804989600u, 1832205600u, 1835834400u, 1863050400u, 1866074400u, 1893290400u,
+    1896919200u, 1924135200u, 1927159200u, 1954980000u, 1958004000u, 1985220000u,
+    1988848800u, 2016064800u, 2019088800u, 2046304800u, 2049933600u, 2077149600u,
+    2080778400u, 2107994400u, 2111018400u, 2138234400u, 2141863200u, 2169079200u,
+    2172103200u, 2199924000u, 2202948000u, 2230164000u, 2233792800u, 2261008800u,
+    2264032800u, 2291248800u, 2294877600u, 2322093600u, 2325722400u, 2352938400u,
+    2355962400u, 2383178400u, 2386807200u, 2414023200u, 2417047200u, 2444868000u,
+    2447892000u, 2475108000u, 2478736800u, 2505952800u, 2508976800u, 2536192800u,
+    2539821600u, 2567037600u, 2570666400u, 2597882400u, 2600906400u, 2628122400u,
+    2631751200u, 2658967200u, 2661991200u, 2689812000u, 2692836000u, 2720052000u,
+    2723680800u, 2750896800u, 2753920800u, 2781136800u, 2784765600u, 2811981600u,
+    2815610400u, 2842826400u, 2845850400u, 2873066400u, 2876695200u, 2903911200u,
+    2906935200u, 2934756000u, 2937780000u, 2964996000u, 2968624800u, 2995840800u,
+    2998864800u, 3026080800u, 3029709600u, 3056925600u, 3060554400u, 3087770400u,
+    3090794400u, 3118010400u, 3121639200u, 3148855200u, 3151879200u, 3179700000u,
+    3182724000u, 3209940000u, 3213568800u, 3240784800u, 3243808800u, 3271024800u,
+    3274653600u, 3301869600u, 3305498400u, 3332714400u, 3335738400u, 3362954400u,
+    3366583200u, 3393799200u, 3396823200u, 3424644000u, 3427668000u, 3454884000u,
+    3458512800u, 3485728800u, 3488752800u, 3515968800u, 3519597600u, 3546813600u,
+    3549837600u, 3577658400u, 3580682400u, 3607898400u, 3611527200u, 3638743200u,
+    3641767200u, 3669588000u, 3672612000u, 3699828000u, 3703456800u, 10360800u,
+    24786000u, 41810400u, 56322000u, 73432800u, 87944400u, 104882400u,
+    119480400u, 136332000u, 151016400u, 167781600u, 182552400u, 199231200u,
+    214174800u, 230680800u, 245710800u, 262735200u, 277246800u, 294184800u,
+    308782800u, 325634400u, 340405200u, 357084000u, 371941200u, 388533600u,
+    403477200u, 419983200u, 435013200u, 452037600u, 466635600u, 483487200u,
+    498171600u, 947930400u, 1612126800u, 10360800u, 24786000u, 41810400u,
+    56322000u, 73432800u, 87944400u, 104882400u, 119480400u, 136332000u,
+    151016400u, 167781600u, 182552400u, 199231200u, 214174800u, 230680800u,
+    245710800u, 262735200u, 277246800u, 294184800u, 308782800u, 325634400u,
+    340405200u, 357084000u, 371941200u, 388533600u, 403477200u, 419983200u,
+    435013200u, 452037600u, 466635600u, 483487200u, 498171600u, 947930400u,
+    1509483600u, 63593070u, 308703600u, 321314400u, 1514768400u, 1546304400u,
+    378684000u, 386463600u, 402271200u, 417999600u, 433807200u, 449622000u,
+    465429600u, 481590000u, 496965600u, 512953200u, 528674400u, 544230000u,
+    560037600u, 575852400u, 591660000u, 607388400u, 623196000u, 641775600u,
+    844034400u, 860108400u, 875916000u, 1352505600u, 1364515200u, 1382659200u,
+    231202800u, 243903600u, 262825200u, 276044400u, 581122800u, 591145200u,
+    606870000u, 622594800u, 641516400u, 654649200u, 1114902000u, 1128038400u,
+    1143334800u, 1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u,
+    764200800u, 778640400u, 796780800u, 810090000u, 828835200u, 841539600u,
+    860284800u, 873594000u, 891734400u, 905043600u, 923184000u, 936493200u,
+    954633600u, 967942800u, 986083200u, 999392400u, 1018137600u, 1030842000u,
+    1049587200u, 1062896400u, 1081036800u, 1094346000u, 1112486400u, 1125795600u,
+    1143936000u, 1157245200u, 1175385600u, 1188694800u, 1207440000u, 1220749200u,
+    1238889600u, 1252198800u, 1270339200u, 1283648400u, 1301788800u, 1315098000u,
+    1333238400u, 1346547600u, 1365292800u, 1377997200u, 1396742400u, 1410051600u,
+    1428192000u, 1441501200u, 1459641600u, 1472950800u, 1491091200u, 1504400400u,
+    9982800u, 25704000u, 41432400u, 57758400u, 73486800u, 89208000u,
+    104936400u, 120657600u, 126709200u, 152107200u, 162392400u, 183556800u,
+    199285200u, 215611200u, 230734800u, 247060800u, 262789200u, 278510400u,
+    294238800u, 309960000u, 325688400u, 341409600u, 357138000u, 372859200u,
+    388587600u, 404913600u, 420037200u, 436363200u, 452088000u, 467809200u,
+    483537600u, 499258800u, 514987200u, 530708400u, 544622400u, 562158000u,
+    576072000u, 594212400u, 607521600u, 625662000u, 638971200u, 657111600u,
+    671025600u, 688561200u, 702475200u, 720010800u, 733924800u, 752065200u,
+    765374400u, 783514800u, 796824000u, 814964400u, 828878400u, 846414000u,
+    860328000u, 877863600u, 891777600u, 909313200u, 923227200u, 941367600u,
+    954676800u, 972817200u, 986126400u, 1004266800u, 1018180800u, 1035716400u,
+    1049630400u, 1067166000u, 1081080000u, 1099220400u, 1112529600u, 1130670000u,
+    1143979200u, 1162119600u, 1173614400u, 9979200u, 25700400u, 41428800u,
+    57754800u, 73483200u, 89204400u, 104932800u, 120654000u, 126705600u,
+    152103600u, 162388800u, 183553200u, 199281600u, 215607600u, 230731200u,
+    247057200u, 262785600u, 278506800u, 294235200u, 309956400u, 325684800u,
+    341406000u, 357134400u, 372855600u, 388584000u, 404910000u, 420033600u,
+    436359600u, 452084400u, 467805600u, 483534000u, 499255200u, 514983600u,
+    530704800u, 544618800u, 562154400u, 576068400u, 594208800u, 607518000u,
+    625658400u, 638967600u, 657108000u, 671022000u, 688557600u, 702471600u,
+    720007200u, 733921200u, 752061600u, 765370800u, 783511200u, 796820400u,
+    814960800u, 828874800u, 846410400u, 860324400u, 877860000u, 891774000u,
+    909309600u, 923223600u, 941364000u, 954673200u, 972813600u, 986122800u,
+    1004263200u, 1018177200u, 1035712800u, 1049626800u, 1067162400u, 1081076400u,
+    1099216800u, 1112526000u, 1130666400u, 1143975600u, 1162116000u, 1173610800u,
+    499748400u, 511236000u, 530593200u, 540266400u, 562129200u, 571197600u,
+    592974000u, 602042400u, 624423600u, 634701600u, 813726000u, 824004000u,
+    844570800u, 856058400u, 876106800u, 888717600u, 908074800u, 919562400u,
+    938919600u, 951616800u, 970974000u, 982461600u, 1003028400u, 1013911200u,
+    1036292400u, 1045360800u, 1350788400u, 1361066400u, 128142000u, 136605600u,
+    596948400u, 605066400u, 624423600u, 636516000u, 656478000u, 667965600u,
+    687927600u, 699415200u, 719377200u, 731469600u, 938919600u, 952052400u,
+    1198983600u, 1205632800u, 1224385200u, 1237082400u, 128142000u, 136605600u,
+    596948400u, 605066400u, 624423600u, 636516000u, 656478000u, 667965600u,
+    687931200u, 699415200u, 719377200u, 731469600u, 938919600u, 952052400u,
+    1086058800u, 1087704000u, 1198983600u, 1205632800u, 128142000u, 136605600u,
+    596948400u, 605066400u, 624423600u, 636516000u, 656478000u, 667965600u,
+    687931200u, 699415200u, 719377200u, 731469600u, 938919600u, 952052400u,
+    1198983600u, 1205632800u, 1224385200u, 1237082400u, 128142000u, 136605600u,
+    596948400u, 605066400u, 624423600u, 636516000u, 657086400u, 669178800u,
+    686721600u, 699415200u, 719377200u, 731469600u, 938919600u, 952052400u,
+    1198983600u, 1205632800u, 128142000u, 136605600u, 596948400u, 605066400u,
+    624423600u, 636516000u, 656478000u, 667792800u, 673588800u, 687927600u,
+    699415200u, 719377200u, 731469600u, 938919600u, 952052400u, 1086058800u,
+    1087704000u, 1198983600u, 1205632800u, 128142000u, 136605600u, 596948400u,
+    605066400u, 624423600u, 636516000u, 655963200u, 667796400u, 687499200u,
+    699418800u, 719380800u, 731469600u, 938919600u, 952052400u, 1085281200u,
+    1096171200u, 1198983600u, 1205632800u, 128142000u, 136605600u, 596948400u,
+    605066400u, 624423600u, 636516000u, 656478000u, 667965600u, 687927600u,
+    699415200u, 719377200u, 731469600u, 938919600u, 952052400u, 1086058800u,
+    1087704000u, 1198983600u, 1205632800u, 128142000u, 136605600u, 596948400u,
+    605066400u, 624423600u, 636516000u, 656478000u, 667965600u, 687931200u,
+    699415200u, 719377200u, 731469600u, 938919600u, 952052400u, 1198983600u,
+    1205632800u, 128142000u, 136605600u, 596948400u, 605066400u, 624423600u,
+    636516000u, 656478000u, 667792800u, 673588800u, 687927600u, 699415200u,
+    719377200u, 731469600u, 938919600u, 952052400u, 1085972400u, 1090728000u,
+    1198983600u, 1205632800u, 128142000u, 136605600u, 596948400u, 605066400u,
+    624423600u, 637380000u, 655963200u, 667796400u, 675748800u, 938919600u,
+    952052400u, 1085972400u, 1090728000u, 1198983600u, 1200880800u, 1205031600u,
+    1223784000u, 1236481200u, 1255233600u, 128142000u, 136605600u, 596948400u,
+    605066400u, 624423600u, 636516000u, 656478000u, 667965600u, 687931200u,
+    699415200u, 719377200u, 731469600u, 938919600u, 952052400u, 1086058800u,
+    1087099200u, 1198983600u, 1205632800u, 1224385200u, 1237082400u, 128142000u,
+    136605600u, 596948400u, 605066400u, 624423600u, 636516000u, 656478000u,
+    667965600u, 687927600u, 699415200u, 719377200u, 731469600u, 938919600u,
+    952052400u, 1085886000u, 1087704000u, 1198983600u, 1205632800u, 86760000u,
+    134017200u, 181368000u, 194497200u, 212990400u, 226033200u, 244526400u,
+    257569200u, 276062400u, 291783600u, 307598400u, 323406000u, 339220800u,
+    354942000u, 370756800u, 386478000u, 402292800u, 418014000u, 433828800u,
+    449636400u, 465451200u, 481172400u, 496987200u, 512708400u, 528523200u,
+    544244400u, 560059200u, 575866800u, 591681600u, 607402800u, 625032000u,
+    638938800u, 654753600u, 670474800u, 686721600u, 699418800u, 718257600u,
+    733546800u, 749448000u, 762318000u, 780984000u, 793767600u, 812520000u,
+    825649200u, 844574400u, 856666800u, 876024000u, 888721200u, 907473600u,
+    920775600u, 938923200u, 952225200u, 970372800u, 983674800u, 1002427200u,
+    1018148400u, 1030852800u, 1049598000u, 1062907200u, 1081047600u, 1097985600u,
+    1110682800u, 1129435200u, 1142132400u, 1160884800u, 1173582000u, 1192939200u,
+    1205031600u, 1224388800u, 1236481200u, 1255838400u, 1270954800u, 1286078400u,
+    1302404400u, 1317528000u, 1333854000u, 1349582400u, 1364094000u, 1381032000u,
+    1395543600u, 1412481600u, 1426993200u, 1443931200u, 1459047600u, 1475380800u,
+    1490497200u, 1506830400u, 1521946800u, 1538884800u, 1553396400u, 1570334400u,
+    1584846000u, 1601784000u, 1616900400u, 1633233600u, 1648350000u, 1664683200u,
+    1679799600u, 1696132800u, 1711249200u, 1728187200u, 1728961200u, 499748400u,
+    511236000u, 530593200u, 540266400u, 562129200u, 571197600u, 592974000u,
+    602042400u, 624423600u, 634701600u, 656478000u, 666756000u, 687927600u,
+    697600800u, 719982000u, 728445600u, 750826800u, 761709600u, 782276400u,
+    793159200u, 813726000u, 824004000u, 844570800u, 856058400u, 876106800u,
+    888717600u, 908074800u, 919562400u, 938919600u, 951616800u, 970974000u,
+    982461600u, 1003028400u, 1013911200u, 1036292400u, 1045360800u, 1318734000u,
+    1330221600u, 828867600u, 846403200u, 860317200u, 877852800u, 891766800u,
+    909302400u, 923216400u, 941356800u, 954666000u, 972806400u, 989139600u,
+    1001836800u, 1018170000u, 1035705600u, 1049619600u, 1067155200u, 1081069200u,
+    1099209600u, 1112518800u, 1130659200u, 1143968400u, 1162108800u, 1175418000u,
+    1193558400u, 1207472400u, 1225008000u, 1238922000u, 1256457600u, 1270371600u,
+    1288508400u, 1301817600u, 1319958000u, 1333267200u, 1351407600u, 1365321600u,
+    1382857200u, 1396771200u, 1414306800u, 1428220800u, 1445756400u, 1459670400u,
+    1477810800u, 1491120000u, 1509260400u, 1522569600u, 1540710000u, 1554624000u,
+    1572159600u, 1586073600u, 1603609200u, 1617523200u, 1635663600u, 1648972800u,
+    1667113200u, 234943200u, 244616400u, 261554400u, 276066000u, 293004000u,
+    307515600u, 325058400u, 338706000u, 499748400u, 511236000u, 530593200u,
+    540266400u, 562129200u, 571197600u, 123919200u, 129618000u, 409039200u,
+    413874000u, 499752000u, 511239600u, 530596800u, 540270000u, 562132800u,
+    571201200u, 938923200u, 951620400u, 970977600u, 971578800u, 704869200u,
+    729057600u, 9968400u, 25689600u, 41418000u, 57744000u, 73472400u,
+    89193600u, 104922000u, 120643200u, 129114000u, 152092800u, 162378000u,
+    183542400u, 199270800u, 215596800u, 230720400u, 247046400u, 262774800u,
+    278496000u, 294224400u, 309945600u, 325674000u, 341395200u, 357123600u,
+    372844800u, 388573200u, 404899200u, 420022800u, 436348800u, 452077200u,
+    467798400u, 483526800u, 499248000u, 514976400u, 530697600u, 544611600u,
+    562147200u, 576061200u, 594201600u, 607510800u, 625651200u, 638960400u,
+    657100800u, 671014800u, 688550400u, 702464400u, 720000000u, 733914000u,
+    752054400u, 765363600u, 783504000u, 796813200u, 814953600u, 828867600u,
+    846403200u, 860317200u, 877852800u, 891766800u, 909302400u, 923216400u,
+    941356800u, 954666000u, 972806400u, 986115600u, 1004256000u, 1018170000u,
+    1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u,
+    1130659200u, 1143968400u, 1162108800u, 1173603600u, 73472400u, 89193600u,
+    104922000u, 120643200u, 136371600u, 152092800u, 167821200u, 183542400u,
+    199270800u, 215596800u, 230720400u, 247046400u, 262774800u, 278496000u,
+    294224400u, 309945600u, 325674000u, 341395200u, 357123600u, 372844800u,
+    388573200u, 404899200u, 420022800u, 436348800u, 452077200u, 467798400u,
+    483526800u, 499248000u, 514976400u, 530697600u, 544611600u, 562147200u,
+    576061200u, 594201600u, 607510800u, 625651200u, 638960400u, 657100800u,
+    671014800u, 688550400u, 702464400u, 720000000u, 733914000u, 752054400u,
+    765363600u, 783504000u, 796813200u, 814953600u, 828867600u, 846403200u,
+    860317200u, 877852800u, 891766800u, 909302400u, 923216400u, 941356800u,
+    954662400u, 972802800u, 973400400u, 986115600u, 1004256000u, 1018170000u,
+    1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u,
+    1130659200u, 1143968400u, 1162108800u, 1173603600u, 499752000u, 511239600u,
+    530596800u, 540270000u, 562132800u, 571201200u, 592977600u, 602046000u,
+    624427200u, 634705200u, 656481600u, 666759600u, 687931200u, 697604400u,
+    719985600u, 728449200u, 750830400u, 761713200u, 782280000u, 793162800u,
+    813729600u, 824007600u, 844574400u, 856062000u, 876110400u, 888721200u,
+    908078400u, 919566000u, 938923200u, 951620400u, 970977600u, 982465200u,
+    1003032000u, 1013914800u, 1036296000u, 1045364400u, 1066536000u, 1076814000u,
+    1099368000u, 1108868400u, 1129435200u, 1140318000u, 1162699200u, 1172372400u,
+    1192334400u, 1203217200u, 1224388800u, 1234666800u, 1255838400u, 1266721200u,
+    1287288000u, 1298170800u, 1318737600u, 1330225200u, 1350792000u, 1361070000u,
+    1382241600u, 1392519600u, 1413691200u, 1424574000u, 1445140800u, 1456023600u,
+    1476590400u, 1487473200u, 1508040000u, 1518922800u, 1541304000u, 1550372400u,
+    378201600u, 410504400u, 828864000u, 846399600u, 860313600u, 877849200u,
+    891759600u, 902037600u, 909298800u, 923212800u, 941353200u, 954662400u,
+    972802800u, 989136000u, 1001833200u, 1018166400u, 1035702000u, 1049616000u,
+    1067151600u, 1081065600u, 1099206000u, 1112515200u, 1130655600u, 1143964800u,
+    1162105200u, 1175414400u, 1193554800u, 1207468800u, 1225004400u, 1238918400u,
+    1256454000u, 1270368000u, 1288508400u, 1301817600u, 1319958000u, 1333267200u,
+    1351407600u, 1365321600u, 1382857200u, 1396771200u, 1414306800u, 1422777600u,
+    1197183600u, 1462086000u, 9964800u, 25686000u, 41414400u, 57740400u,
+    73468800u, 89190000u, 104918400u, 120639600u, 126691200u, 152089200u,
+    162374400u, 183538800u, 199267200u, 215593200u, 230716800u, 247042800u,
+    262771200u, 278492400u, 294220800u, 309942000u, 325670400u, 341391600u,
+    357120000u, 372841200u, 388569600u, 404895600u, 420019200u, 436345200u,
+    452073600u, 467794800u, 483523200u, 499244400u, 514972800u, 530694000u,
+    544608000u, 562143600u, 576057600u, 594198000u, 607507200u, 625647600u,
+    638956800u, 657097200u, 671011200u, 688546800u, 702460800u, 719996400u,
+    733910400u, 752050800u, 765360000u, 783500400u, 796809600u, 814950000u,
+    828864000u, 846399600u, 860313600u, 877849200u, 891763200u, 909298800u,
+    923212800u, 941353200u, 954662400u, 972802800u, 986112000u, 1004252400u,
+    1018166400u, 1035702000u, 1049616000u, 1067151600u, 1081065600u, 1099206000u,
+    1112515200u, 1130655600u, 1143964800u, 1162105200u, 1173600000u, 828864000u,
+    846399600u, 860313600u, 877849200u, 891766800u, 909302400u, 923216400u,
+    941356800u, 954666000u, 972806400u, 989139600u, 1001836800u, 1018170000u,
+    1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u,
+    1130659200u, 1143968400u, 1162108800u, 1175418000u, 1193558400u, 1207472400u,
+    1225008000u, 1238922000u, 1256457600u, 1270371600u, 1288512000u, 1301821200u,
+    1319961600u, 1333270800u, 1351411200u, 1365325200u, 1382860800u, 1396774800u,
+    1414310400u, 1428224400u, 1445760000u, 1459674000u, 1477814400u, 1491123600u,
+    1509264000u, 1522573200u, 1540713600u, 1554627600u, 1572163200u, 1586077200u,
+    1603612800u, 1617526800u, 1635667200u, 1648976400u, 1667116800u, 828864000u,
+    846399600u, 860313600u, 877849200u, 891766800u, 909302400u, 923216400u,
+    941356800u, 954666000u, 972806400u, 989139600u, 1001836800u, 1018170000u,
+    1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u,
+    1130659200u, 1143968400u, 1162108800u, 1175418000u, 1193558400u, 1207472400u,
+    1225008000u, 1238922000u, 1256457600u, 1268557200u, 1289116800u, 1300006800u,
+    1320566400u, 1331456400u, 1352016000u, 1362906000u, 1383465600u, 1394355600u,
+    1414915200u, 1425805200u, 1446364800u, 1457859600u, 1478419200u, 1489309200u,
+    1509868800u, 1520758800u, 1541318400u, 1552208400u, 1572768000u, 1583658000u,
+    1604217600u, 1615712400u, 1636272000u, 1647162000u, 1667116800u, 1669788000u,
+    1678611600u, 288770400u, 297234000u, 320220000u, 328683600u, 664264800u,
+    678344400u, 695714400u, 700635600u, 7527600u, 24465600u, 37767600u,
+    55915200u, 69217200u, 87969600u, 100666800u, 118209600u, 132116400u,
+    150868800u, 163566000u, 182318400u, 195620400u, 213768000u, 227070000u,
+    245217600u, 258519600u, 277272000u, 289969200u, 308721600u, 321418800u,
+    340171200u, 353473200u, 371620800u, 384922800u, 403070400u, 416372400u,
+    434520000u, 447822000u, 466574400u, 479271600u, 498024000u, 510721200u,
+    529473600u, 545194800u, 560923200u, 574225200u, 592372800u, 605674800u,
+    624427200u, 637124400u, 653457600u, 668574000u, 687326400u, 700628400u,
+    718776000u, 732078000u, 750225600u, 763527600u, 781675200u, 794977200u,
+    813729600u, 826426800u, 845179200u, 859690800u, 876628800u, 889930800u,
+    906868800u, 923194800u, 939528000u, 952830000u, 971582400u, 984279600u,
+    1003032000u, 1015729200u, 1034481600u, 1047178800u, 1065931200u, 1079233200u,
+    1097380800u, 1110682800u, 1128830400u, 1142132400u, 1160884800u, 1173582000u,
+    1192334400u, 1206846000u, 1223784000u, 1237086000u, 1255233600u, 1270350000u,
+    1286683200u, 1304823600u, 1313899200u, 1335668400u, 1346558400u, 1367118000u,
+    1378612800u, 1398567600u, 1410062400u, 1463281200u, 1471147200u, 1494730800u,
+    1502596800u, 1526180400u, 1534046400u, 1554606000u, 1567915200u, 1586055600u,
+    1599364800u, 1617505200u, 1630814400u, 1648954800u, 1662868800u, 1680404400u,
+    1693713600u, 1712458800u, 1725768000u, 1742439600u, 499752000u, 511239600u,
+    530596800u, 540270000u, 562132800u, 571201200u, 592977600u, 602046000u,
+    624427200u, 634705200u, 656481600u, 666759600u, 687931200u, 697604400u,
+    719985600u, 728449200u, 750830400u, 761713200u, 782280000u, 793162800u,
+    813729600u, 824007600u, 844574400u, 856062000u, 876110400u, 888721200u,
+    908078400u, 919566000u, 938923200u, 951620400u, 970977600u, 982465200u,
+    1003032000u, 1013914800u, 1036296000u, 1045364400u, 1099368000u, 1108868400u,
+    1129435200u, 1140318000u, 1162699200u, 1172372400u, 1192334400u, 1203217200u,
+    1224388800u, 1234666800u, 1255838400u, 1266721200u, 1287288000u, 1298170800u,
+    1318737600u, 1330225200u, 1350792000u, 1361070000u, 1382241600u, 1392519600u,
+    1413691200u, 1424574000u, 1445140800u, 1456023600u, 1476590400u, 1487473200u,
+    1508040000u, 1518922800u, 1541304000u, 1550372400u, 323845200u, 338950800u,
+    354675600u, 370400400u, 386125200u, 401850000u, 417574800u, 433299600u,
+    449024400u, 465354000u, 481078800u, 496803600u, 512528400u, 528253200u,
+    543978000u, 559702800u, 575427600u, 591152400u, 606877200u, 622602000u,
+    638326800u, 654656400u, 670381200u, 686106000u, 701830800u, 717555600u,
+    733280400u, 749005200u, 764730000u, 780454800u, 796179600u, 811904400u,
+    820465200u, 120646800u, 325677600u, 341398800u, 357127200u, 372848400u,
+    388576800u, 404902800u, 420026400u, 436352400u, 452080800u, 467802000u,
+    483530400u, 499251600u, 514980000u, 530701200u, 544615200u, 562150800u,
+    576064800u, 594205200u, 607514400u, 625654800u, 638964000u, 657104400u,
+    671018400u, 688554000u, 702468000u, 720003600u, 733917600u, 752058000u,
+    765367200u, 783507600u, 796816800u, 814957200u, 828871200u, 846406800u,
+    860320800u, 877856400u, 891770400u, 909306000u, 923220000u, 941360400u,
+    954669600u, 972810000u, 986119200u, 1004259600u, 1018173600u, 1035709200u,
+    1049623200u, 1067158800u, 1081072800u, 1099213200u, 1112522400u, 1130662800u,
+    1143972000u, 1162112400u, 1173607200u, 1194166800u, 1205056800u, 1225616400u,
+    1236506400u, 1257066000u, 1268560800u, 1289120400u, 1300010400u, 1320570000u,
+    1331460000u, 1352019600u, 1362909600u, 1383469200u, 1394359200u, 1414918800u,
+    1425808800u, 1446368400u, 1457863200u, 1478422800u, 1489312800u, 1509872400u,
+    1520762400u, 1541322000u, 1552212000u, 1572771600u, 1583661600u, 1604214000u,
+    9972000u, 25693200u, 41421600u, 57747600u, 73476000u, 84013200u,
+    9968400u, 25689600u, 41418000u, 57744000u, 73472400u, 89193600u,
+    104922000u, 120643200u, 126694800u, 152092800u, 162378000u, 183542400u,
+    199270800u, 215596800u, 230720400u, 247046400u, 262774800u, 278496000u,
+    294224400u, 309945600u, 325674000u, 341395200u, 357123600u, 372844800u,
+    388573200u, 404899200u, 420022800u, 436348800u, 452077200u, 467798400u,
+    483526800u, 499248000u, 514976400u, 530697600u, 544611600u, 562147200u,
+    576061200u, 594201600u, 607510800u, 625651200u, 638960400u, 657100800u,
+    671014800u, 688550400u, 702464400u, 720000000u, 733914000u, 752054400u,
+    765363600u, 783504000u, 796813200u, 814953600u, 828867600u, 846403200u,
+    860317200u, 877852800u, 891766800u, 909302400u, 923216400u, 941356800u,
+    954666000u, 972806400u, 986115600u, 1004256000u, 1018170000u, 1035705600u,
+    1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u, 1130659200u,
+    1143968400u, 1162108800u, 1173603600u, 104914800u, 120636000u, 126687600u,
+    152085600u, 167814000u, 183535200u, 199263600u, 215589600u, 230713200u,
+    247039200u, 262767600u, 278488800u, 294217200u, 309938400u, 325666800u,
+    341388000u, 357116400u, 372837600u, 388566000u, 404892000u, 420015600u,
+    436341600u, 452070000u, 467791200u, 483519600u, 499240800u, 514969200u,
+    530690400u, 544604400u, 562140000u, 576054000u, 594194400u, 607503600u,
+    625644000u, 638953200u, 657093600u, 671007600u, 688543200u, 702457200u,
+    719992800u, 733906800u, 752047200u, 765356400u, 783496800u, 796806000u,
+    814946400u, 828860400u, 846396000u, 860310000u, 877845600u, 891759600u,
+    909295200u, 923209200u, 941349600u, 954658800u, 972799200u, 986108400u,
+    1004248800u, 1018162800u, 1035698400u, 1049612400u, 1067148000u, 1081062000u,
+    1099202400u, 1112511600u, 1130652000u, 1143961200u, 1162101600u, 1173596400u,
+    73472400u, 89193600u, 104922000u, 120643200u, 136371600u, 152092800u,
+    167821200u, 183542400u, 199270800u, 215596800u, 230720400u, 247046400u,
+    262774800u, 278496000u, 294224400u, 309945600u, 325674000u, 341395200u,
+    357123600u, 372844800u, 388573200u, 404899200u, 420022800u, 436348800u,
+    452077200u, 467798400u, 483526800u, 499248000u, 514976400u, 530697600u,
+    544611600u, 562147200u, 576061200u, 594201600u, 607510800u, 625651200u,
+    638960400u, 657100800u, 671014800u, 688550400u, 702464400u, 720000000u,
+    733914000u, 752054400u, 765363600u, 783504000u, 796813200u, 814953600u,
+    828867600u, 846403200u, 860317200u, 877852800u, 891766800u, 909302400u,
+    923216400u, 941356800u, 954666000u, 972806400u, 986115600u, 1004256000u,
+    1018170000u, 1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u,
+    1112518800u, 1130659200u, 1143968400u, 1162108800u, 1173603600u, 499755600u,
+    511243200u, 530600400u, 540273600u, 562136400u, 571204800u, 750834000u,
+    761716800u, 1214283600u, 1384056000u, 547020000u, 559717200u, 578469600u,
+    591166800u, 199274400u, 215600400u, 230724000u, 247050000u, 262778400u,
+    278499600u, 294228000u, 309949200u, 325677600u, 341398800u, 357127200u,
+    372848400u, 388576800u, 404902800u, 420026400u, 436352400u, 452080800u,
+    467802000u, 483530400u, 499251600u, 514980000u, 530701200u, 544615200u,
+    562150800u, 576064800u, 594205200u, 607514400u, 625654800u, 638964000u,
+    657104400u, 671018400u, 688554000u, 702468000u, 720003600u, 733917600u,
+    752058000u, 765367200u, 783507600u, 796816800u, 814957200u, 828871200u,
+    846406800u, 860320800u, 877856400u, 891770400u, 909306000u, 923220000u,
+    941360400u, 954669600u, 972810000u, 986119200u, 1004259600u, 1018173600u,
+    1035709200u, 1049623200u, 1067158800u, 1081072800u, 1099213200u, 1112522400u,
+    1130662800u, 1143972000u, 1162112400u, 1175421600u, 1193562000u, 1207476000u,
+    1225011600u, 1238925600u, 1256461200u, 1268560800u, 9972000u, 25693200u,
+    41421600u, 57747600u, 73476000u, 89197200u, 104925600u, 120646800u,
+    136375200u, 152096400u, 167824800u, 183546000u, 199274400u, 215600400u,
+    230724000u, 247050000u, 262778400u, 278499600u, 294228000u, 309949200u,
+    325677600u, 341398800u, 357127200u, 372848400u, 388576800u, 404902800u,
+    420026400u, 436352400u, 452080800u, 467802000u, 483530400u, 499251600u,
+    514980000u, 530701200u, 544615200u, 562150800u, 576064800u, 594205200u,
+    607514400u, 625654800u, 638964000u, 657104400u, 671018400u, 688554000u,
+    702468000u, 720003600u, 733917600u, 752058000u, 765367200u, 783507600u,
+    796816800u, 814957200u, 828871200u, 846406800u, 860320800u, 877856400u,
+    891770400u, 909306000u, 923220000u, 941360400u, 954669600u, 972810000u,
+    986119200u, 1004259600u, 1018173600u, 1035709200u, 1049623200u, 1067158800u,
+    1081072800u, 1099213200u, 1112522400u, 1130662800u, 1143972000u, 1162112400u,
+    1173607200u, 1194166800u, 1205056800u, 1225616400u, 1236506400u, 1257066000u,
+    1268560800u, 1289120400u, 1300010400u, 1320570000u, 1331460000u, 1352019600u,
+    1362909600u, 1383469200u, 1394359200u, 1414918800u, 1425808800u, 9961200u,
+    25682400u, 1143961200u, 1162101600u, 1173596400u, 499748400u, 511236000u,
+    530593200u, 540266400u, 562129200u, 571197600u, 592974000u, 602042400u,
+    624423600u, 634701600u, 938919600u, 951616800u, 970974000u, 972180000u,
+    1003028400u, 1013911200u, 73461600u, 89182800u, 104911200u, 120632400u,
+    136360800u, 152082000u, 167810400u, 183531600u, 199260000u, 215586000u,
+    230709600u, 247035600u, 262764000u, 278485200u, 294213600u, 309934800u,
+    325663200u, 341384400u, 357112800u, 372834000u, 388562400u, 404888400u,
+    420012000u, 436338000u, 452066400u, 467787600u, 483516000u, 499237200u,
+    514965600u, 530686800u, 544600800u, 562136400u, 576050400u, 594190800u,
+    607500000u, 625640400u, 638949600u, 657090000u, 671004000u, 688539600u,
+    702453600u, 719989200u, 733903200u, 752043600u, 765352800u, 783493200u,
+    796802400u, 814942800u, 828856800u, 846392400u, 860306400u, 877842000u,
+    891756000u, 909291600u, 923205600u, 941346000u, 954655200u, 972795600u,
+    986104800u, 1004245200u, 1018159200u, 1035694800u, 1049608800u, 1067144400u,
+    1081058400u, 1099198800u, 1112508000u, 1130648400u, 1143957600u, 1162098000u,
+    1173592800u, 323845200u, 338950800u, 354675600u, 370400400u, 386125200u,
+    401850000u, 417574800u, 433299600u, 449024400u, 465354000u, 481078800u,
+    496803600u, 512528400u, 528253200u, 543978000u, 559702800u, 575427600u,
+    591152400u, 606877200u, 622602000u, 638326800u, 654656400u, 670381200u,
+    686106000u, 701830800u, 717555600u, 733280400u, 749005200u, 764730000u,
+    780454800u, 796179600u, 811904400u, 828234000u, 846378000u, 859683600u,
+    877827600u, 891133200u, 909277200u, 922582800u, 941331600u, 954032400u,
+    972781200u, 985482000u, 1004230800u, 1017536400u, 1035680400u, 1048986000u,
+    1067130000u, 1080435600u, 1099184400u, 1111885200u, 1130634000u, 1143334800u,
+    1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u, 1238288400u,
+    1256432400u, 1269738000u, 1288486800u, 1301187600u, 1319936400u, 1332637200u,
+    1351386000u, 1364691600u, 1382835600u, 1396141200u, 1414285200u, 1427590800u,
+    1445734800u, 1459040400u, 1477789200u, 1490490000u, 1509238800u, 1521939600u,
+    1540688400u, 1553994000u, 1572138000u, 1585443600u, 1603587600u, 1616893200u,
+    1635642000u, 1648342800u, 1667091600u, 1679792400u, 1711846800u, 9957600u,
+    25678800u, 41407200u, 57733200u, 73461600u, 89182800u, 104911200u,
+    120632400u, 136360800u, 152082000u, 167810400u, 183531600u, 199260000u,
+    215586000u, 230709600u, 247035600u, 262764000u, 278485200u, 294213600u,
+    309934800u, 325663200u, 341384400u, 357112800u, 372834000u, 388562400u,
+    404888400u, 420012000u, 436338000u, 452066400u, 467787600u, 483516000u,
+    499237200u, 514965600u, 530686800u, 544593660u, 562129260u, 576043260u,
+    594180060u, 607492860u, 625633260u, 638942460u, 657082860u, 670996860u,
+    688532460u, 702446460u, 719982060u, 733896060u, 752036460u, 765345660u,
+    783486060u, 796795260u, 814935660u, 828849660u, 846385260u, 860299260u,
+    877834860u, 891748860u, 909284460u, 923198460u, 941338860u, 954648060u,
+    972788460u, 986097660u, 1004238060u, 1018152060u, 1035687660u, 1049601660u,
+    1067137260u, 1081051260u, 1099191660u, 1112500860u, 1130641260u, 1143950460u,
+    1162090860u, 1173585660u, 1194145260u, 1205035260u, 1225594860u, 1236484860u,
+    1257044460u, 1268539260u, 1289098860u, 1299988860u, 1320555600u, 294217200u,
+    309938400u, 325666800u, 341388000u, 357116400u, 372837600u, 388566000u,
+    404892000u, 420015600u, 436341600u, 452070000u, 467791200u, 483519600u,
+    499240800u, 514969200u, 530690400u, 544604400u, 562140000u, 576054000u,
+    594194400u, 607503600u, 625644000u, 638953200u, 657093600u, 671007600u,
+    688543200u, 702457200u, 719992800u, 733906800u, 752047200u, 765356400u,
+    783496800u, 796806000u, 814946400u, 828860400u, 846396000u, 860310000u,
+    877845600u, 891759600u, 909295200u, 923209200u, 941349600u, 954658800u,
+    972799200u, 986108400u, 1004248800u, 1018162800u, 1035698400u, 1049612400u,
+    1067148000u, 1081062000u, 1099202400u, 1112511600u, 1130652000u, 1143961200u,
+    1162101600u, 1173596400u, 1194156000u, 1205046000u, 1225605600u, 1236495600u,
+    1257055200u, 1268550000u, 1289109600u, 1299999600u, 1320559200u, 1331449200u,
+    1352008800u, 1362898800u, 1383458400u, 1394348400u, 1414908000u, 1425798000u,
+    1520751600u, 123055200u, 130914000u, 422344800u, 433054800u, 669708000u,
+    684219600u, 1146376800u, 1159678800u, 722926800u, 728884800u, 176096700u,
+    701841600u, 9957600u, 25678800u, 41407200u, 57733200u, 73461600u,
+    89182800u, 104911200u, 120632400u, 136360800u, 152082000u, 167810400u,
+    183531600u, 199260000u, 215586000u, 230709600u, 247035600u, 262764000u,
+    278485200u, 294213600u, 309934800u, 325663200u, 341384400u, 357112800u,
+    372834000u, 388562400u, 404888400u, 420012000u, 436338000u, 452066400u,
+    467787600u, 483516000u, 499237200u, 514965600u, 530686800u, 544600800u,
+    562136400u, 576050400u, 594190800u, 607500000u, 625640400u, 638949600u,
+    657090000u, 671004000u, 688539600u, 702453600u, 719989200u, 733903200u,
+    752043600u, 765352800u, 783493200u, 796802400u, 814942800u, 828856800u,
+    846392400u, 860306400u, 877842000u, 891756000u, 909291600u, 923205600u,
+    941346000u, 954655200u, 972795600u, 986104800u, 1004245200u, 1018159200u,
+    1035694800u, 1049608800u, 1067144400u, 1081058400u, 1099198800u, 1112508000u,
+    1130648400u, 1143957600u, 1162098000u, 1173592800u, 9954000u, 25675200u,
+    41403600u, 57729600u, 73458000u, 87364800u, 104907600u, 118900800u,
+    136357200u, 150436800u, 167806800u, 183528000u, 199256400u, 215582400u,
+    230706000u, 247032000u, 263365200u, 276667200u, 290581200u, 308721600u,
+    322030800u, 340171200u, 358318800u, 371620800u, 389768400u, 403070400u,
+    421218000u, 434520000u, 452667600u, 466574400u, 484117200u, 498024000u,
+    511333200u, 529473600u, 542782800u, 560923200u, 574837200u, 592372800u,
+    606286800u, 623822400u, 638946000u, 655876800u, 671000400u, 687330000u,
+    702450000u, 718779600u, 733899600u, 750229200u, 765349200u, 781678800u,
+    796798800u, 813128400u, 828853200u, 844578000u, 860302800u, 876632400u,
+    891147600u, 909291600u, 922597200u, 941346000u, 954651600u, 972795600u,
+    986101200u, 1004245200u, 1018155600u, 1035694800u, 1049605200u, 1067144400u,
+    1080450000u, 1162098000u, 1173589200u, 1193547600u, 1205643600u, 1224997200u,
+    1236488400u, 1256446800u, 1268542800u, 1288501200u, 1300597200u, 1321160400u,
+    1333256400u, 1352005200u, 828867600u, 846403200u, 860317200u, 877852800u,
+    891766800u, 909302400u, 9964800u, 25686000u, 41414400u, 57740400u,
+    73468800u, 89190000u, 104918400u, 120639600u, 126691200u, 152089200u,
+    162374400u, 183538800u, 199267200u, 215593200u, 230716800u, 247042800u,
+    262771200u, 278492400u, 294220800u, 309942000u, 325670400u, 341391600u,
+    357120000u, 372841200u, 388569600u, 404895600u, 420019200u, 436345200u,
+    452073600u, 467794800u, 483523200u, 499244400u, 514972800u, 530694000u,
+    544608000u, 562143600u, 576057600u, 594198000u, 607507200u, 625647600u,
+    638956800u, 657097200u, 671011200u, 688546800u, 1143961200u, 1162105200u,
+    1173600000u, 9961200u, 25682400u, 41410800u, 57736800u, 73465200u,
+    89186400u, 104914800u, 120636000u, 126687600u, 152089200u, 162370800u,
+    183535200u, 1143961200u, 1162101600u, 1173596400u, 9964800u, 25686000u,
+    41414400u, 57740400u, 73468800u, 89190000u, 104918400u, 120639600u,
+    126691200u, 152089200u, 162374400u, 183538800u, 199267200u, 215593200u,
+    230716800u, 247042800u, 1143961200u, 1162105200u, 1173600000u, 1194159600u,
+    1205046000u, 9961200u, 25682400u, 1143961200u, 1162105200u, 1173600000u,
+    9961200u, 25682400u, 41410800u, 57736800u, 73465200u, 89186400u,
+    1143961200u, 1162101600u, 1173596400u, 9961200u, 25682400u, 1143961200u,
+    1162105200u, 1173600000u, 1194159600u, 1205046000u, 9961200u, 25682400u,
+    1143961200u, 1162105200u, 1173600000u, 1194156000u, 73476000u, 89197200u,
+    104925600u, 120646800u, 136375200u, 152096400u, 167824800u, 183546000u,
+    199274400u, 215600400u, 230724000u, 247050000u, 262778400u, 278499600u,
+    294228000u, 309945600u, 325674000u, 341395200u, 357123600u, 372844800u,
+    388573200u, 404899200u, 420022800u, 436348800u, 452077200u, 467798400u,
+    483526800u, 499248000u, 514976400u, 530697600u, 544611600u, 562147200u,
+    576061200u, 594201600u, 607510800u, 625651200u, 638960400u, 657100800u,
+    671014800u, 688550400u, 702464400u, 720000000u, 733914000u, 752054400u,
+    765363600u, 783504000u, 796813200u, 814953600u, 828867600u, 846403200u,
+    860317200u, 877852800u, 891766800u, 909302400u, 923216400u, 941356800u,
+    954666000u, 972806400u, 986115600u, 1004256000u, 1018170000u, 1035705600u,
+    1049619600u, 1067155200u, 1081069200u, 1099209600u, 1112518800u, 1130659200u,
+    1143968400u, 1162108800u, 1173603600u, 73465200u, 89186400u, 104914800u,
+    120636000u, 136364400u, 152085600u, 167814000u, 183535200u, 199263600u,
+    215589600u, 230713200u, 247039200u, 262767600u, 278488800u, 294217200u,
+    309938400u, 325666800u, 341388000u, 357116400u, 372837600u, 388566000u,
+    404892000u, 420015600u, 436341600u, 452070000u, 467791200u, 483519600u,
+    499240800u, 514969200u, 530690400u, 544604400u, 562140000u, 576054000u,
+    594194400u, 607503600u, 625644000u, 638953200u, 657093600u, 671007600u,
+    688543200u, 702457200u, 719992800u, 733906800u, 752047200u, 765356400u,
+    783496800u, 796806000u, 814946400u, 828860400u, 846396000u, 860310000u,
+    877845600u, 891759600u, 909295200u, 923209200u, 941349600u, 954662400u,
+    972802800u, 986108400u, 1004248800u, 1018162800u, 1035698400u, 1049612400u,
+    1067148000u, 1081062000u, 1099202400u, 1112511600u, 1130652000u, 1143961200u,
+    1162101600u, 1173596400u, 126687600u, 152085600u, 162370800u, 183535200u,
+    199263600u, 215589600u, 230713200u, 247039200u, 262767600u, 278488800u,
+    294217200u, 309938400u, 325666800u, 341388000u, 357116400u, 372837600u,
+    388566000u, 404892000u, 420015600u, 436341600u, 9972000u, 25693200u,
+    41421600u, 57747600u, 73476000u, 89197200u, 104925600u, 120646800u,
+    126698400u, 152096400u, 162381600u, 183546000u, 199274400u, 215600400u,
+    230724000u, 247050000u, 262778400u, 278499600u, 294228000u, 309949200u,
+    325677600u, 341402400u, 357127200u, 372848400u, 388576800u, 404902800u,
+    420026400u, 436352400u, 452084400u, 467805600u, 483534000u, 499255200u,
+    514983600u, 530704800u, 544618800u, 562154400u, 576068400u, 594208800u,
+    607518000u, 625658400u, 638967600u, 657108000u, 671022000u, 688557600u,
+    702471600u, 720007200u, 733921200u, 752061600u, 765370800u, 783511200u,
+    796820400u, 814960800u, 828874800u, 846410400u, 860324400u, 877860000u,
+    891774000u, 909309600u, 923223600u, 941364000u, 954673200u, 972813600u,
+    986122800u, 1004263200u, 1018177200u, 1035712800u, 1049626800u, 1067162400u,
+    1081076400u, 1099216800u, 1112526000u, 1130666400u, 1143975600u, 1162116000u,
+    1173610800u, 9961200u, 25682400u, 41410800u, 57736800u, 73465200u,
+    89186400u, 104914800u, 120636000u, 126687600u, 152089200u, 162370800u,
+    183535200u, 199263600u, 215589600u, 230713200u, 247039200u, 262767600u,
+    278488800u, 294217200u, 309938400u, 325666800u, 341388000u, 357116400u,
+    372837600u, 388566000u, 404892000u, 420015600u, 436341600u, 452070000u,
+    467791200u, 483519600u, 499240800u, 514969200u, 530690400u, 544604400u,
+    562140000u, 576054000u, 594194400u, 607503600u, 625644000u, 638953200u,
+    657093600u, 671007600u, 688543200u, 702457200u, 719992800u, 733906800u,
+    752047200u, 765356400u, 783496800u, 796806000u, 814946400u, 828860400u,
+    846396000u, 860310000u, 877845600u, 891759600u, 909295200u, 923209200u,
+    941349600u, 954658800u, 972799200u, 986108400u, 1004248800u, 1018162800u,
+    1035698400u, 1049612400u, 1067148000u, 1081062000u, 1099202400u, 1112511600u,
+    1130652000u, 1143961200u, 1162101600u, 1173596400u, 9964800u, 25686000u,
+    41414400u, 57740400u, 73468800u, 89190000u, 104918400u, 120639600u,
+    126691200u, 152089200u, 162374400u, 183538800u, 199267200u, 215593200u,
+    230716800u, 247042800u, 262771200u, 278492400u, 294220800u, 309942000u,
+    325670400u, 341391600u, 357120000u, 372841200u, 388569600u, 404895600u,
+    420019200u, 436345200u, 452073600u, 467794800u, 483523200u, 499244400u,
+    514972800u, 530694000u, 544608000u, 562143600u, 576057600u, 594198000u,
+    607507200u, 625647600u, 638956800u, 657097200u, 671011200u, 688546800u,
+    702460800u, 719996400u, 733910400u, 752050800u, 765360000u, 783500400u,
+    796809600u, 814950000u, 828864000u, 846399600u, 860313600u, 877849200u,
+    891763200u, 909298800u, 923212800u, 941353200u, 954662400u, 972802800u,
+    986108400u, 1004248800u, 1018162800u, 1035698400u, 1049612400u, 1067148000u,
+    1081062000u, 1099202400u, 1112511600u, 1130652000u, 1143961200u, 1162101600u,
+    1173596400u, 504939600u, 512712000u, 536475600u, 544248000u, 631170000u,
+    638942400u, 757400400u, 765172800u, 9972000u, 25693200u, 41421600u,
+    57747600u, 73476000u, 89197200u, 104925600u, 120646800u, 126698400u,
+    152096400u, 162381600u, 183546000u, 199274400u, 215600400u, 230724000u,
+    247050000u, 262778400u, 278499600u, 294228000u, 309949200u, 325677600u,
+    341398800u, 357127200u, 372848400u, 388576800u, 404902800u, 420026400u,
+    436352400u, 452080800u, 467802000u, 483530400u, 499251600u, 514980000u,
+    530701200u, 544615200u, 562150800u, 576064800u, 594205200u, 607514400u,
+    625654800u, 638964000u, 657104400u, 671018400u, 688554000u, 702468000u,
+    720003600u, 733917600u, 752058000u, 765367200u, 783507600u, 796816800u,
+    814957200u, 828871200u, 846406800u, 860320800u, 877856400u, 891770400u,
+    909306000u, 923220000u, 941360400u, 954669600u, 972810000u, 986119200u,
+    1004259600u, 1018173600u, 1035709200u, 1049623200u, 1067158800u, 1081072800u,
+    1099213200u, 1112522400u, 1130662800u, 1143972000u, 1162112400u, 1173607200u,
+    499748400u, 511236000u, 530593200u, 540266400u, 562129200u, 571197600u,
+    592974000u, 602042400u, 624423600u, 634701600u, 813726000u, 824004000u,
+    938919600u, 951616800u, 970974000u, 972180000u, 1003028400u, 1013911200u,
+    105084000u, 161758800u, 290584800u, 299134800u, 322034400u, 330584400u,
+    694260000u, 717310800u, 725868000u, 852094800u, 1113112800u, 1128229200u,
+    1146384000u, 1159682400u, 499752000u, 511239600u, 530596800u, 540270000u,
+    562132800u, 571201200u, 750830400u, 761713200u, 323841600u, 338958000u,
+    576057600u, 594198000u, 828864000u, 846399600u, 860313600u, 877849200u,
+    891763200u, 909298800u, 923212800u, 941353200u, 954662400u, 972802800u,
+    989136000u, 1001833200u, 1018166400u, 1035702000u, 1049616000u, 1067151600u,
+    1081065600u, 1099206000u, 1112515200u, 1130655600u, 1143964800u, 1162105200u,
+    1175414400u, 1193554800u, 1207468800u, 1225004400u, 1238918400u, 1256454000u,
+    1268553600u, 828867600u, 846403200u, 860317200u, 877852800u, 891766800u,
+    909302400u, 923216400u, 941356800u, 954666000u, 972806400u, 989139600u,
+    1001836800u, 1018170000u, 1035705600u, 1049619600u, 1067155200u, 1081069200u,
+    1099209600u, 1112518800u, 1130659200u, 1143968400u, 1162108800u, 1175418000u,
+    1193558400u, 1207472400u, 1225008000u, 1238922000u, 1256457600u, 1270371600u,
+    1288512000u, 1301821200u, 1319961600u, 1333270800u, 1351411200u, 1365325200u,
+    1382860800u, 1396774800u, 1414310400u, 1428224400u, 1445760000u, 1459674000u,
+    1477814400u, 1491123600u, 1509264000u, 1522573200u, 1540713600u, 1554627600u,
+    1572163200u, 1586077200u, 1603612800u, 1617526800u, 1635667200u, 1648976400u,
+    1667116800u, 104914800u, 120639600u, 126691200u, 152089200u, 162374400u,
+    183538800u, 199267200u, 215593200u, 230716800u, 247042800u, 262771200u,
+    278492400u, 294220800u, 309942000u, 325670400u, 341391600u, 357120000u,
+    372841200u, 388569600u, 404895600u, 420019200u, 436345200u, 452073600u,
+    467794800u, 483523200u, 499244400u, 514972800u, 530694000u, 544608000u,
+    562143600u, 576057600u, 594198000u, 607507200u, 625647600u, 638956800u,
+    657097200u, 671011200u, 688546800u, 702460800u, 719996400u, 733910400u,
+    752050800u, 765360000u, 783500400u, 796809600u, 814950000u, 828864000u,
+    846399600u, 860313600u, 877849200u, 891763200u, 909298800u, 923212800u,
+    941353200u, 954662400u, 972802800u, 986112000u, 1004252400u, 1018166400u,
+    1035702000u, 1049616000u, 1067151600u, 1081065600u, 1099206000u, 1112515200u,
+    1130655600u, 1143964800u, 1162105200u, 1173600000u, 378201600u, 405068400u,
+    828864000u, 846399600u, 860313600u, 877849200u, 891763200u, 909298800u,
+    923212800u, 941353200u, 954662400u, 972802800u, 989136000u, 1001833200u,
+    1018166400u, 1035702000u, 1049616000u, 1067151600u, 1081065600u, 1099206000u,
+    1112515200u, 1130655600u, 1143964800u, 1162105200u, 1175414400u, 1193554800u,
+    1207468800u, 1225004400u, 1238918400u, 1256454000u, 1270368000u, 1288508400u,
+    1301817600u, 1319958000u, 1333267200u, 1351407600u, 1365321600u, 1382857200u,
+    1396771200u, 1414306800u, 1428220800u, 1445756400u, 1459670400u, 1477810800u,
+    1491120000u, 1509260400u, 1522569600u, 1540710000u, 1554624000u, 1572159600u,
+    1586073600u, 1603609200u, 1617523200u, 1635663600u, 1648972800u, 1667113200u,
+    9972000u, 25693200u, 41421600u, 57747600u, 73476000u, 89197200u,
+    104925600u, 120646800u, 126698400u, 152096400u, 162381600u, 183546000u,
+    199274400u, 215600400u, 230724000u, 247050000u, 262778400u, 278499600u,
+    294228000u, 309949200u, 325677600u, 341398800u, 357127200u, 372848400u,
+    388576800u, 404902800u, 420026400u, 436352400u, 1446372000u, 1457866800u,
+    1478426400u, 1489316400u, 1509876000u, 1520766000u, 1541325600u, 1547978400u,
+    1552215600u, 828864000u, 846399600u, 860313600u, 877849200u, 891763200u,
+    909298800u, 923212800u, 941353200u, 954662400u, 972802800u, 989136000u,
+    1001833200u, 1018166400u, 1035702000u, 1049616000u, 1067151600u, 1081065600u,
+    1099206000u, 1112515200u, 1130655600u, 1143964800u, 1162105200u, 1175414400u,
+    1193554800u, 1207468800u, 1225004400u, 1238918400u, 1256454000u, 1270368000u,
+    1288508400u, 1301817600u, 1319958000u, 1333267200u, 1351407600u, 1365321600u,
+    1382857200u, 1396771200u, 1414306800u, 1428220800u, 1445756400u, 1459670400u,
+    1477810800u, 1491120000u, 1509260400u, 1522569600u, 1540710000u, 1554624000u,
+    1572159600u, 1586073600u, 1603609200u, 1617523200u, 1635663600u, 1648972800u,
+    1667113200u, 326001600u, 544597200u, 562132800u, 576046800u, 594187200u,
+    607496400u, 625636800u, 638946000u, 657086400u, 671000400u, 688536000u,
+    702450000u, 719985600u, 733899600u, 752040000u, 765349200u, 783489600u,
+    796798800u, 814939200u, 828853200u, 846388800u, 860302800u, 877838400u,
+    891752400u, 909288000u, 923202000u, 941342400u, 954651600u, 972792000u,
+    986101200u, 1004241600u, 1018155600u, 1035691200u, 1049605200u, 1067140800u,
+    1081054800u, 1099195200u, 1112504400u, 1130644800u, 1143954000u, 1162094400u,
+    1173589200u, 9957600u, 25678800u, 41407200u, 57733200u, 73461600u,
+    89182800u, 136360800u, 152082000u, 167810400u, 183531600u, 199260000u,
+    215586000u, 230709600u, 247035600u, 262764000u, 278485200u, 294213600u,
+    309934800u, 325663200u, 341384400u, 357112800u, 372834000u, 388562400u,
+    404888400u, 420012000u, 436338000u, 452066400u, 467787600u, 483516000u,
+    499237200u, 514965600u, 530686800u, 544600800u, 562136400u, 576050400u,
+    594190800u, 607500000u, 625640400u, 638949600u, 657090000u, 671004000u,
+    688539600u, 702453600u, 719989200u, 733896060u, 752036460u, 765345660u,
+    783486060u, 796795260u, 814935660u, 828849660u, 846385260u, 860299260u,
+    877834860u, 891748860u, 909284460u, 923198460u, 941338860u, 954648060u,
+    972788460u, 986097660u, 1004238060u, 1018152060u, 1035687660u, 1049601660u,
+    1067137260u, 1081051260u, 1099191660u, 1112500860u, 1130641260u, 1143950460u,
+    1162090860u, 1173592800u, 576057600u, 594198000u, 828864000u, 846399600u,
+    860313600u, 877849200u, 891763200u, 909298800u, 923212800u, 941353200u,
+    954662400u, 972802800u, 989136000u, 1001833200u, 1018166400u, 1035702000u,
+    1049616000u, 1067151600u, 1081065600u, 1099206000u, 1112515200u, 1130655600u,
+    1143964800u, 1162105200u, 1175414400u, 1193554800u, 1207468800u, 1225004400u,
+    1238918400u, 1256454000u, 1270368000u, 1288508400u, 1301817600u, 1319958000u,
+    1333267200u, 1351407600u, 1365321600u, 1382857200u, 1396771200u, 1414306800u,
+    1428220800u, 1445756400u, 1459670400u, 1477810800u, 1491120000u, 1509260400u,
+    1522569600u, 1540710000u, 1554624000u, 1572159600u, 1586073600u, 1603609200u,
+    1617523200u, 1635663600u, 1648972800u, 1667113200u, 9860400u, 14176800u,
+    72846000u, 80100000u, 127278000u, 132111000u, 147234600u, 156913200u,
+    165376800u, 219812400u, 226461600u, 250052400u, 257911200u, 282711600u,
+    289360800u, 294202800u, 322020000u, 566449200u, 573012000u, 597812400u,
+    605066400u, 625633200u, 635911200u, 656478000u, 667965600u, 688532400u,
+    699415200u, 719377200u, 730864800u, 1095562800u, 1111896000u, 1128834000u,
+    1142136000u, 1159678800u, 1173585600u, 1191733200u, 1205035200u, 1223182800u,
+    1236484800u, 1254632400u, 1268539200u, 1286082000u, 1299988800u, 1317531600u,
+    1331438400u, 1349586000u, 1362888000u, 1381035600u, 1394337600u, 1412485200u,
+    1425787200u, 9961200u, 25682400u, 41410800u, 57736800u, 73465200u,
+    89186400u, 104914800u, 120636000u, 136364400u, 152085600u, 167814000u,
+    183535200u, 199263600u, 215589600u, 230713200u, 247039200u, 262767600u,
+    278488800u, 294217200u, 309938400u, 325666800u, 341388000u, 357116400u,
+    372837600u, 388566000u, 404892000u, 420015600u, 436341600u, 452070000u,
+    467791200u, 483519600u, 499240800u, 514969200u, 530690400u, 544604400u,
+    562140000u, 576054000u, 594194400u, 607503600u, 625644000u, 638953200u,
+    657093600u, 671007600u, 688543200u, 702457200u, 719992800u, 733906800u,
+    752047200u, 765356400u, 783496800u, 796806000u, 814946400u, 828860400u,
+    846396000u, 860310000u, 877845600u, 891759600u, 909295200u, 923209200u,
+    941349600u, 954658800u, 972799200u, 986108400u, 1004248800u, 1018162800u,
+    1035698400u, 1049612400u, 1067148000u, 1081062000u, 1099202400u, 1112511600u,
+    1130652000u, 1143961200u, 1162101600u, 1173596400u, 9961200u, 25682400u,
+    41410800u, 57736800u, 73465200u, 89186400u, 104914800u, 120636000u,
+    126687600u, 152085600u, 162370800u, 183535200u, 199263600u, 215589600u,
+    230713200u, 247039200u, 262767600u, 278488800u, 294217200u, 309938400u,
+    325666800u, 341388000u, 357116400u, 372837600u, 388566000u, 404892000u,
+    420015600u, 436341600u, 452070000u, 467791200u, 483519600u, 499240800u,
+    514969200u, 530690400u, 544604400u, 562140000u, 576054000u, 594194400u,
+    607503600u, 625644000u, 638953200u, 657093600u, 671007600u, 688543200u,
+    702457200u, 719992800u, 733906800u, 752047200u, 765356400u, 783496800u,
+    796806000u, 814946400u, 828860400u, 846396000u, 860310000u, 877845600u,
+    891759600u, 909295200u, 923209200u, 941349600u, 954658800u, 972799200u,
+    986108400u, 1004248800u, 1018162800u, 1035698400u, 1049612400u, 1067148000u,
+    1081062000u, 1099202400u, 1112511600u, 1130652000u, 1143961200u, 1162101600u,
+    1173596400u, 9982800u, 25704000u, 41432400u, 57758400u, 73486800u,
+    89208000u, 104936400u, 120657600u, 126709200u, 152107200u, 162392400u,
+    183556800u, 199285200u, 215611200u, 230734800u, 247060800u, 262789200u,
+    278510400u, 294238800u, 309960000u, 325688400u, 341409600u, 357138000u,
+    372859200u, 388587600u, 404913600u, 420037200u, 436363200u, 452084400u,
+    467805600u, 483534000u, 499255200u, 514983600u, 530704800u, 544618800u,
+    562154400u, 576068400u, 594208800u, 607518000u, 625658400u, 638967600u,
+    657108000u, 671022000u, 688557600u, 702471600u, 720007200u, 733921200u,
+    752061600u, 765370800u, 783511200u, 796820400u, 814960800u, 828874800u,
+    846410400u, 860324400u, 877860000u, 891774000u, 909309600u, 923223600u,
+    941364000u, 954673200u, 972813600u, 986122800u, 1004263200u, 1018177200u,
+    1035712800u, 1049626800u, 1067162400u, 1081076400u, 1099216800u, 1112526000u,
+    1130666400u, 1143975600u, 1162116000u, 1173610800u, 499744800u, 511232400u,
+    530589600u, 540262800u, 562125600u, 571194000u, 592970400u, 602038800u,
+    624420000u, 634698000u, 938916000u, 951613200u, 970970400u, 971571600u,
+    1003024800u, 1013907600u, 9968400u, 25689600u, 41418000u, 57744000u,
+    73472400u, 89193600u, 104922000u, 120643200u, 126694800u, 152092800u,
+    162378000u, 183542400u, 199270800u, 215596800u, 230720400u, 247046400u,
+    262774800u, 278496000u, 294224400u, 309945600u, 325674000u, 341395200u,
+    357123600u, 372844800u, 388573200u, 404899200u, 420022800u, 436348800u,
+    452077200u, 467798400u, 483526800u, 499248000u, 514976400u, 530697600u,
+    544611600u, 562147200u, 576061200u, 594201600u, 607510800u, 625651200u,
+    638960400u, 657100800u, 671014800u, 688550400u, 702464400u, 720000000u,
+    733914000u, 752054400u, 765363600u, 783504000u, 796813200u, 814953600u,
+    828867600u, 846403200u, 860317200u, 877852800u, 891766800u, 909302400u,
+    923216400u, 941356800u, 954666000u, 972806400u, 986115600u, 1004256000u,
+    1018170000u, 1035705600u, 1049619600u, 1067155200u, 1081069200u, 1099209600u,
+    1112518800u, 1130659200u, 1143968400u, 1162108800u, 1173603600u, 1194163200u,
+    1205053200u, 1225612800u, 1236502800u, 1257062400u, 1268557200u, 1289116800u,
+    1300003200u, 9968400u, 25689600u, 41418000u, 57744000u, 73472400u,
+    89193600u, 104922000u, 120643200u, 126694800u, 152092800u, 162378000u,
+    183542400u, 199270800u, 215596800u, 230720400u, 247046400u, 262774800u,
+    278496000u, 294224400u, 309945600u, 325674000u, 341395200u, 357123600u,
+    372844800u, 388573200u, 404899200u, 420022800u, 436348800u, 452077200u,
+    467798400u, 483526800u, 499248000u, 514976400u, 530697600u, 544611600u,
+    562147200u, 576061200u, 594201600u, 607510800u, 625651200u, 638960400u,
+    657100800u, 671014800u, 688550400u, 702464400u, 720000000u, 733910400u,
+    752050800u, 765360000u, 783500400u, 796809600u, 814950000u, 828864000u,
+    846399600u, 860313600u, 877849200u, 891763200u, 909298800u, 923212800u,
+    941353200u, 954662400u, 972802800u, 986112000u, 1004252400u, 1018166400u,
+    1035702000u, 1049616000u, 1067151600u, 1081065600u, 1099206000u, 1112515200u,
+    1130655600u, 1143964800u, 1162105200u, 1173600000u, 9968400u, 25689600u,
+    41418000u, 57744000u, 73472400u, 89193600u, 104922000u, 120643200u,
+    126694800u, 152092800u, 162378000u, 183542400u, 199270800u, 215596800u,
+    230720400u, 247046400u, 262774800u, 278496000u, 294224400u, 309945600u,
+    325674000u, 341395200u, 357123600u, 372844800u, 388573200u, 404899200u,
+    420022800u, 436348800u, 452077200u, 467798400u, 483526800u, 499248000u,
+    514976400u, 530697600u, 544611600u, 562147200u, 576061200u, 594201600u,
+    607510800u, 625651200u, 638960400u, 657100800u, 671014800u, 688550400u,
+    702464400u, 720000000u, 733914000u, 752054400u, 765363600u, 783504000u,
+    796813200u, 814953600u, 828867600u, 846403200u, 860317200u, 877852800u,
+    891766800u, 909302400u, 923216400u, 941356800u, 954666000u, 972806400u,
+    986115600u, 1004256000u, 1018170000u, 1035705600u, 1049619600u, 1067155200u,
+    1081065600u, 1099206000u, 1112515200u, 1130655600u, 1143964800u, 1162105200u,
+    1173600000u, 828864000u, 846399600u, 860313600u, 877849200u, 891766800u,
+    909302400u, 923216400u, 941356800u, 954666000u, 972806400u, 989139600u,
+    1001836800u, 1018170000u, 1035705600u, 1049619600u, 1067155200u, 1081069200u,
+    1099209600u, 1112518800u, 1130659200u, 1143968400u, 1162108800u, 1175418000u,
+    1193558400u, 1207472400u, 1225008000u, 1238922000u, 1256457600u, 1268557200u,
+    1289116800u, 1300006800u, 1320566400u, 1331456400u, 1352016000u, 1362906000u,
+    1383465600u, 1394355600u, 1414915200u, 1425805200u, 1446364800u, 1457859600u,
+    1478419200u, 1489309200u, 1509868800u, 1520758800u, 1541318400u, 1552208400u,
+    1572768000u, 1583658000u, 1604217600u, 1615712400u, 1636272000u, 1647162000u,
+    1667116800u, 1678608000u, 465449400u, 421218000u, 436334400u, 452062800u,
+    467784000u, 483512400u, 499233600u, 514962000u, 530683200u, 546411600u,
+    562132800u, 576050400u, 594194400u, 607500000u, 625644000u, 638949600u,
+    657093600u, 671004000u, 688543200u, 702453600u, 719992800u, 733903200u,
+    752047200u, 765352800u, 783496800u, 796802400u, 814946400u, 828856800u,
+    846396000u, 860306400u, 877845600u, 1112504400u, 1130644800u, 1143954000u,
+    1162094400u, 1331449200u, 1352008800u, 1362898800u, 1383458400u, 1394348400u,
+    1414908000u, 1425798000u, 1446357600u, 1489302000u, 499755600u, 511243200u,
+    530600400u, 540273600u, 562136400u, 571204800u, 1214283600u, 1384056000u,
+    499752000u, 511239600u, 530596800u, 540270000u, 562132800u, 571201200u,
+    7527600u, 24465600u, 37767600u, 55915200u, 69217200u, 87969600u,
+    100666800u, 118209600u, 132116400u, 150868800u, 163566000u, 182318400u,
+    195620400u, 213768000u, 227070000u, 245217600u, 258519600u, 277272000u,
+    289969200u, 308721600u, 321418800u, 340171200u, 353473200u, 371620800u,
+    384922800u, 403070400u, 416372400u, 434520000u, 447822000u, 466574400u,
+    479271600u, 498024000u, 510721200u, 529473600u, 545194800u, 560923200u,
+    574225200u, 592372800u, 605674800u, 624427200u, 637124400u, 653457600u,
+    668574000u, 687326400u, 700628400u, 718776000u, 732078000u, 750225600u,
+    763527600u, 781675200u, 794977200u, 813729600u, 826426800u, 845179200u,
+    859690800u, 876628800u, 889930800u, 906868800u, 923194800u, 939528000u,
+    952830000u, 971582400u, 984279600u, 1003032000u, 1015729200u, 1034481600u,
+    1047178800u, 1065931200u, 1079233200u, 1097380800u, 1110682800u, 1128830400u,
+    1142132400u, 1160884800u, 1173582000u, 1192334400u, 1206846000u, 1223784000u,
+    1237086000u, 1255233600u, 1270350000u, 1286683200u, 1304823600u, 1313899200u,
+    1335668400u, 1346558400u, 1367118000u, 1378612800u, 1398567600u, 1410062400u,
+    1463281200u, 1471147200u, 1480820400u, 9964800u, 25689600u, 41414400u,
+    57744000u, 73468800u, 89193600u, 104918400u, 120643200u, 136368000u,
+    152092800u, 167817600u, 183542400u, 199267200u, 215596800u, 230716800u,
+    247046400u, 262771200u, 278496000u, 294220800u, 309945600u, 325670400u,
+    341395200u, 357120000u, 372844800u, 388569600u, 404899200u, 420019200u,
+    436348800u, 452073600u, 467798400u, 483523200u, 499248000u, 514972800u,
+    530697600u, 544608000u, 562147200u, 576057600u, 594201600u, 607507200u,
+    625651200u, 638956800u, 657100800u, 671011200u, 688550400u, 702460800u,
+    720000000u, 733910400u, 752054400u, 765360000u, 783504000u, 796809600u,
+    814953600u, 828864000u, 846403200u, 860313600u, 877852800u, 891763200u,
+    909302400u, 923212800u, 941356800u, 954662400u, 972806400u, 986112000u,
+    1004256000u, 1018166400u, 1035705600u, 1049616000u, 1067155200u, 1081065600u,
+    1099209600u, 1112515200u, 1130659200u, 1143964800u, 1162105200u, 1173600000u,
+    73468800u, 89190000u, 104918400u, 120639600u, 136368000u, 152089200u,
+    167817600u, 183538800u, 199267200u, 215593200u, 230716800u, 247042800u,
+    262771200u, 278492400u, 294220800u, 309942000u, 325670400u, 341391600u,
+    357120000u, 372841200u, 388569600u, 404895600u, 420019200u, 436345200u,
+    452073600u, 467794800u, 483523200u, 499244400u, 514972800u, 530694000u,
+    544608000u, 562143600u, 576057600u, 594198000u, 607507200u, 625647600u,
+    638956800u, 657097200u, 671011200u, 688546800u, 702460800u, 719996400u,
+    733910400u, 752050800u, 765360000u, 783500400u, 796809600u, 814950000u,
+    828864000u, 846399600u, 860313600u, 877849200u, 891763200u, 909298800u,
+    923212800u, 941353200u, 954662400u, 972802800u, 986112000u, 1004252400u,
+    1018166400u, 1035702000u, 1049616000u, 1067151600u, 1081065600u, 1099206000u,
+    1112515200u, 1130655600u, 1143964800u, 1162105200u, 1173600000u, 499748400u,
+    511236000u, 530593200u, 540266400u, 562129200u, 571197600u, 592974000u,
+    602042400u, 624423600u, 634701600u, 938919600u, 951616800u, 970974000u,
+    971575200u, 1003028400u, 1013911200u, 73468800u, 89190000u, 104918400u,
+    120639600u, 136368000u, 152089200u, 167817600u, 183538800u, 199267200u,
+    215593200u, 230716800u, 247042800u, 262771200u, 278492400u, 294220800u,
+    309942000u, 325670400u, 341391600u, 357120000u, 372841200u, 388569600u,
+    404895600u, 420019200u, 436345200u, 452073600u, 467794800u, 483523200u,
+    499244400u, 514972800u, 530694000u, 544608000u, 562143600u, 576057600u,
+    594198000u, 607507200u, 625647600u, 638956800u, 657097200u, 671011200u,
+    688546800u, 702460800u, 719996400u, 733910400u, 752050800u, 765360000u,
+    783500400u, 796809600u, 814950000u, 828864000u, 846399600u, 860313600u,
+    877849200u, 891763200u, 909298800u, 923212800u, 941353200u, 954662400u,
+    972802800u, 986112000u, 1004252400u, 1018166400u, 1035702000u, 1049616000u,
+    1067151600u, 1081065600u, 1099206000u, 1112515200u, 1130655600u, 1143964800u,
+    1162105200u, 1173600000u, 499752000u, 511239600u, 530596800u, 540270000u,
+    562132800u, 571201200u, 1214280000u, 7527600u, 24465600u, 37767600u,
+    55915200u, 69217200u, 87969600u, 100666800u, 118209600u, 132116400u,
+    150868800u, 163566000u, 182318400u, 195620400u, 213768000u, 227070000u,
+    245217600u, 258519600u, 277272000u, 289969200u, 308721600u, 321418800u,
+    340171200u, 353473200u, 371620800u, 384922800u, 403070400u, 416372400u,
+    434520000u, 447822000u, 466574400u, 479271600u, 498024000u, 510721200u,
+    529473600u, 545194800u, 560923200u, 574225200u, 592372800u, 605674800u,
+    624427200u, 637124400u, 653457600u, 668574000u, 687326400u, 700628400u,
+    718776000u, 732078000u, 750225600u, 763527600u, 781675200u, 794977200u,
+    813729600u, 826426800u, 845179200u, 859690800u, 876628800u, 889930800u,
+    906868800u, 923194800u, 939528000u, 952830000u, 971582400u, 984279600u,
+    1003032000u, 1015729200u, 1034481600u, 1047178800u, 1065931200u, 1079233200u,
+    1097380800u, 1110682800u, 1128830400u, 1142132400u, 1160884800u, 1173582000u,
+    1192334400u, 1206846000u, 1223784000u, 1237086000u, 1255233600u, 1270350000u,
+    1286683200u, 1304823600u, 1313899200u, 1335668400u, 1346558400u, 1367118000u,
+    1378612800u, 1398567600u, 1410062400u, 1463281200u, 1471147200u, 1494730800u,
+    1502596800u, 1526180400u, 1534046400u, 1554606000u, 1567915200u, 1586055600u,
+    1599364800u, 1617505200u, 1630814400u, 1648954800u, 1662868800u, 1680404400u,
+    4422600u, 25678800u, 33193800u, 57733200u, 64816200u, 89182800u,
+    96438600u, 120632400u, 127974600u, 152082000u, 972799200u, 975823200u,
+    499748400u, 511236000u, 530593200u, 540266400u, 562129200u, 571197600u,
+    592974000u, 602042400u, 624423600u, 634701600u, 656478000u, 666756000u,
+    687927600u, 697600800u, 719982000u, 728445600u, 750826800u, 761709600u,
+    782276400u, 793159200u, 813726000u, 824004000u, 844570800u, 856058400u,
+    876106800u, 888717600u, 908074800u, 919562400u, 938919600u, 951616800u,
+    970974000u, 982461600u, 1003028400u, 1013911200u, 1036292400u, 1045360800u,
+    1066532400u, 1076810400u, 1099364400u, 1108864800u, 1129431600u, 1140314400u,
+    1162695600u, 1172368800u, 1192330800u, 1203213600u, 1224385200u, 1234663200u,
+    1255834800u, 1266717600u, 1287284400u, 1298167200u, 1318734000u, 1330221600u,
+    1350788400u, 1361066400u, 1382238000u, 1392516000u, 1413687600u, 1424570400u,
+    1445137200u, 1456020000u, 1476586800u, 1487469600u, 1508036400u, 1518919200u,
+    1541300400u, 1550368800u, 323841600u, 338961600u, 354679200u, 370400400u,
+    386125200u, 401850000u, 417574800u, 433299600u, 449024400u, 465354000u,
+    481078800u, 496803600u, 512528400u, 528253200u, 543978000u, 559702800u,
+    575427600u, 591152400u, 606877200u, 622602000u, 638326800u, 654656400u,
+    670381200u, 686106000u, 701830800u, 717555600u, 733280400u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u, 846378000u,
+    859683600u, 877827600u, 891133200u, 909277200u, 922582800u, 941331600u,
+    954032400u, 972781200u, 985482000u, 1004230800u, 1017536400u, 1035680400u,
+    1048986000u, 1067130000u, 1080435600u, 1099184400u, 1111885200u, 1130634000u,
+    1143334800u, 1162083600u, 1174784400u, 1193533200u, 1206838800u, 1224982800u,
+    1238288400u, 1256432400u, 1269738000u, 1288486800u, 1301187600u, 1319936400u,
+    1332637200u, 1351386000u, 1364691600u, 1382835600u, 1396141200u, 1414285200u,
+    1427590800u, 1445734800u, 1459040400u, 1477789200u, 1490490000u, 1509238800u,
+    1521939600u, 1540688400u, 1553994000u, 1572138000u, 1585443600u, 1603587600u,
+    1616893200u, 1635642000u, 1648342800u, 1667091600u, 1679792400u, 1698541200u,
+    1711846800u, 9972000u, 25693200u, 41421600u, 57747600u, 73476000u,
+    89197200u, 104925600u, 120646800u, 126698400u, 152096400u, 162381600u,
+    183546000u, 199274400u, 215600400u, 230724000u, 247050000u, 262778400u,
+    278499600u, 294228000u, 309949200u, 325677600u, 341398800u, 357127200u,
+    372848400u, 388576800u, 404902800u, 420026400u, 436352400u, 452084400u,
+    467805600u, 483534000u, 499255200u, 514983600u, 530704800u, 544618800u,
+    562154400u, 576068400u, 594208800u, 607518000u, 625658400u, 638967600u,
+    657108000u, 671022000u, 688557600u, 702471600u, 720007200u, 733921200u,
+    752061600u, 765370800u, 783511200u, 796820400u, 814960800u, 828874800u,
+    846410400u, 860324400u, 877860000u, 891774000u, 909309600u, 923223600u,
+    941364000u, 954673200u, 972813600u, 986122800u, 1004263200u, 1018177200u,
+    1035712800u, 1049626800u, 1067162400u, 1081076400u, 1099216800u, 1112526000u,
+    1130666400u, 1143975600u, 1162116000u, 1173610800u, 9955800u, 25677000u,
+    41405400u, 57731400u, 73459800u, 89181000u, 104909400u, 120630600u,
+    136359000u, 152080200u, 167808600u, 183529800u, 199258200u, 215584200u,
+    230707800u, 247033800u, 262762200u, 278483400u, 294211800u, 309933000u,
+    325661400u, 341382600u, 357111000u, 372832200u, 388560600u, 404886600u,
+    420010200u, 436336200u, 452064600u, 467785800u, 483514200u, 499235400u,
+    514963800u, 530685000u, 544591860u, 562127460u, 576041460u, 594178260u,
+    607491060u, 625631460u, 638940660u, 657081060u, 670995060u, 688530660u,
+    702444660u, 719980260u, 733894260u, 752034660u, 765343860u, 783484260u,
+    796793460u, 814933860u, 828847860u, 846383460u, 860297460u, 877833060u,
+    891747060u, 909282660u, 923196660u, 941337060u, 954646260u, 972786660u,
+    986095860u, 1004236260u, 1018150260u, 1035685860u, 1049599860u, 1067135460u,
+    1081049460u, 1099189860u, 1112499060u, 1130639460u, 1143948660u, 1162089060u,
+    1173583860u, 1194143460u, 1205033460u, 1225593060u, 1236483060u, 1257042660u,
+    1268537460u, 1289097060u, 1299987060u, 1320553800u, 73472400u, 547020000u,
+    559717200u, 578469600u, 591166800u, 1146981600u, 1154926800u, 670399200u,
+    686120400u, 701848800u, 717570000u, 733903200u, 752043600u, 765352800u,
+    783493200u, 796802400u, 814942800u, 828856800u, 846392400u, 860306400u,
+    877842000u, 891756000u, 909291600u, 923205600u, 941346000u, 954655200u,
+    972795600u, 986104800u, 1004245200u, 1018159200u, 1035694800u, 1049608800u,
+    1067144400u, 1081058400u, 1099198800u, 1112508000u, 1130648400u, 1143957600u,
+    1162098000u, 1173592800u, 9972000u, 25693200u, 41421600u, 57747600u,
+    73476000u, 89197200u, 104925600u, 120646800u, 136375200u, 152096400u,
+    167824800u, 183546000u, 199274400u, 215600400u, 230724000u, 247050000u,
+    262778400u, 278499600u, 294228000u, 309949200u, 325677600u, 341398800u,
+    357127200u, 372848400u, 388576800u, 404902800u, 420026400u, 436352400u,
+    452080800u, 467802000u, 483530400u, 499251600u, 514980000u, 530701200u,
+    544615200u, 562150800u, 576064800u, 594205200u, 607514400u, 625654800u,
+    638964000u, 657104400u, 671018400u, 688554000u, 702468000u, 720003600u,
+    733917600u, 752058000u, 765367200u, 783507600u, 796816800u, 814957200u,
+    828871200u, 846406800u, 860320800u, 877856400u, 891770400u, 909306000u,
+    923220000u, 941360400u, 954669600u, 972810000u, 986119200u, 1004259600u,
+    1018173600u, 1035709200u, 1049623200u, 1067158800u, 1081072800u, 1099213200u,
+    1112522400u, 1130662800u, 1143972000u, 1162112400u, 1173607200u, 325677600u,
+    341398800u, 357127200u, 372848400u, 388576800u, 404902800u, 420026400u,
+    436352400u, 452080800u, 467802000u, 483530400u, 499251600u, 514980000u,
+    530701200u, 544615200u, 562150800u, 576064800u, 594205200u, 607514400u,
+    625654800u, 638964000u, 657104400u, 671018400u, 688554000u, 702468000u,
+    720003600u, 733917600u, 752058000u, 765367200u, 783507600u, 796816800u,
+    814957200u, 828871200u, 846406800u, 860320800u, 877856400u, 891770400u,
+    909306000u, 923220000u, 941360400u, 954669600u, 972810000u, 986119200u,
+    1004259600u, 1018173600u, 1035709200u, 1049623200u, 1067158800u, 1081072800u,
+    1099213200u, 1112522400u, 1130662800u, 1143972000u, 1162112400u, 1173607200u,
+    1194166800u, 1205056800u, 1225616400u, 1236506400u, 1257066000u, 1268560800u,
+    1289120400u, 1300010400u, 1320570000u, 1331460000u, 1352019600u, 1362909600u,
+    1383469200u, 1394359200u, 1414918800u, 1425808800u, 1446368400u, 1457863200u,
+    1478422800u, 1489312800u, 1509872400u, 1520762400u, 1541322000u, 1552212000u,
+    1572771600u, 1583661600u, 1604214000u, 9975600u, 25696800u, 41425200u,
+    57751200u, 73479600u, 89200800u, 104929200u, 120650400u, 126702000u,
+    152100000u, 162385200u, 183549600u, 199278000u, 215604000u, 230727600u,
+    247053600u, 262782000u, 278503200u, 294231600u, 309952800u, 325681200u,
+    341402400u, 357130800u, 372852000u, 388580400u, 404906400u, 420030000u,
+    436356000u, 452084400u, 467805600u, 483534000u, 499255200u, 514983600u,
+    530704800u, 544618800u, 562154400u, 576068400u, 594208800u, 607518000u,
+    625658400u, 638967600u, 657108000u, 671022000u, 688557600u, 702471600u,
+    720007200u, 733921200u, 752061600u, 765370800u, 783511200u, 796820400u,
+    814960800u, 828874800u, 846410400u, 860324400u, 877860000u, 891774000u,
+    909309600u, 923223600u, 941364000u, 954673200u, 972813600u, 986122800u,
+    1004263200u, 1018177200u, 1035712800u, 1049626800u, 1067162400u, 1081076400u,
+    1099216800u, 1112526000u, 1130666400u, 1143975600u, 1162116000u, 1173610800u,
+    1255802400u, 1267714800u, 1319738400u, 1329843600u, 1477065600u, 1520701200u,
+    1538856000u, 1552752000u, 1570129200u, 1583596800u, 1601740860u, 1615640400u,
+    1633190460u, 1647090000u, 1664640060u, 1678291200u, 1255806000u, 1268251200u,
+    1319742000u, 1329854400u, 5673600u, 25632000u, 37728000u, 57686400u,
+    67968000u, 89136000u, 100022400u, 120585600u, 131472000u, 152035200u,
+    162921600u, 183484800u, 194976000u, 215539200u, 226425600u, 246988800u,
+    257875200u, 278438400u, 289324800u, 309888000u, 320774400u, 341337600u,
+    352224000u, 372787200u, 386092800u, 404841600u, 417542400u, 436291200u,
+    447177600u, 467740800u, 478627200u, 499190400u, 510076800u, 530035200u,
+    542736000u, 562089600u, 574790400u, 594144000u, 606240000u, 625593600u,
+    637689600u, 657043200u, 670348800u, 686678400u, 701798400u, 718128000u,
+    733248000u, 749577600u, 764697600u, 781027200u, 796147200u, 812476800u,
+    828201600u, 844531200u, 859651200u, 875980800u, 891100800u, 907430400u,
+    922550400u, 938880000u, 954000000u, 967305600u, 985449600u, 1002384000u,
+    1017504000u, 1033833600u, 1048953600u, 1065283200u, 1080403200u, 1096732800u,
+    1111852800u, 1128182400u, 1143907200u, 1159632000u, 1174752000u, 1191686400u,
+    1207411200u, 1223136000u, 1238860800u, 1254585600u, 1301760000u, 1255809600u,
+    152632800u, 162309600u, 183477600u, 194968800u, 215532000u, 226418400u,
+    246981600u, 257868000u, 278431200u, 289317600u, 309880800u, 320767200u,
+    341330400u, 352216800u, 372780000u, 384271200u, 404834400u, 415720800u,
+    436284000u, 447170400u, 467733600u, 478620000u, 499183200u, 510069600u,
+    530632800u, 541519200u, 562082400u, 573573600u, 594136800u, 605023200u,
+    623772000u, 637682400u, 655221600u, 669132000u, 686671200u, 700581600u,
+    718120800u, 732636000u, 749570400u, 764085600u, 781020000u, 795535200u,
+    812469600u, 826984800u, 844524000u, 858434400u, 875973600u, 889884000u,
+    907423200u, 921938400u, 938872800u, 953388000u, 970322400u, 984837600u,
+    1002376800u, 1016287200u, 1033826400u, 1047736800u, 1065276000u, 1079791200u,
+    1096725600u, 1111240800u, 1128175200u, 1142690400u, 1159624800u, 1174140000u,
+    1191074400u, 128142000u, 136605600u, 389070000u, 403070400u, 416372400u,
+    434520000u, 447822000u, 466574400u, 479271600u, 498024000u, 510721200u,
+    529473600u, 545194800u, 560923200u, 574225200u, 592372800u, 605674800u,
+    624427200u, 637124400u, 653457600u, 668574000u, 687326400u, 700628400u,
+    718776000u, 732078000u, 750225600u, 763527600u, 781675200u, 794977200u,
+    813729600u, 826426800u, 845179200u, 859690800u, 876628800u, 889930800u,
+    906868800u, 923194800u, 939528000u, 952830000u, 971582400u, 984279600u,
+    1003032000u, 1015729200u, 1034481600u, 1047178800u, 1065931200u, 1079233200u,
+    1097380800u, 1110682800u, 1128830400u, 1142132400u, 1160884800u, 1173582000u,
+    1192334400u, 1206846000u, 1223784000u, 1237086000u, 1255233600u, 1270350000u,
+    1286683200u, 1304823600u, 1313899200u, 1335668400u, 1346558400u, 1367118000u,
+    1378612800u, 1398567600u, 1410062400u, 1463281200u, 1471147200u, 1480820400u,
+    218246400u, 1111885200u, 760035600u, 783648000u, 1702839600u, 323830800u,
+    338950800u, 354675600u, 370400400u, 386125200u, 401850000u, 417574800u,
+    433299600u, 449024400u, 465354000u, 481078800u, 496803600u, 512528400u,
+    528253200u, 543978000u, 559702800u, 575427600u, 591152400u, 606877200u,
+    622602000u, 638326800u, 654656400u, 670381200u, 686106000u, 701830800u,
+    717555600u, 733280400u, 749005200u, 764730000u, 780454800u, 796179600u,
+    811904400u, 828234000u, 354909600u, 370717200u, 386445600u, 402253200u,
+    417981600u, 433789200u, 449604000u, 465336000u, 481060800u, 496785600u,
+    512510400u, 528235200u, 543960000u, 559684800u, 575409600u, 591134400u,
+    606859200u, 622584000u, 638308800u, 654638400u, 670363200u, 686091600u,
+    695768400u, 701812800u, 717537600u, 733262400u, 748987200u, 764712000u,
+    780436800u, 796161600u, 811886400u, 828216000u, 846360000u, 859665600u,
+    877809600u, 891115200u, 909259200u, 922564800u, 941313600u, 954014400u,
+    972763200u, 985464000u, 1004212800u, 1017518400u, 1035662400u, 1048968000u,
+    1067112000u, 1080417600u, 1099166400u, 1709229600u, 108165600u, 118270800u,
+    136591200u, 149806800u, 168127200u, 181342800u, 199749600u, 215643600u,
+    231285600u, 244501200u, 262735200u, 275950800u, 481154400u, 496962000u,
+    512949600u, 528670800u, 544399200u, 560120400u, 575848800u, 592174800u,
+    610581600u, 623624400u, 641167200u, 655074000u, 671839200u, 685918800u,
+    702856800u, 717973200u, 733701600u, 749422800u, 765151200u, 779662800u,
+    797205600u, 811116000u, 828655200u, 843170400u, 860104800u, 874620000u,
+    891554400u, 906069600u, 930780000u, 938124000u, 954367200u, 970178400u,
+    985816800u, 1001628000u, 1017352800u, 1033077600u, 1048802400u, 1066946400u,
+    1080252000u, 1097791200u, 1112306400u, 1128031200u, 1143756000u, 1161900000u,
+    1175205600u, 1193349600u, 1206655200u, 1225404000u, 1238104800u, 1256853600u,
+    1269554400u, 1288303200u, 1301608800u, 1319752800u, 1333058400u, 1387486800u,
+    1395957600u, 1414706400u, 1427407200u, 1446156000u, 1459461600u, 1477605600u,
+    1490911200u, 1509055200u, 1522360800u, 1540504800u, 1553810400u, 1571954400u,
+    1585260000u, 1604008800u, 1616709600u, 1635458400u, 1645740000u, 1666908000u,
+    354884400u, 370692000u, 386420400u, 402231600u, 417960000u, 433767600u,
+    449582400u, 465314400u, 481039200u, 496764000u, 512488800u, 528213600u,
+    543938400u, 559663200u, 575388000u, 591112800u, 606837600u, 622562400u,
+    638287200u, 654616800u, 670341600u, 686070000u, 695746800u, 701791200u,
+    717516000u, 733240800u, 748965600u, 764690400u, 780415200u, 796140000u,
+    811864800u, 828194400u, 846338400u, 859644000u, 877788000u, 891093600u,
+    909237600u, 922543200u, 941292000u, 953992800u, 972741600u, 985442400u,
+    1004191200u, 1017496800u, 1035640800u, 1048946400u, 1067090400u, 1080396000u,
+    1099144800u, 1111845600u, 1130594400u, 1143295200u, 1162044000u, 1174744800u,
+    1193493600u, 1206799200u, 1224943200u, 1238248800u, 1256392800u, 1269698400u,
+    1288450800u, 1301151600u, 370724400u, 386445600u, 402256800u, 417985200u,
+    433792800u, 449607600u, 465339600u, 481064400u, 496789200u, 512514000u,
+    528238800u, 543963600u, 559688400u, 575413200u, 591138000u, 606862800u,
+    622587600u, 638312400u, 654642000u, 670366800u, 686095200u, 695772000u,
+    701816400u, 717541200u, 733266000u, 748990800u, 764715600u, 780440400u,
+    796168800u, 811893600u, 828223200u, 846367200u, 859672800u, 877816800u,
+    891122400u, 909266400u, 922572000u, 941320800u, 954021600u, 972770400u,
+    985471200u, 1004220000u, 1017525600u, 1035669600u, 1048975200u, 1067119200u,
+    1080424800u, 1099173600u, 354913200u, 370720800u, 386445600u, 402256800u,
+    417985200u, 433792800u, 449607600u, 465339600u, 481064400u, 496789200u,
+    512514000u, 528238800u, 543963600u, 559688400u, 575413200u, 591138000u,
+    606862800u, 622587600u, 638312400u, 654642000u, 670366800u, 686095200u,
+    695772000u, 701816400u, 717541200u, 733266000u, 748990800u, 764715600u,
+    780440400u, 796165200u, 811890000u, 828219600u, 846363600u, 859669200u,
+    877813200u, 891118800u, 909262800u, 922568400u, 941317200u, 954018000u,
+    972766800u, 985467600u, 1004216400u, 1017522000u, 1035666000u, 1048971600u,
+    1067115600u, 1080421200u, 1099170000u, 354913200u, 370720800u, 386449200u,
+    402256800u, 417985200u, 433792800u, 449607600u, 465339600u, 481064400u,
+    496789200u, 512514000u, 528238800u, 543963600u, 559688400u, 575413200u,
+    591138000u, 606862800u, 622587600u, 638312400u, 654642000u, 670366800u,
+    686095200u, 695772000u, 370724400u, 386445600u, 402256800u, 417985200u,
+    433792800u, 449607600u, 465339600u, 481064400u, 496789200u, 512514000u,
+    528238800u, 543963600u, 559688400u, 575413200u, 591138000u, 606862800u,
+    622587600u, 638312400u, 654642000u, 670366800u, 686095200u, 695772000u,
+    701816400u, 717541200u, 733266000u, 748990800u, 764715600u, 780440400u,
+    796165200u, 811890000u, 828219600u, 846363600u, 859669200u, 877813200u,
+    891118800u, 909262800u, 922568400u, 941320800u, 954021600u, 972770400u,
+    985471200u, 1004220000u, 1017525600u, 1035669600u, 1048975200u, 1067119200u,
+    1080424800u, 1099173600u, 389048400u, 402264000u, 417906000u, 433800000u,
+    449614800u, 465422400u, 481150800u, 496792800u, 512517600u, 528242400u,
+    543967200u, 559692000u, 575416800u, 591141600u, 606866400u, 622591200u,
+    638316000u, 654645600u, 670464000u, 686275200u, 702086400u, 717897600u,
+    733622400u, 749433600u, 765158400u, 780969600u, 796694400u, 812505600u,
+    828316800u, 844128000u, 859852800u, 875664000u, 891388800u, 907200000u,
+    922924800u, 938736000u, 954547200u, 970358400u, 986083200u, 1001894400u,
+    1017619200u, 1033430400u, 1049155200u, 1064966400u, 1080777600u, 1096588800u,
+    1112313600u, 1128124800u, 1143849600u, 1159660800u, 1175385600u, 1191196800u,
+    76190400u, 354916800u, 370724400u, 386452800u, 402260400u, 417988800u,
+    433796400u, 449611200u, 465343200u, 481068000u, 496792800u, 512517600u,
+    528242400u, 543967200u, 559692000u, 575416800u, 591141600u, 606866400u,
+    622591200u, 638316000u, 654645600u, 670370400u, 686098800u, 701823600u,
+    717548400u, 828234000u, 846378000u, 859680000u, 877824000u, 891129600u,
+    909273600u, 922579200u, 941328000u, 954028800u, 972777600u, 985478400u,
+    1004227200u, 1017532800u, 1035676800u, 1048982400u, 1067126400u, 1080432000u,
+    1099180800u, 1111881600u, 1130630400u, 1143331200u, 1162080000u, 1174780800u,
+    1193529600u, 1206835200u, 1224979200u, 1238284800u, 1256428800u, 1269734400u,
+    1288483200u, 1301184000u, 1319932800u, 1332633600u, 1351382400u, 1364688000u,
+    1382832000u, 1396137600u, 1414281600u, 1427587200u, 1445731200u, 354906000u,
+    370713600u, 386442000u, 402249600u, 417978000u, 433785600u, 449600400u,
+    465332400u, 481057200u, 496782000u, 512506800u, 528231600u, 543956400u,
+    559681200u, 575406000u, 591130800u, 606855600u, 622580400u, 638305200u,
+    654634800u, 670359600u, 686088000u, 695764800u, 701809200u, 717534000u,
+    733258800u, 748983600u, 764708400u, 780433200u, 796158000u, 801590400u,
+    811886400u, 828216000u, 846360000u, 859665600u, 877809600u, 891115200u,
+    909259200u, 922564800u, 941313600u, 954014400u, 972763200u, 985464000u,
+    1004212800u, 1017518400u, 1035662400u, 1048968000u, 1067112000u, 1080417600u,
+    1099166400u, 1111867200u, 1130616000u, 1143316800u, 1162065600u, 1174766400u,
+    1193515200u, 1206820800u, 1224964800u, 1238270400u, 1256414400u, 1269720000u,
+    1288468800u, 1301169600u, 1414263600u, 1459022400u, 78012000u, 86734800u,
+    105055200u, 118270800u, 136591200u, 149806800u, 168127200u, 181342800u,
+    199749600u, 212965200u, 231285600u, 244501200u, 262735200u, 275950800u,
+    452210400u, 466722000u, 483746400u, 498258000u, 515282400u, 529794000u,
+    546818400u, 561330000u, 581119200u, 592952400u, 610754400u, 624488400u,
+    641512800u, 656024400u, 673048800u, 687560400u, 704671200u, 718146000u,
+    733269600u, 748990800u, 764719200u, 780440400u, 796168800u, 811890000u,
+    828223200u, 843944400u, 859672800u, 875394000u, 891122400u, 906843600u,
+    922572000u, 354909600u, 370717200u, 386445600u, 402253200u, 417981600u,
+    433789200u, 449604000u, 465336000u, 481060800u, 496785600u, 512510400u,
+    528235200u, 543960000u, 559684800u, 575409600u, 591134400u, 606859200u,
+    622584000u, 638308800u, 654638400u, 670363200u, 683582400u, 703018800u,
+    717530400u, 734468400u, 748980000u, 765918000u, 780429600u, 797367600u,
+    811879200u, 828817200u, 843933600u, 859671000u, 877811400u, 891120600u,
+    909261000u, 922570200u, 941315400u, 954019800u, 972765000u, 985469400u,
+    1004214600u, 1017523800u, 1035664200u, 1048973400u, 1067113800u, 1080423000u,
+    1099168200u, 1111872600u, 1123783200u, 354898800u, 370706400u, 386434800u,
+    402242400u, 417970800u, 433778400u, 449593200u, 465325200u, 481050000u,
+    496774800u, 512499600u, 528224400u, 543949200u, 559674000u, 575398800u,
+    591123600u, 606848400u, 622573200u, 638298000u, 654627600u, 670352400u,
+    686080800u, 695757600u, 701802000u, 717526800u, 733251600u, 748976400u,
+    764701200u, 780426000u, 796150800u, 811875600u, 828205200u, 846349200u,
+    859654800u, 877798800u, 891104400u, 909248400u, 922554000u, 941302800u,
+    954003600u, 972752400u, 985453200u, 1004202000u, 1017507600u, 1035651600u,
+    1048957200u, 1067101200u, 1080406800u, 1099155600u, 1111856400u, 1130605200u,
+    1143306000u, 1162054800u, 1174755600u, 1193504400u, 1206810000u, 1224954000u,
+    1238259600u, 1256403600u, 1269709200u, 1288458000u, 1301158800u, 1414252800u,
+    1459015200u, 252435600u, 417974400u, 433782000u, 449596800u, 465318000u,
+    481046400u, 496767600u, 512496000u, 528217200u, 543945600u, 559666800u,
+    575395200u, 591116400u, 606844800u, 622566000u, 638294400u, 654620400u,
+    670348800u, 686070000u, 701798400u, 717519600u, 733248000u, 748969200u,
+    764697600u, 780418800u, 796147200u, 811868400u, 828201600u, 843922800u,
+    859651200u, 875372400u, 891100800u, 906822000u, 988394400u, 1001696400u,
+    1017424800u, 1033146000u, 1048874400u, 1064595600u, 1080324000u, 1096045200u,
+    1111773600u, 1127494800u, 1143223200u, 1159549200u, 1427479200u, 1443193200u,
+    1458928800u, 1474642800u, 515527200u, 527014800u, 545162400u, 558464400u,
+    577216800u, 589914000u, 608666400u, 621968400u, 640116000u, 653418000u,
+    671565600u, 684867600u, 832962600u, 846266400u, 1145039400u, 1245430800u,
+    1262278800u, 10368000u, 23583600u, 41904000u, 55119600u, 73526400u,
+    86742000u, 105062400u, 118278000u, 136598400u, 149814000u, 168134400u,
+    181350000u, 199756800u, 212972400u, 231292800u, 241916400u, 262828800u,
+    273452400u, 418694400u, 433810800u, 450316800u, 465433200u, 508896000u,
+    529196400u, 541555200u, 562633200u, 574387200u, 594255600u, 607305600u,
+    623199600u, 638928000u, 654649200u, 670456800u, 686264400u, 702684000u,
+    717886800u, 733096800u, 748904400u, 765151200u, 780958800u, 796687200u,
+    812494800u, 828309600u, 844117200u, 859759200u, 875653200u, 891208800u,
+    907189200u, 922917600u, 938725200u, 954540000u, 970347600u, 986076000u,
+    1001883600u, 1017612000u, 1033419600u, 1049148000u, 1064955600u, 1080770400u,
+    1096578000u, 1112306400u, 1128114000u, 1143842400u, 1158872400u, 1175205600u,
+    1193950800u, 1207260000u, 1225486800u, 1238104800u, 1256850000u, 1270159200u,
+    1288299600u, 1301608800u, 1319749200u, 1333058400u, 1351198800u, 1364508000u,
+    1382648400u, 1395957600u, 1414702800u, 1427407200u, 1446152400u, 1458856800u,
+    1477602000u, 1490911200u, 1509051600u, 1522360800u, 1540501200u, 1553810400u,
+    1571950800u, 1585260000u, 1604005200u, 1616709600u, 1635454800u, 1648159200u,
+    1666904400u, 199897200u, 969120000u, 354909600u, 370717200u, 386445600u,
+    402253200u, 417981600u, 433789200u, 449604000u, 465336000u, 481060800u,
+    496785600u, 512510400u, 528235200u, 543960000u, 559684800u, 575409600u,
+    591134400u, 606859200u, 622584000u, 638308800u, 654638400u, 670363200u,
+    684363600u, 166572000u, 182293200u, 200959200u, 213829200u, 228866400u,
+    243982800u, 260316000u, 276123600u, 291765600u, 307486800u, 323820000u,
+    338936400u, 354664800u, 370386000u, 386114400u, 401835600u, 417564000u,
+    433285200u, 449013600u, 465339600u, 481068000u, 496789200u, 512517600u,
+    528238800u, 543967200u, 559688400u, 575416800u, 591138000u, 606866400u,
+    622587600u, 638316000u, 654642000u, 670370400u, 686091600u, 701820000u,
+    717541200u, 733269600u, 748990800u, 764719200u, 780440400u, 796168800u,
+    811890000u, 828223200u, 843944400u, 859672800u, 875394000u, 891122400u,
+    909277200u, 922582800u, 941331600u, 954032400u, 972781200u, 985482000u,
+    1004230800u, 1017536400u, 1035680400u, 1048986000u, 1067130000u, 1080435600u,
+    1099184400u, 1111885200u, 1130634000u, 1143334800u, 1162083600u, 1174784400u,
+    1193533200u, 1206838800u, 1224982800u, 1238288400u, 1256432400u, 1269738000u,
+    1288486800u, 1301187600u, 1319936400u, 1332637200u, 1351386000u, 1364691600u,
+    1382835600u, 1396141200u, 1414285200u, 1427590800u, 1445734800u, 1459040400u,
+    1473282000u, 1509238800u, 142380000u, 150843600u, 167176800u, 178664400u,
+    334101600u, 337730400u, 452642400u, 462319200u, 482277600u, 494370000u,
+    516751200u, 526424400u, 545436000u, 558478800u, 576626400u, 589323600u,
+    609890400u, 620773200u, 638316000u, 651618000u, 669765600u, 683672400u,
+    701820000u, 715726800u, 733701600u, 747176400u, 765151200u, 778021200u,
+    796600800u, 810075600u, 828655200u, 843170400u, 860104800u, 874620000u,
+    891554400u, 906069600u, 924213600u, 939934800u, 956268000u, 971989200u,
+    987717600u, 1003438800u, 1019167200u, 1034888400u, 1050616800u, 1066338000u,
+    1082066400u, 1096581600u, 1113516000u, 1128380400u, 1143842400u, 1158872400u,
+    1175378400u, 1189638000u, 1206655200u, 1219957200u, 1238104800u, 1252015200u,
+    1269640860u, 1281474000u, 1301608860u, 1312146000u, 1333058400u, 1348178400u,
+    1364508000u, 1380229200u, 1395957600u, 1414098000u, 1427493600u, 1445551200u,
+    1458946800u, 1477692000u, 1490396400u, 1509141600u, 1521846000u, 1540591200u,
+    1553810400u, 1572037200u, 1585346400u, 1603490400u, 1616796000u, 1635458400u,
+    1648332000u, 1666998000u, 1682726400u, 1698447600u, 1713571200u, 1729897200u,
+    1744416000u, 1761346800u, 1774656000u, 1792796400u, 1806105600u, 1824850800u,
+    1837555200u, 1856300400u, 1869004800u, 1887750000u, 1901059200u, 1919199600u,
+    1932508800u, 1950649200u, 1963958400u, 1982703600u, 1995408000u, 2014153200u,
+    2026857600u, 2045602800u, 2058307200u, 2077052400u, 2090361600u, 2107897200u,
+    2121811200u, 2138742000u, 2153260800u, 2168982000u, 2184710400u, 2199826800u,
+    2216160000u, 2230066800u, 2234304000u, 2234905200u, 2248214400u, 2260911600u,
+    2264544000u, 2266354800u, 2279664000u, 2291756400u, 2295388800u, 2297804400u,
+    2311113600u, 2321996400u, 2326233600u, 2329254000u, 2342563200u, 2352841200u,
+    2356473600u, 2361308400u, 2374012800u, 2383686000u, 2387318400u, 2392758000u,
+    2405462400u, 2413926000u, 2418163200u, 2424207600u, 2437516800u, 2444770800u,
+    2448403200u, 2455657200u, 2468966400u, 2475010800u, 2479248000u, 2487106800u,
+    2500416000u, 2505855600u, 2509488000u, 2519161200u, 2531865600u, 2536700400u,
+    2540332800u, 2550610800u, 2563315200u, 2566940400u, 2571177600u, 2582060400u,
+    2595369600u, 2597785200u, 2601417600u, 2613510000u, 2626819200u, 2628025200u,
+    2632262400u, 2644959600u, 2658268800u, 2658870000u, 2663107200u, 2676409200u,
+    2693347200u, 2708463600u, 2724192000u, 2739913200u, 2754432000u, 2771362800u,
+    2785276800u, 2802812400u, 2816121600u, 2834262000u, 2847571200u, 2866316400u,
+    2879020800u, 2897766000u, 2910470400u, 2929215600u, 2941920000u, 2960665200u,
+    2973974400u, 2992114800u, 3005424000u, 3023564400u, 3036873600u, 3055618800u,
+    3068323200u, 3087068400u, 3099772800u, 3117913200u, 3131827200u, 3148758000u,
+    3163276800u, 3179602800u, 3194726400u, 3209842800u, 3226176000u, 3240687600u,
+    3244320000u, 3244921200u, 3257625600u, 3271532400u, 3275164800u, 3276370800u,
+    3289075200u, 3301772400u, 3306009600u, 3307820400u, 3321129600u, 3332617200u,
+    3336249600u, 3339270000u, 3352579200u, 3362857200u, 3367094400u, 3370719600u,
+    3384028800u, 3393702000u, 3397939200u, 3402774000u, 3415478400u, 3424546800u,
+    3428179200u, 3434223600u, 3446928000u, 3454786800u, 3459024000u, 3465673200u,
+    3478982400u, 3485631600u, 3489264000u, 3497122800u, 3510432000u, 3516476400u,
+    3520108800u, 3528572400u, 3541881600u, 3546716400u, 3550953600u, 3560022000u,
+    3573331200u, 3577561200u, 3581193600u, 3592076400u, 3604780800u, 3607801200u,
+    3612038400u, 3623526000u, 3636230400u, 3638646000u, 3642883200u, 3654975600u,
+    3668284800u, 3669490800u, 3673123200u, 3686425200u, 142380000u, 150843600u,
+    167176800u, 178664400u, 334101600u, 337730400u, 452642400u, 462319200u,
+    482277600u, 494370000u, 516751200u, 526424400u, 545436000u, 558478800u,
+    576626400u, 589323600u, 609890400u, 620773200u, 638316000u, 651618000u,
+    669765600u, 683672400u, 701820000u, 715726800u, 733701600u, 747176400u,
+    765151200u, 778021200u, 796600800u, 810075600u, 828655200u, 843170400u,
+    860104800u, 874620000u, 891554400u, 906069600u, 924213600u, 939934800u,
+    956268000u, 971989200u, 987717600u, 1003438800u, 1019167200u, 1034888400u,
+    1050616800u, 1066338000u, 1082066400u, 1096581600u, 1113516000u, 1128380400u,
+    1143842400u, 1158872400u, 1175378400u, 1189638000u, 1206655200u, 1220216400u,
+    1238104800u, 1252015200u, 1269554400u, 1281474000u, 1301608860u, 1312146000u,
+    1314655200u, 1317330000u, 1333058400u, 1348178400u, 1364508000u, 1380229200u,
+    1395957600u, 1414098000u, 1427493600u, 1445551200u, 1458946800u, 1477692000u,
+    1490396400u, 1509141600u, 1521846000u, 1540591200u, 1553810400u, 1572037200u,
+    1585346400u, 1603490400u, 1616796000u, 1635458400u, 1648332000u, 1666998000u,
+    1682726400u, 1698447600u, 1713571200u, 1729897200u, 1744416000u, 1761346800u,
+    1774656000u, 1792796400u, 1806105600u, 1824850800u, 1837555200u, 1856300400u,
+    1869004800u, 1887750000u, 1901059200u, 1919199600u, 1932508800u, 1950649200u,
+    1963958400u, 1982703600u, 1995408000u, 2014153200u, 2026857600u, 2045602800u,
+    2058307200u, 2077052400u, 2090361600u, 2107897200u, 2121811200u, 2138742000u,
+    2153260800u, 2168982000u, 2184710400u, 2199826800u, 2216160000u, 2230066800u,
+    2234304000u, 2234905200u, 2248214400u, 2260911600u, 2264544000u, 2266354800u,
+    2279664000u, 2291756400u, 2295388800u, 2297804400u, 2311113600u, 2321996400u,
+    2326233600u, 2329254000u, 2342563200u, 2352841200u, 2356473600u, 2361308400u,
+    2374012800u, 2383686000u, 2387318400u, 2392758000u, 2405462400u, 2413926000u,
+    2418163200u, 2424207600u, 2437516800u, 2444770800u, 2448403200u, 2455657200u,
+    2468966400u, 2475010800u, 2479248000u, 2487106800u, 2500416000u, 2505855600u,
+    2509488000u, 2519161200u, 2531865600u, 2536700400u, 2540332800u, 2550610800u,
+    2563315200u, 2566940400u, 2571177600u, 2582060400u, 2595369600u, 2597785200u,
+    2601417600u, 2613510000u, 2626819200u, 2628025200u, 2632262400u, 2644959600u,
+    2658268800u, 2658870000u, 2663107200u, 2676409200u, 2693347200u, 2708463600u,
+    2724192000u, 2739913200u, 2754432000u, 2771362800u, 2785276800u, 2802812400u,
+    2816121600u, 2834262000u, 2847571200u, 2866316400u, 2879020800u, 2897766000u,
+    2910470400u, 2929215600u, 2941920000u, 2960665200u, 2973974400u, 2992114800u,
+    3005424000u, 3023564400u, 3036873600u, 3055618800u, 3068323200u, 3087068400u,
+    3099772800u, 3117913200u, 3131827200u, 3148758000u, 3163276800u, 3179602800u,
+    3194726400u, 3209842800u, 3226176000u, 3240687600u, 3244320000u, 3244921200u,
+    3257625600u, 3271532400u, 3275164800u, 3276370800u, 3289075200u, 3301772400u,
+    3306009600u, 3307820400u, 3321129600u, 3332617200u, 3336249600u, 3339270000u,
+    3352579200u, 3362857200u, 3367094400u, 3370719600u, 3384028800u, 3393702000u,
+    3397939200u, 3402774000u, 3415478400u, 3424546800u, 3428179200u, 3434223600u,
+    3446928000u, 3454786800u, 3459024000u, 3465673200u, 3478982400u, 3485631600u,
+    3489264000u, 3497122800u, 3510432000u, 3516476400u, 3520108800u, 3528572400u,
+    3541881600u, 3546716400u, 3550953600u, 3560022000u, 3573331200u, 3577561200u,
+    3581193600u, 3592076400u, 3604780800u, 3607801200u, 3612038400u, 3623526000u,
+    3636230400u, 3638646000u, 3642883200u, 3654975600u, 3668284800u, 3669490800u,
+    3673123200u, 3686425200u, 171820800u, 9315000u, 25036200u, 40764600u,
+    56485800u, 72214200u, 88540200u, 104268600u, 119989800u, 126041400u,
+    151439400u, 167167800u, 182889000u, 198617400u, 214338600u, 295385400u,
+    309292200u, 252439200u, 417978000u, 433785600u, 449600400u, 465321600u,
+    481050000u, 496771200u, 512499600u, 528220800u, 543949200u, 559670400u,
+    575398800u, 591120000u, 606848400u, 622569600u, 638298000u, 654624000u,
+    670352400u, 686073600u, 701802000u, 717523200u, 733251600u, 748972800u,
+    764701200u, 780422400u, 796150800u, 811872000u, 828205200u, 843926400u,
+    859654800u, 875376000u, 891104400u, 906825600u, 988398000u, 1001700000u,
+    1017428400u, 1033149600u, 1048878000u, 1064599200u, 1080327600u, 1096048800u,
+    1111777200u, 1127498400u, 1143226800u, 1159552800u, 1427482800u, 1443196800u,
+    1458932400u, 1474646400u, 354902400u, 370710000u, 386438400u, 402246000u,
+    417974400u, 433782000u, 449596800u, 465328800u, 481053600u, 496778400u,
+    512503200u, 528228000u, 543952800u, 559677600u, 575402400u, 591127200u,
+    606852000u, 622576800u, 638301600u, 654631200u, 670356000u, 686084400u,
+    695761200u, 701805600u, 717530400u, 733255200u, 748980000u, 764704800u,
+    780429600u, 796154400u, 811879200u, 828208800u, 846352800u, 859658400u,
+    877802400u, 891108000u, 909252000u, 922557600u, 941306400u, 954007200u,
+    972756000u, 985456800u, 1004205600u, 1017511200u, 1035655200u, 1048960800u,
+    1067104800u, 1080410400u, 1099159200u, 1111860000u, 1130608800u, 1143309600u,
+    1162058400u, 1174759200u, 1193508000u, 1206813600u, 1224957600u, 1238263200u,
+    1256407200u, 1269712800u, 1288461600u, 1301162400u, 1414256400u, 107910000u,
+    121215600u, 133920000u, 152665200u, 164678400u, 184114800u, 196214400u,
+    215564400u, 228873600u, 245804400u, 260323200u, 267915600u, 428454000u,
+    433893600u, 468111600u, 482799600u, 496710000u, 512521200u, 528246000u,
+    543970800u, 559695600u, 575420400u, 591145200u, 606870000u, 622594800u,
+    638319600u, 654649200u, 670374000u, 686098800u, 701823600u, 717548400u,
+    733273200u, 748998000u, 764118000u, 780447600u, 796172400u, 811897200u,
+    828226800u, 846370800u, 859676400u, 877820400u, 891126000u, 909270000u,
+    922575600u, 941324400u, 954025200u, 972774000u, 985474800u, 1004223600u,
+    1017529200u, 1035673200u, 1048978800u, 1067122800u, 1080428400u, 1099177200u,
+    1111878000u, 1130626800u, 1143327600u, 1162076400u, 1174784400u, 1193533200u,
+    1206838800u, 1224982800u, 1238288400u, 1256432400u, 1269738000u, 1288486800u,
+    1301274000u, 1319936400u, 1332637200u, 1351386000u, 1364691600u, 1382835600u,
+    1396227600u, 1414285200u, 1427590800u, 1446944400u, 1459040400u, 1473195600u,
+    142380000u, 150843600u, 167176800u, 178664400u, 334101600u, 337730400u,
+    452642400u, 462319200u, 482277600u, 494370000u, 516751200u, 526424400u,
+    545436000u, 558478800u, 576626400u, 589323600u, 609890400u, 620773200u,
+    638316000u, 651618000u, 669765600u, 683672400u, 701820000u, 715726800u,
+    733701600u, 747176400u, 765151200u, 778021200u, 796600800u, 810075600u,
+    826840800u, 842821200u, 858895200u, 874184400u, 890344800u, 905029200u,
+    923011200u, 936313200u, 955670400u, 970783200u, 986770800u, 1001282400u,
+    1017356400u, 1033941600u, 1048806000u, 1065132000u, 1081292400u, 1095804000u,
+    1112313600u, 1128812400u, 1143763200u, 1159657200u, 1175212800u, 1189897200u,
+    1206662400u, 1223161200u, 1238112000u, 1254006000u, 1269561600u, 1284246000u,
+    1301616000u, 1317510000u, 1333065600u, 1348354800u, 1364515200u, 354888000u,
+    370695600u, 386424000u, 402231600u, 417960000u, 433767600u, 449582400u,
+    465314400u, 481039200u, 496764000u, 512488800u, 528213600u, 543938400u,
+    559663200u, 575388000u, 591112800u, 606837600u, 622562400u, 638287200u,
+    654616800u, 670341600u, 686070000u, 695746800u, 701791200u, 717516000u,
+    733240800u, 748965600u, 764690400u, 780415200u, 796140000u, 811864800u,
+    828194400u, 846338400u, 859644000u, 877788000u, 891093600u, 909237600u,
+    922543200u, 941292000u, 953992800u, 972741600u, 985442400u, 1004191200u,
+    1017496800u, 1035640800u, 1048946400u, 1067090400u, 1080396000u, 1099144800u,
+    1111845600u, 1130594400u, 1143295200u, 1162044000u, 1174744800u, 1193493600u,
+    1206799200u, 1224943200u, 1238248800u, 1256392800u, 1269698400u, 1288450800u,
+    1301151600u, 1018119600u, 1033840800u, 1212260400u, 1225476000u, 1239735600u,
+    1257012000u, 504901800u, 354898800u, 370706400u, 386434800u, 402242400u,
+    417970800u, 433778400u, 449593200u, 465325200u, 481050000u, 496774800u,
+    512499600u, 528224400u, 543949200u, 559674000u, 575398800u, 591123600u,
+    606848400u, 622573200u, 638298000u, 654627600u, 670352400u, 686080800u,
+    695757600u, 701802000u, 717526800u, 733251600u, 748976400u, 764701200u,
+    780426000u, 796150800u, 811875600u, 828205200u, 846349200u, 859654800u,
+    877798800u, 891104400u, 909248400u, 922554000u, 941302800u, 954003600u,
+    972752400u, 985453200u, 1004202000u, 1017507600u, 1035651600u, 1048957200u,
+    1067101200u, 1072882800u, 1080403200u, 1099152000u, 1111852800u, 1130601600u,
+    1143302400u, 1162051200u, 1174752000u, 1193500800u, 1206806400u, 1224950400u,
+    1238256000u, 1256400000u, 1269705600u, 1288454400u, 1301155200u, 1315832400u,
+    1414252800u, 354906000u, 370713600u, 386442000u, 402249600u, 417978000u,
+    433785600u, 449600400u, 465332400u, 481057200u, 496782000u, 512506800u,
+    528231600u, 543956400u, 559681200u, 575406000u, 591130800u, 606855600u,
+    622580400u, 638305200u, 654634800u, 670359600u, 686088000u, 695764800u,
+    701809200u, 717534000u, 733258800u, 748983600u, 764708400u, 780433200u,
+    796158000u, 811882800u, 828212400u, 846356400u, 859662000u, 877806000u,
+    891111600u, 909255600u, 922561200u, 941310000u, 954010800u, 972759600u,
+    985460400u, 1004209200u, 1017514800u, 1035658800u, 1048964400u, 1067108400u,
+    1080414000u, 1099162800u, 1111863600u, 1130612400u, 1143313200u, 1162062000u,
+    1174762800u, 1193511600u, 1206817200u, 1224961200u, 1238266800u, 1256410800u,
+    1269716400u, 1288465200u, 1301166000u, 1414260000u, 378662400u, 9315000u,
+    25036200u, 40764600u, 56485800u, 72214200u, 88540200u, 104268600u,
+    119989800u, 126041400u, 151439400u, 167167800u, 182889000u, 198617400u,
+    214338600u, 295385400u, 309292200u, 354891600u, 370699200u, 386427600u,
+    402235200u, 417963600u, 433771200u, 449586000u, 465318000u, 481042800u,
+    496767600u, 512492400u, 528217200u, 543942000u, 559666800u, 575391600u,
+    591116400u, 606841200u, 622566000u, 638290800u, 654620400u, 670345200u,
+    686073600u, 695750400u, 701794800u, 717519600u, 733244400u, 748969200u,
+    764694000u, 780418800u, 796143600u, 811868400u, 828198000u, 846342000u,
+    859647600u, 877791600u, 891097200u, 909241200u, 922546800u, 941295600u,
+    953996400u, 972745200u, 985446000u, 1004194800u, 1017500400u, 1035644400u,
+    1048950000u, 1067094000u, 1080399600u, 1099148400u, 1111849200u, 1130598000u,
+    1143298800u, 1162047600u, 1174748400u, 1193497200u, 1206802800u, 1224946800u,
+    1238252400u, 1256396400u, 1269702000u, 1288450800u, 1301151600u, 1414245600u,
+    1461427200u, 228326400u, 243702000u, 643219200u, 649177200u, 166572000u,
+    182293200u, 200959200u, 213829200u, 228866400u, 243982800u, 260316000u,
+    276123600u, 291765600u, 307486800u, 323820000u, 338936400u, 354664800u,
+    370386000u, 386114400u, 401835600u, 417564000u, 433285200u, 449013600u,
+    465339600u, 481068000u, 496789200u, 512517600u, 528238800u, 543967200u,
+    559688400u, 575416800u, 591138000u, 606866400u, 622587600u, 638316000u,
+    654642000u, 670370400u, 686091600u, 701820000u, 717541200u, 733269600u,
+    748990800u, 764719200u, 780440400u, 796168800u, 811890000u, 828223200u,
+    843944400u, 859672800u, 875394000u, 891122400u, 909277200u, 354906000u,
+    370713600u, 386442000u, 402249600u, 417978000u, 433785600u, 449600400u,
+    465332400u, 481057200u, 496782000u, 512506800u, 528231600u, 543956400u,
+    559681200u, 575406000u, 591130800u, 606855600u, 622580400u, 638305200u,
+    654634800u, 670359600u, 686088000u, 695764800u, 701809200u, 717534000u,
+    733258800u, 748983600u, 764708400u, 780433200u, 796158000u, 811882800u,
+    828212400u, 846356400u, 859662000u, 877806000u, 891111600u, 909255600u,
+    922561200u, 941310000u, 954010800u, 972759600u, 985460400u, 1004209200u,
+    1017514800u, 1035658800u, 1048964400u, 1067108400u, 1080414000u, 1099162800u,
+    1111863600u, 1130612400u, 1143313200u, 1162062000u, 1174762800u, 1193511600u,
+    1206817200u, 1224961200u, 1238266800u, 1256410800u, 1269716400u, 1288468800u,
+    1301169600u, 354906000u, 370713600u, 386442000u, 402249600u, 417978000u,
+    433785600u, 449600400u, 465332400u, 481057200u, 496782000u, 512506800u,
+    528231600u, 543956400u, 559681200u, 575406000u, 591130800u, 606855600u,
+    622580400u, 638305200u, 654634800u, 670359600u, 686088000u, 695764800u,
+    701809200u, 717534000u, 733258800u, 738086400u, 748987200u, 764712000u,
+    780436800u, 796161600u, 811886400u, 828216000u, 846360000u, 859665600u,
+    877809600u, 891115200u, 909259200u, 922564800u, 941313600u, 954014400u,
+    972763200u, 985464000u, 1004212800u, 1017518400u, 1035662400u, 1048968000u,
+    1067112000u, 1080417600u, 1099166400u, 1111867200u, 1130616000u, 1143316800u,
+    1162065600u, 1174766400u, 1193515200u, 1206820800u, 1224964800u, 1238270400u,
+    1256414400u, 1269720000u, 1288468800u, 1301169600u, 1414263600u, 1469304000u,
+    354909600u, 370717200u, 386445600u, 402253200u, 417981600u, 433789200u,
+    449604000u, 465336000u, 481060800u, 496785600u, 512510400u, 528235200u,
+    543960000u, 559684800u, 575409600u, 591134400u, 606859200u, 622584000u,
+    638308800u, 654638400u, 670363200u, 686091600u, 695768400u, 701812800u,
+    717537600u, 733262400u, 748987200u, 764712000u, 780436800u, 796161600u,
+    811886400u, 828216000u, 846360000u, 859665600u, 877809600u, 891115200u,
+    909259200u, 922564800u, 941313600u, 954014400u, 972763200u, 985464000u,
+    1004212800u, 1017518400u, 1035662400u, 1048968000u, 1067112000u, 1080417600u,
+    1099166400u, 1111867200u, 1130616000u, 1143316800u, 1162065600u, 1174766400u,
+    1193515200u, 1206820800u, 1224964800u, 1238270400u, 1256414400u, 1269720000u,
+    1288468800u, 1301169600u, 1414263600u, 354913200u, 370720800u, 386445600u,
+    402256800u, 417985200u, 433792800u, 449607600u, 465339600u, 481064400u,
+    496789200u, 512514000u, 528238800u, 543963600u, 559688400u, 575413200u,
+    591138000u, 606862800u, 622591200u, 638316000u, 654645600u, 670370400u,
+    686095200u, 695772000u, 701816400u, 717544800u, 733269600u, 748994400u,
+    764719200u, 780444000u, 796168800u, 811893600u, 828223200u, 846367200u,
+    859672800u, 877816800u, 891122400u, 909266400u, 922572000u, 941320800u,
+    954021600u, 972770400u, 985471200u, 1004220000u, 1017525600u, 1035669600u,
+    1048975200u, 1067119200u, 1080424800u, 1099173600u, 567964800u, 1439564400u,
+    1525446000u, 354913200u, 370720800u, 386445600u, 402256800u, 417985200u,
+    433792800u, 449607600u, 465339600u, 481064400u, 496789200u, 512514000u,
+    528238800u, 543963600u, 559688400u, 575413200u, 591138000u, 606862800u,
+    622587600u, 638312400u, 654642000u, 670366800u, 686095200u, 695772000u,
+    701816400u, 717541200u, 733266000u, 748990800u, 764715600u, 780440400u,
+    796165200u, 811890000u, 828219600u, 846363600u, 859669200u, 877813200u,
+    891118800u, 909262800u, 922568400u, 941317200u, 954018000u, 972766800u,
+    985467600u, 1004216400u, 1017522000u, 1035666000u, 1048971600u, 1067115600u,
+    1080421200u, 1099170000u, 1709229600u, 354913200u, 370720800u, 386445600u,
+    402256800u, 417985200u, 433792800u, 449607600u, 465339600u, 481064400u,
+    496789200u, 512514000u, 528238800u, 543963600u, 559688400u, 575413200u,
+    591138000u, 606862800u, 622587600u, 638312400u, 654642000u, 670366800u,
+    686095200u, 695768400u, 701812800u, 717541200u, 733266000u, 748990800u,
+    764715600u, 780440400u, 796165200u, 811890000u, 828219600u, 846363600u,
+    859669200u, 877813200u, 891118800u, 909262800u, 922568400u, 941317200u,
+    954018000u, 972766800u, 985467600u, 1004216400u, 1017522000u, 1035666000u,
+    1048971600u, 1067115600u, 1080421200u, 1099170000u, 1545328800u, 354891600u,
+    370699200u, 386427600u, 402235200u, 417963600u, 433771200u, 449586000u,
+    465318000u, 481042800u, 496767600u, 512492400u, 528217200u, 543942000u,
+    559666800u, 575391600u, 591116400u, 606841200u, 622566000u, 638290800u,
+    654620400u, 670345200u, 686073600u, 695750400u, 701794800u, 717519600u,
+    733244400u, 748969200u, 764694000u, 780418800u, 796143600u, 811868400u,
+    828198000u, 846342000u, 859647600u, 877795200u, 891100800u, 909244800u,
+    922550400u, 941299200u, 954000000u, 972748800u, 985449600u, 1004198400u,
+    1017504000u, 1035648000u, 1048953600u, 1067097600u, 1080403200u, 1099152000u,
+    1111852800u, 1130601600u, 1143302400u, 1162051200u, 1174752000u, 1193500800u,
+    1206806400u, 1224950400u, 1238256000u, 1256400000u, 1269705600u, 1288454400u,
+    1301155200u, 1414249200u, 1459008000u, 354913200u, 370720800u, 386445600u,
+    402256800u, 417985200u, 433792800u, 449607600u, 465339600u, 481064400u,
+    496789200u, 512514000u, 528238800u, 543963600u, 559688400u, 575413200u,
+    591138000u, 606862800u, 622587600u, 638312400u, 654642000u, 670366800u,
+    686091600u, 547578000u, 560883600u, 579027600u, 592333200u, 354891600u,
+    370699200u, 386427600u, 402235200u, 417963600u, 433771200u, 449586000u,
+    465318000u, 481042800u, 496767600u, 512492400u, 528217200u, 543942000u,
+    559666800u, 575391600u, 591116400u, 606841200u, 622566000u, 638290800u,
+    654620400u, 670345200u, 686073600u, 695750400u, 701794800u, 717519600u,
+    733244400u, 748969200u, 764694000u, 780418800u, 796143600u, 811868400u,
+    828198000u, 846342000u, 859647600u, 877791600u, 891097200u, 909241200u,
+    922546800u, 941295600u, 953996400u, 972745200u, 985446000u, 1004194800u,
+    1017500400u, 1035644400u, 1048950000u, 1067094000u, 1080399600u, 1099148400u,
+    1111849200u, 1130598000u, 1143298800u, 1162047600u, 1174748400u, 1193497200u,
+    1206802800u, 1224946800u, 1238252400u, 1256396400u, 1269702000u, 1288450800u,
+    1301151600u, 1414245600u, 133977600u, 149785200u, 165513600u, 181321200u,
+    299606400u, 307551600u, 354909600u, 370717200u, 386445600u, 402253200u,
+    417981600u, 433789200u, 449604000u, 465336000u, 481060800u, 496785600u,
+    512510400u, 528235200u, 543960000u, 559684800u, 575409600u, 591134400u,
+    606859200u, 622584000u, 638308800u, 654638400u, 670363200u, 686091600u,
+    354916800u, 370724400u, 386452800u, 402260400u, 417988800u, 433796400u,
+    449611200u, 465343200u, 481068000u, 496792800u, 512517600u, 528242400u,
+    543967200u, 559692000u, 575416800u, 591141600u, 606866400u, 622591200u,
+    638316000u, 654645600u, 670370400u, 686098800u, 701816400u, 717537600u,
+    733266000u, 748987200u, 764715600u, 780436800u, 796161600u, 811882800u,
+    828216000u, 877806000u, 891115200u, 909255600u, 922564800u, 941310000u,
+    954014400u, 972759600u, 985464000u, 1004209200u, 1017518400u, 1035658800u,
+    1048968000u, 1067108400u, 1080417600u, 1088276400u, 1099177200u, 1111878000u,
+    227820600u, 246223800u, 259617600u, 271108800u, 279576000u, 296598600u,
+    306531000u, 322432200u, 338499000u, 673216200u, 685481400u, 701209800u,
+    717103800u, 732745800u, 748639800u, 764281800u, 780175800u, 795817800u,
+    811711800u, 827353800u, 843247800u, 858976200u, 874870200u, 890512200u,
+    906406200u, 922048200u, 937942200u, 953584200u, 969478200u, 985206600u,
+    1001100600u, 1016742600u, 1032636600u, 1048278600u, 1064172600u, 1079814600u,
+    1095708600u, 1111437000u, 1127331000u, 1206045000u, 1221939000u, 1237667400u,
+    1253561400u, 1269203400u, 1285097400u, 1300739400u, 1316633400u, 1332275400u,
+    1348169400u, 1363897800u, 1379791800u, 1395433800u, 1411327800u, 1426969800u,
+    1442863800u, 1458505800u, 1474399800u, 1490128200u, 1506022200u, 1521664200u,
+    1537558200u, 1553200200u, 1569094200u, 1584736200u, 1600630200u, 1616358600u,
+    1632252600u, 1647894600u, 1663788600u, 560025000u, 354906000u, 370713600u,
+    386442000u, 402249600u, 417978000u, 433785600u, 449600400u, 465332400u,
+    481057200u, 496782000u, 512506800u, 528231600u, 543956400u, 559681200u,
+    575406000u, 591130800u, 606855600u, 622580400u, 638305200u, 654634800u,
+    670359600u, 686088000u, 695764800u, 701809200u, 717534000u, 733258800u,
+    748983600u, 764708400u, 780433200u, 796158000u, 811882800u, 828212400u,
+    846356400u, 859662000u, 877806000u, 891111600u, 909255600u, 922561200u,
+    941310000u, 954010800u, 972759600u, 985460400u, 1004209200u, 1017514800u,
+    1020193200u, 1035662400u, 1048968000u, 1067112000u, 1080417600u, 1099166400u,
+    1111867200u, 1130616000u, 1143316800u, 1162065600u, 1174766400u, 1193515200u,
+    1206820800u, 1224964800u, 1238270400u, 1256414400u, 1269720000u, 1288468800u,
+    1301169600u, 1414263600u, 1464465600u, 354898800u, 370699200u, 386427600u,
+    402235200u, 417963600u, 433771200u, 449586000u, 465318000u, 481042800u,
+    496767600u, 512492400u, 528217200u, 543942000u, 559666800u, 575391600u,
+    591116400u, 606841200u, 622566000u, 638290800u, 654620400u, 670345200u,
+    686073600u, 695750400u, 701794800u, 717519600u, 733244400u, 748969200u,
+    764694000u, 780418800u, 796143600u, 811868400u, 828198000u, 846342000u,
+    859647600u, 877791600u, 891097200u, 909241200u, 922546800u, 941295600u,
+    953996400u, 972745200u, 985446000u, 1004194800u, 1017500400u, 1035644400u,
+    1048950000u, 1067094000u, 1080399600u, 1099148400u, 1111849200u, 1130598000u,
+    1143298800u, 1162047600u, 1174748400u, 1193497200u, 1206802800u, 1224946800u,
+    1238252400u, 1256396400u, 1269702000u, 1288450800u, 1301151600u, 1315828800u,
+    1414249200u, 354895200u, 370702800u, 386431200u, 402238800u, 417967200u,
+    433774800u, 449589600u, 465321600u, 481046400u, 496771200u, 512496000u,
+    528220800u, 543945600u, 559670400u, 575395200u, 591120000u, 606844800u,
+    622569600u, 638294400u, 654624000u, 670348800u, 686077200u, 695754000u,
+    701798400u, 717523200u, 733248000u, 748972800u, 764697600u, 780422400u,
+    796147200u, 811872000u, 828201600u, 846345600u, 859651200u, 877795200u,
+    891100800u, 909244800u, 922550400u, 941299200u, 954000000u, 972748800u,
+    985449600u, 1004198400u, 1017504000u, 1035648000u, 1048953600u, 1067097600u,
+    1080403200u, 1099152000u, 1111852800u, 1130601600u, 1143302400u, 1162051200u,
+    1174752000u, 1193500800u, 1206806400u, 1224950400u, 1238256000u, 1256400000u,
+    1269705600u, 1288454400u, 1301155200u, 1414249200u, 354898800u, 370706400u,
+    386434800u, 402242400u, 417970800u, 433778400u, 449593200u, 465325200u,
+    481050000u, 496774800u, 512499600u, 528224400u, 543949200u, 559674000u,
+    575398800u, 591123600u, 606848400u, 622573200u, 638298000u, 654627600u,
+    670352400u, 686080800u, 695757600u, 701802000u, 717526800u, 733251600u,
+    748976400u, 764701200u, 780426000u, 796150800u, 811875600u, 828205200u,
+    846349200u, 859654800u, 877798800u, 891104400u, 909248400u, 922554000u,
+    941302800u, 954003600u, 972752400u, 985453200u, 1004202000u, 1017507600u,
+    1035651600u, 1048957200u, 1067101200u, 1080406800u, 1099155600u, 1111856400u,
+    1130605200u, 1143306000u, 1162054800u, 1174755600u, 1193504400u, 1206810000u,
+    1224954000u, 1238259600u, 1256403600u, 1269709200u, 1288458000u, 1301158800u,
+    1414252800u, 354913200u, 370720800u, 386449200u, 402256800u, 417985200u,
+    433792800u, 449607600u, 465339600u, 481064400u, 496789200u, 512514000u,
+    528238800u, 543963600u, 559688400u, 575413200u, 591138000u, 606862800u,
+    622587600u, 638312400u, 654642000u, 670366800u, 686095200u, 695772000u,
+    701816400u, 717541200u, 733266000u, 748990800u, 764715600u, 780440400u,
+    796165200u, 811890000u, 828219600u, 846363600u, 859669200u, 877813200u,
+    891118800u, 909262800u, 922568400u, 941317200u, 954018000u, 972766800u,
+    985467600u, 1004216400u, 1017522000u, 1035666000u, 1048971600u, 1067115600u,
+    1080421200u, 1099170000u, 1111870800u, 1130619600u, 1143320400u, 1162069200u,
+    1174770000u, 1193518800u, 1206824400u, 1224968400u, 1238274000u, 1256418000u,
+    1269723600u, 1288472400u, 1301173200u, 1414267200u, 354916800u, 370724400u,
+    386452800u, 402260400u, 417988800u, 433796400u, 449611200u, 465343200u,
+    481068000u, 496792800u, 512517600u, 528242400u, 543967200u, 559692000u,
+    575416800u, 591141600u, 606866400u, 622591200u, 638316000u, 654645600u,
+    670370400u, 686098800u, 701823600u, 717548400u, 733273200u, 748998000u,
+    764722800u, 780447600u, 796172400u, 811897200u, 859672800u, 877816800u,
+    891122400u, 909266400u, 922572000u, 941320800u, 954021600u, 972770400u,
+    985471200u, 1004220000u, 1017525600u, 1035669600u, 1048975200u, 1067119200u,
+    1080424800u, 1099173600u, 1111874400u, 1130623200u, 1143324000u, 1162072800u,
+    1174773600u, 1193522400u, 1206828000u, 1224972000u, 1238277600u, 1256421600u,
+    1269727200u, 1288476000u, 1301176800u, 1319925600u, 386125200u, 401850000u,
+    417574800u, 433299600u, 449024400u, 465354000u, 481078800u, 496803600u,
+    512528400u, 528253200u, 543978000u, 559702800u, 575427600u, 591152400u,
+    606877200u, 622602000u, 638326800u, 654656400u, 670381200u, 686106000u,
+    701830800u, 717555600u, 725421600u, 733280400u, 740278800u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u, 136360800u,
+    152082000u, 167810400u, 183531600u, 199260000u, 215586000u, 230709600u,
+    247035600u, 262764000u, 278485200u, 294213600u, 309934800u, 325663200u,
+    341384400u, 357112800u, 372834000u, 388562400u, 404888400u, 420012000u,
+    436338000u, 452066400u, 467787600u, 483516000u, 499237200u, 514965600u,
+    530686800u, 544600800u, 562136400u, 576050400u, 594190800u, 607500000u,
+    625640400u, 638949600u, 657090000u, 671004000u, 688539600u, 702453600u,
+    719989200u, 733903200u, 752043600u, 765352800u, 783493200u, 796802400u,
+    814942800u, 828856800u, 846392400u, 860306400u, 877842000u, 891756000u,
+    909291600u, 923205600u, 941346000u, 954655200u, 972795600u, 986104800u,
+    1004245200u, 1018159200u, 1035694800u, 1049608800u, 1067144400u, 1081058400u,
+    1099198800u, 1112508000u, 1130648400u, 1143957600u, 1162098000u, 1173592800u,
+    323827200u, 338950800u, 354675600u, 370400400u, 386125200u, 401850000u,
+    417574800u, 433299600u, 449024400u, 465354000u, 481078800u, 496803600u,
+    512528400u, 528253200u, 543978000u, 559702800u, 575427600u, 591152400u,
+    606877200u, 622602000u, 638326800u, 654656400u, 670381200u, 686106000u,
+    701830800u, 717555600u, 733280400u, 749005200u, 764730000u, 780454800u,
+    796179600u, 811904400u, 828234000u, 186120000u, 354675600u, 370400400u,
+    386125200u, 401850000u, 417574800u, 433299600u, 449024400u, 465354000u,
+    481078800u, 496803600u, 512528400u, 528253200u, 543978000u, 559702800u,
+    575427600u, 591152400u, 606877200u, 622602000u, 638326800u, 654656400u,
+    670381200u, 686106000u, 701830800u, 717555600u, 733280400u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u, 386726400u,
+    401846400u, 417571200u, 433296000u, 449020800u, 465350400u, 481075200u,
+    496800000u, 512524800u, 528253200u, 543978000u, 559702800u, 575427600u,
+    591152400u, 606877200u, 622602000u, 638326800u, 654656400u, 670381200u,
+    686106000u, 701830800u, 717555600u, 733280400u, 749005200u, 764730000u,
+    780454800u, 796179600u, 811904400u, 828234000u, 420609600u, 433306800u,
+    452052000u, 464151600u, 483501600u, 495601200u, 514350000u, 527054400u,
+    545799600u, 558504000u, 577249200u, 589953600u, 608698800u, 621403200u,
+    640753200u, 652852800u, 672202800u, 684907200u, 703652400u, 716356800u,
+    735102000u, 747806400u, 766551600u, 779256000u, 798001200u, 810705600u,
+    830055600u, 842760000u, 861505200u, 874209600u, 892954800u, 905659200u,
+    924404400u, 937108800u, 955854000u, 968558400u, 987310800u, 999410400u,
+    1019365200u, 1030860000u, 1050814800u, 1062914400u, 1082264400u, 1094364000u,
+    1113714000u, 1125813600u, 1145163600u, 1157263200u, 1176613200u, 1188712800u,
+    1208667600u, 1220767200u, 1240117200u, 1252216800u, 1271566800u, 1283666400u,
+    57686400u, 67968000u, 89136000u, 100022400u, 120585600u, 131472000u,
+    152035200u, 162921600u, 183484800u, 194976000u, 215539200u, 226425600u,
+    246988800u, 257875200u, 278438400u, 289324800u, 309888000u, 320774400u,
+    341337600u, 352224000u, 372787200u, 386697600u, 404841600u, 415728000u,
+    436291200u, 447177600u, 467740800u, 478627200u, 499190400u, 511286400u,
+    530035200u, 542736000u, 562089600u, 574790400u, 594144000u, 606240000u,
+    625593600u, 636480000u, 657043200u, 667929600u, 688492800u, 699379200u,
+    719942400u, 731433600u, 751996800u, 762883200u, 783446400u, 794332800u,
+    814896000u, 828201600u, 846345600u, 859651200u, 877795200u, 891100800u,
+    909244800u, 922550400u, 941299200u, 954000000u, 967305600u, 985449600u,
+    1004198400u, 1017504000u, 1035648000u, 1048953600u, 1067097600u, 1080403200u,
+    1099152000u, 1111852800u, 1130601600u, 1143907200u, 1162051200u, 1174752000u,
+    1193500800u, 1207411200u, 57688200u, 67969800u, 89137800u, 100024200u,
+    120587400u, 131473800u, 152037000u, 162923400u, 183486600u, 194977800u,
+    215541000u, 226427400u, 246990600u, 257877000u, 278440200u, 289326600u,
+    309889800u, 320776200u, 341339400u, 352225800u, 372789000u, 384280200u,
+    404843400u, 415729800u, 436293000u, 447179400u, 467742600u, 478629000u,
+    499192200u, 511288200u, 530037000u, 542737800u, 562091400u, 574792200u,
+    594145800u, 606241800u, 625595400u, 637691400u, 657045000u, 667931400u,
+    688494600u, 701195400u, 719944200u, 731435400u, 751998600u, 764094600u,
+    783448200u, 796149000u, 814897800u, 828203400u, 846347400u, 859653000u,
+    877797000u, 891102600u, 909246600u, 922552200u, 941301000u, 954001800u,
+    972750600u, 985451400u, 1004200200u, 1017505800u, 1035649800u, 1048955400u,
+    1067099400u, 1080405000u, 1099153800u, 1111854600u, 1130603400u, 1143909000u,
+    1162053000u, 1174753800u, 1193502600u, 1207413000u, 57686400u, 67968000u,
+    625593600u, 636480000u, 657043200u, 667929600u, 688492800u, 699379200u,
+    57688200u, 67969800u, 89137800u, 100024200u, 120587400u, 131473800u,
+    152037000u, 162923400u, 183486600u, 194977800u, 215541000u, 226427400u,
+    246990600u, 257877000u, 278440200u, 289326600u, 309889800u, 320776200u,
+    341339400u, 352225800u, 372789000u, 386699400u, 404843400u, 415729800u,
+    436293000u, 447179400u, 467742600u, 478629000u, 499192200u, 511288200u,
+    530037000u, 542737800u, 562091400u, 574792200u, 594145800u, 606241800u,
+    625595400u, 636481800u, 657045000u, 667931400u, 688494600u, 699381000u,
+    719944200u, 731435400u, 751998600u, 762885000u, 783448200u, 794334600u,
+    814897800u, 828203400u, 846347400u, 859653000u, 877797000u, 891102600u,
+    909246600u, 922552200u, 941301000u, 954001800u, 972750600u, 985451400u,
+    1004200200u, 1017505800u, 1035649800u, 1048955400u, 1067099400u, 1080405000u,
+    1099153800u, 1111854600u, 1130603400u, 1143909000u, 1162053000u, 1174753800u,
+    1193502600u, 1207413000u, 5673600u, 25632000u, 37728000u, 57686400u,
+    67968000u, 89136000u, 100022400u, 120585600u, 131472000u, 152035200u,
+    162921600u, 183484800u, 194976000u, 215539200u, 226425600u, 246988800u,
+    257875200u, 278438400u, 289324800u, 309888000u, 320774400u, 341337600u,
+    352224000u, 372787200u, 386092800u, 404841600u, 417542400u, 436291200u,
+    447177600u, 467740800u, 478627200u, 499190400u, 510076800u, 530035200u,
+    542736000u, 562089600u, 574790400u, 594144000u, 606240000u, 625593600u,
+    637689600u, 657043200u, 670348800u, 686678400u, 701798400u, 718128000u,
+    733248000u, 749577600u, 764697600u, 781027200u, 796147200u, 812476800u,
+    828201600u, 844531200u, 859651200u, 875980800u, 891100800u, 907430400u,
+    922550400u, 938880000u, 954000000u, 967305600u, 985449600u, 1002384000u,
+    1017504000u, 1033833600u, 1048953600u, 1065283200u, 1080403200u, 1096732800u,
+    1111852800u, 1128182400u, 1143907200u, 1159632000u, 1174752000u, 1191686400u,
+    152039700u, 162926100u, 436295700u, 447182100u, 690311700u, 699383700u,
+    1165079700u, 1174756500u, 1193505300u, 1206810900u, 1224954900u, 1238260500u,
+    352216800u, 372785400u, 384273000u, 404839800u, 415722600u, 436289400u,
+    447172200u, 467739000u, 478621800u, 499188600u, 511282800u, 530033400u,
+    542732400u, 562087800u, 574786800u, 594142200u, 606236400u, 625591800u,
+    636476400u, 657041400u, 667926000u, 688491000u, 699375600u, 719940600u,
+    731430000u, 751995000u, 762879600u, 783444600u, 794329200u, 814894200u,
+    828198000u, 846343800u, 859647600u, 877793400u, 891097200u, 909243000u,
+    922546800u, 941297400u, 953996400u, 967303800u, 985446000u, 1004196600u,
+    1017500400u, 1035646200u, 1048950000u, 1067095800u, 1080399600u, 1099150200u,
+    1111849200u, 1130599800u, 1143903600u, 1162049400u, 1174748400u, 1193499000u,
+    1207407600u, 57686400u, 67968000u, 625593600u, 636480000u, 657043200u,
+    667929600u, 688492800u, 699379200u, 719942400u, 731433600u, 751996800u,
+    762883200u, 57686400u, 67968000u, 89136000u, 100022400u, 120585600u,
+    131472000u, 152035200u, 162921600u, 183484800u, 194976000u, 215539200u,
+    226425600u, 246988800u, 257875200u, 278438400u, 289324800u, 309888000u,
+    320774400u, 341337600u, 352224000u, 372787200u, 384278400u, 404841600u,
+    415728000u, 436291200u, 447177600u, 467740800u, 478627200u, 499190400u,
+    511286400u, 530035200u, 542736000u, 561484800u, 574790400u, 594144000u,
+    606240000u, 625593600u, 637689600u, 657043200u, 667929600u, 688492800u,
+    699379200u, 719942400u, 731433600u, 751996800u, 762883200u, 783446400u,
+    796147200u, 814896000u, 828201600u, 846345600u, 859651200u, 877795200u,
+    891100800u, 909244800u, 922550400u, 941299200u, 954000000u, 967305600u,
+    985449600u, 1004198400u, 1017504000u, 1035648000u, 1048953600u, 1067097600u,
+    1080403200u, 1099152000u, 1111852800u, 1130601600u, 1143907200u, 1162051200u,
+    1174752000u, 1193500800u, 1207411200u, 152042400u, 162928800u, 436298400u,
+    447184800u, 690314400u, 699386400u, 1165082400u, 1174759200u, 1193508000u,
+    1206813600u, 1224957600u, 1238263200u, 228877200u, 243997200u, 260326800u,
+    276051600u, 291776400u, 307501200u, 323830800u, 338950800u, 354675600u,
+    370400400u, 386125200u, 401850000u, 417574800u, 433299600u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    7527600u, 24465600u, 37767600u, 55915200u, 69217200u, 87969600u,
+    100666800u, 118209600u, 132116400u, 150868800u, 163566000u, 182318400u,
+    195620400u, 213768000u, 227070000u, 245217600u, 258519600u, 277272000u,
+    289969200u, 308721600u, 321418800u, 340171200u, 353473200u, 371620800u,
+    384922800u, 403070400u, 416372400u, 434520000u, 447822000u, 466574400u,
+    479271600u, 498024000u, 510721200u, 529473600u, 545194800u, 560923200u,
+    574225200u, 592372800u, 605674800u, 624427200u, 637124400u, 653457600u,
+    668574000u, 687326400u, 700628400u, 718776000u, 732078000u, 750225600u,
+    763527600u, 781675200u, 794977200u, 813729600u, 826426800u, 845179200u,
+    859690800u, 876628800u, 889930800u, 906868800u, 923194800u, 939528000u,
+    952830000u, 971582400u, 984279600u, 1003032000u, 1015729200u, 1034481600u,
+    1047178800u, 1065931200u, 1079233200u, 1097380800u, 1110682800u, 1128830400u,
+    1142132400u, 1160884800u, 1173582000u, 1192334400u, 1206846000u, 1223784000u,
+    1237086000u, 1255233600u, 1270350000u, 1286683200u, 1304823600u, 1313899200u,
+    1335668400u, 1346558400u, 1367118000u, 1378612800u, 1398567600u, 1410062400u,
+    1463281200u, 1471147200u, 1494730800u, 1502596800u, 1526180400u, 1534046400u,
+    1554606000u, 1567915200u, 1586055600u, 1599364800u, 1617505200u, 1630814400u,
+    1648954800u, 1662868800u, 1680404400u, 228877200u, 243997200u, 260326800u,
+    276051600u, 291776400u, 307501200u, 323830800u, 338950800u, 354675600u,
+    370400400u, 386125200u, 401850000u, 417574800u, 433299600u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    57722400u, 69818400u, 89172000u, 101268000u, 120621600u, 132717600u,
+    152071200u, 164167200u, 183520800u, 196221600u, 214970400u, 227671200u,
+    246420000u, 259120800u, 278474400u, 290570400u, 309924000u, 322020000u,
+    341373600u, 354675600u, 372819600u, 386125200u, 404269200u, 417574800u,
+    435718800u, 449024400u, 467773200u, 481078800u, 499222800u, 512528400u,
+    530672400u, 543978000u, 562122000u, 575427600u, 593571600u, 606877200u,
+    625626000u, 638326800u, 657075600u, 670381200u, 688525200u, 701830800u,
+    719974800u, 733280400u, 751424400u, 764730000u, 782874000u, 796179600u,
+    814323600u, 828234000u, 481078800u, 496803600u, 512528400u, 528253200u,
+    543978000u, 559702800u, 575427600u, 591152400u, 606877200u, 622602000u,
+    638326800u, 654656400u, 670381200u, 686106000u, 701830800u, 717555600u,
+    733280400u, 749005200u, 764730000u, 780454800u, 796179600u, 811904400u,
+    828234000u, 354916800u, 370724400u, 386452800u, 402260400u, 417988800u,
+    433796400u, 449611200u, 465343200u, 481068000u, 496792800u, 512517600u,
+    528242400u, 543967200u, 559692000u, 575416800u, 591141600u, 606866400u,
+    622594800u, 638319600u, 654649200u, 670374000u, 701820000u, 717548400u,
+    733273200u, 748998000u, 764722800u, 780447600u, 796172400u, 811897200u,
+    828226800u, 846370800u, 859676400u, 877820400u, 891126000u, 909270000u,
+    922575600u, 941324400u, 954025200u, 972774000u, 985474800u, 1004223600u,
+    1017529200u, 1035673200u, 1048978800u, 1067122800u, 1080428400u, 1099177200u,
+    1111878000u, 1130626800u, 1143327600u, 1162076400u, 1174777200u, 1193526000u,
+    1206831600u, 1224975600u, 1238281200u, 1256425200u, 1269730800u, 1288479600u,
+    1301180400u, 1414274400u, 1459033200u, 166485600u, 186184800u, 198028800u,
+    213753600u, 228873600u, 244080000u, 260323200u, 275446800u, 291798000u,
+    307407600u, 323388000u, 338936400u, 354675600u, 370400400u, 386125200u,
+    401850000u, 417574800u, 433299600u, 449024400u, 465354000u, 481078800u,
+    496803600u, 512528400u, 528253200u, 543978000u, 559702800u, 575427600u,
+    591152400u, 606877200u, 622602000u, 638326800u, 654656400u, 670381200u,
+    686106000u, 701830800u, 717555600u, 733280400u, 749005200u, 764730000u,
+    780454800u, 796179600u, 811904400u, 828234000u, 57722400u, 69818400u,
+    89172000u, 101268000u, 120621600u, 132717600u, 152071200u, 164167200u,
+    183520800u, 196221600u, 214970400u, 227671200u, 246420000u, 259120800u,
+    278474400u, 290570400u, 309924000u, 322020000u, 341373600u, 354675600u,
+    372819600u, 386125200u, 404269200u, 417574800u, 435718800u, 449024400u,
+    467773200u, 481078800u, 499222800u, 512528400u, 530672400u, 543978000u,
+    562122000u, 575427600u, 593571600u, 606877200u, 625626000u, 638326800u,
+    657075600u, 670381200u, 688525200u, 701830800u, 719974800u, 733280400u,
+    751424400u, 764730000u, 782874000u, 796179600u, 814323600u, 828234000u,
+    417574800u, 433299600u, 449024400u, 465354000u, 481078800u, 496803600u,
+    512528400u, 528253200u, 543978000u, 559702800u, 575427600u, 591152400u,
+    606877200u, 622602000u, 638326800u, 654656400u, 670381200u, 686106000u,
+    701830800u, 717555600u, 733280400u, 749005200u, 764730000u, 780454800u,
+    796179600u, 811904400u, 828234000u, 291776400u, 307501200u, 323830800u,
+    338950800u, 354675600u, 370400400u, 386125200u, 401850000u, 417574800u,
+    433299600u, 449024400u, 465354000u, 481078800u, 496803600u, 512528400u,
+    528253200u, 543978000u, 559702800u, 575427600u, 591152400u, 606877200u,
+    622602000u, 638326800u, 654656400u, 670381200u, 686106000u, 701830800u,
+    717555600u, 733280400u, 749005200u, 764730000u, 780454800u, 796179600u,
+    811904400u, 828234000u, 296604000u, 307486800u, 323816400u, 338940000u,
+    354672000u, 370396800u, 386121600u, 401846400u, 417571200u, 433296000u,
+    449020800u, 465350400u, 481075200u, 496800000u, 512524800u, 528249600u,
+    543974400u, 559699200u, 575424000u, 591148800u, 606873600u, 622598400u,
+    638323200u, 654652800u, 670370400u, 686095200u, 701820000u, 717544800u,
+    733269600u, 748994400u, 764719200u, 780440400u, 796168800u, 811890000u,
+    828223200u, 846363600u, 859683600u, 323823600u, 338943600u, 354668400u,
+    370393200u, 386118000u, 401842800u, 417567600u, 433292400u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    354675600u, 370400400u, 386125200u, 401850000u, 417574800u, 433299600u,
+    449024400u, 465354000u, 481078800u, 496803600u, 512528400u, 528253200u,
+    543978000u, 559702800u, 575427600u, 591152400u, 606877200u, 622602000u,
+    638326800u, 654656400u, 670381200u, 686106000u, 701830800u, 717555600u,
+    733280400u, 749005200u, 764730000u, 780454800u, 796179600u, 811904400u,
+    828234000u, 354920400u, 370728000u, 386456400u, 402264000u, 417992400u,
+    433800000u, 449614800u, 465346800u, 481071600u, 496796400u, 512521200u,
+    528246000u, 543970800u, 559695600u, 575420400u, 591145200u, 606870000u,
+    622594800u, 638319600u, 641944800u, 654652800u, 670377600u, 686102400u,
+    701820000u, 717541200u, 733269600u, 748990800u, 764719200u, 780440400u,
+    796168800u, 811890000u, 828223200u, 846363600u, 859680000u, 386125200u,
+    401850000u, 417574800u, 433299600u, 449024400u, 465354000u, 481078800u,
+    496803600u, 512528400u, 528253200u, 543978000u, 559702800u, 575427600u,
+    591152400u, 606877200u, 622602000u, 638326800u, 654656400u, 670381200u,
+    686106000u, 701830800u, 717555600u, 733280400u, 749005200u, 764730000u,
+    780454800u, 796179600u, 811904400u, 828234000u, 354672000u, 370396800u,
+    386121600u, 401846400u, 417574800u, 433299600u, 449024400u, 465354000u,
+    481078800u, 496803600u, 512528400u, 528253200u, 543978000u, 559702800u,
+    575427600u, 591152400u, 606877200u, 622602000u, 638326800u, 654656400u,
+    670381200u, 686106000u, 701830800u, 717555600u, 733280400u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u, 354920400u,
+    370728000u, 386456400u, 402264000u, 417992400u, 433800000u, 449614800u,
+    465346800u, 481071600u, 496796400u, 512521200u, 528246000u, 543970800u,
+    559695600u, 575420400u, 591145200u, 606870000u, 622598400u, 638323200u,
+    654652800u, 670377600u, 686102400u, 701827200u, 717552000u, 733276800u,
+    749001600u, 764726400u, 780451200u, 796176000u, 811900800u, 828230400u,
+    846374400u, 859680000u, 877824000u, 891129600u, 909273600u, 922579200u,
+    941328000u, 954028800u, 972777600u, 985478400u, 1004227200u, 1017532800u,
+    1035676800u, 1048982400u, 1067126400u, 1080432000u, 1099180800u, 1111881600u,
+    1130630400u, 1143331200u, 1162080000u, 1174780800u, 1193529600u, 1206835200u,
+    1224979200u, 1238284800u, 1256428800u, 1269734400u, 1288483200u, 1301184000u,
+    1414278000u, 354920400u, 370728000u, 386456400u, 402264000u, 417992400u,
+    433800000u, 449614800u, 465346800u, 481071600u, 496796400u, 512521200u,
+    528246000u, 543970800u, 559695600u, 575420400u, 591145200u, 606870000u,
+    622594800u, 638319600u, 646783200u, 686102400u, 701827200u, 717552000u,
+    733276800u, 749001600u, 764726400u, 780451200u, 796176000u, 811900800u,
+    828230400u, 846378000u, 354916800u, 370724400u, 386452800u, 402260400u,
+    417988800u, 433796400u, 449611200u, 465343200u, 481068000u, 496792800u,
+    512517600u, 528242400u, 543967200u, 559692000u, 575416800u, 591141600u,
+    606866400u, 622594800u, 638319600u, 654649200u, 670374000u, 701820000u,
+    717548400u, 733273200u, 748998000u, 764722800u, 780447600u, 796172400u,
+    811897200u, 828226800u, 846370800u, 859676400u, 877820400u, 891126000u,
+    909270000u, 922575600u, 941324400u, 954025200u, 972774000u, 985474800u,
+    1004223600u, 1017529200u, 1035673200u, 1048978800u, 1067122800u, 1080428400u,
+    1099177200u, 1111878000u, 1130626800u, 1143327600u, 1162076400u, 1174777200u,
+    1193526000u, 1206831600u, 1224975600u, 1238281200u, 1256425200u, 1269730800u,
+    1288479600u, 1301180400u, 1414274400u, 212544000u, 228268800u, 243993600u,
+    260326800u, 276051600u, 291776400u, 307501200u, 323830800u, 338950800u,
+    354672000u, 370396800u, 386121600u, 401846400u, 417571200u, 433296000u,
+    449020800u, 465350400u, 481075200u, 496800000u, 512528400u, 528253200u,
+    543978000u, 559702800u, 575427600u, 591152400u, 606877200u, 622602000u,
+    638326800u, 654656400u, 670381200u, 686106000u, 701830800u, 717555600u,
+    733280400u, 749005200u, 764730000u, 780454800u, 796179600u, 811904400u,
+    828234000u, 135122400u, 150246000u, 166572000u, 181695600u, 196812000u,
+    212540400u, 228866400u, 243990000u, 260326800u, 276051600u, 291776400u,
+    307501200u, 323830800u, 338950800u, 354675600u, 370400400u, 386125200u,
+    401850000u, 417574800u, 433299600u, 449024400u, 465354000u, 481078800u,
+    496803600u, 512528400u, 528253200u, 543978000u, 559702800u, 575427600u,
+    591152400u, 606877200u, 622602000u, 638326800u, 654656400u, 670381200u,
+    686106000u, 701830800u, 717555600u, 733280400u, 749005200u, 764730000u,
+    780454800u, 796179600u, 811904400u, 828234000u, 12956400u, 23238000u,
+    43801200u, 54687600u, 75855600u, 86742000u, 102380400u, 118105200u,
+    135730800u, 148518000u, 167187600u, 180489600u, 198637200u, 211939200u,
+    230086800u, 243388800u, 261536400u, 274838400u, 292986000u, 306288000u,
+    323312400u, 338342400u, 354675600u, 370400400u, 386125200u, 401850000u,
+    417574800u, 433299600u, 449024400u, 465354000u, 481078800u, 496803600u,
+    512528400u, 528253200u, 543978000u, 559702800u, 575427600u, 591152400u,
+    606877200u, 622602000u, 638326800u, 654656400u, 670381200u, 686106000u,
+    701830800u, 717555600u, 733280400u, 749005200u, 764730000u, 780454800u,
+    796179600u, 811904400u, 828234000u, 354920400u, 370728000u, 386456400u,
+    402264000u, 417992400u, 433800000u, 449614800u, 465346800u, 481071600u,
+    496796400u, 512521200u, 528246000u, 543970800u, 559695600u, 575420400u,
+    591145200u, 606870000u, 622594800u, 670374000u, 686102400u, 701827200u,
+    717552000u, 733276800u, 749001600u, 764726400u, 780451200u, 796176000u,
+    811900800u, 828230400u, 846374400u, 859680000u, 877824000u, 891129600u,
+    909273600u, 922579200u, 941328000u, 954028800u, 972777600u, 985478400u,
+    1004227200u, 1017532800u, 1035676800u, 1048982400u, 1067126400u, 1080432000u,
+    1099180800u, 1111881600u, 1130630400u, 1143331200u, 1162080000u, 1174780800u,
+    1193529600u, 1206835200u, 1224979200u, 1238284800u, 1256428800u, 1269734400u,
+    1288483200u, 1301184000u, 196819200u, 212540400u, 228877200u, 243997200u,
+    260326800u, 276051600u, 291776400u, 307501200u, 323830800u, 338950800u,
+    354675600u, 370400400u, 386125200u, 401850000u, 417574800u, 433299600u,
+    449024400u, 465354000u, 481078800u, 496803600u, 512528400u, 528253200u,
+    543978000u, 559702800u, 575427600u, 591152400u, 606877200u, 622602000u,
+    638326800u, 654656400u, 670381200u, 686106000u, 701830800u, 717555600u,
+    733280400u, 749005200u, 764730000u, 780454800u, 796179600u, 811904400u,
+    828234000u, 354920400u, 370728000u, 386456400u, 402264000u, 417992400u,
+    433800000u, 449614800u, 465346800u, 481071600u, 496796400u, 512521200u,
+    528246000u, 543970800u, 559695600u, 575420400u, 591145200u, 606870000u,
+    622594800u, 638319600u, 654649200u, 670374000u, 686102400u, 695779200u,
+    701823600u, 717548400u, 733273200u, 748998000u, 764722800u, 780447600u,
+    796172400u, 811897200u, 828226800u, 846370800u, 859676400u, 877820400u,
+    891126000u, 909270000u, 922575600u, 941324400u, 954025200u, 972774000u,
+    985474800u, 1004223600u, 1017529200u, 1035673200u, 1048978800u, 1067122800u,
+    1080428400u, 1099177200u, 1111878000u, 1130626800u, 1143327600u, 1162076400u,
+    1174777200u, 1193526000u, 1206831600u, 1224975600u, 1238281200u, 1256425200u,
+    1269730800u, 1288479600u, 1301180400u, 1414274400u, 354920400u, 370728000u,
+    386456400u, 402264000u, 417992400u, 433800000u, 449614800u, 465346800u,
+    481071600u, 496796400u, 512521200u, 528246000u, 543970800u, 559695600u,
+    575420400u, 591145200u, 606870000u, 622598400u, 638323200u, 654652800u,
+    670377600u, 686102400u, 701827200u, 717552000u, 733276800u, 749001600u,
+    764726400u, 780451200u, 796176000u, 811900800u, 828230400u, 843955200u,
+    859683600u, 877827600u, 891133200u, 909277200u, 922582800u, 941331600u,
+    985482000u, 12956400u, 23238000u, 43801200u, 54687600u, 75855600u,
+    86742000u, 107910000u, 118191600u, 138754800u, 149641200u, 170809200u,
+    181090800u, 202258800u, 212540400u, 233103600u, 243990000u, 265158000u,
+    276044400u, 296607600u, 307494000u, 323830800u, 338950800u, 354675600u,
+    370400400u, 386125200u, 401850000u, 417574800u, 433299600u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    354916800u, 370724400u, 386452800u, 402260400u, 417988800u, 433796400u,
+    449611200u, 465343200u, 481068000u, 496792800u, 512517600u, 528242400u,
+    543967200u, 559692000u, 575416800u, 591141600u, 606866400u, 622594800u,
+    638319600u, 654649200u, 670374000u, 686102400u, 687916800u, 701820000u,
+    717544800u, 733269600u, 748994400u, 764719200u, 780444000u, 796168800u,
+    811893600u, 828223200u, 846367200u, 859672800u, 877816800u, 891122400u,
+    909266400u, 922572000u, 941320800u, 954021600u, 972770400u, 985471200u,
+    1004220000u, 1017525600u, 1035669600u, 1048975200u, 1067119200u, 1080424800u,
+    1099173600u, 1111874400u, 1130623200u, 1143324000u, 1162072800u, 1174773600u,
+    1193522400u, 1206828000u, 1224972000u, 1238277600u, 1256421600u, 1269727200u,
+    1288479600u, 1301180400u, 354916800u, 370724400u, 386452800u, 402260400u,
+    417988800u, 433796400u, 449611200u, 465343200u, 481068000u, 496792800u,
+    512517600u, 528242400u, 543967200u, 559692000u, 575416800u, 591145200u,
+    606870000u, 622594800u, 638319600u, 654649200u, 670374000u, 701820000u,
+    717548400u, 733273200u, 748998000u, 764722800u, 780447600u, 796172400u,
+    811897200u, 828226800u, 846370800u, 859676400u, 877820400u, 891126000u,
+    909270000u, 922575600u, 941324400u, 954025200u, 972774000u, 985474800u,
+    1004223600u, 1017529200u, 1035673200u, 1048978800u, 1067122800u, 1080428400u,
+    1099177200u, 1111878000u, 1130626800u, 1143327600u, 1162076400u, 1174777200u,
+    1193526000u, 1206831600u, 1224975600u, 1238281200u, 1256425200u, 1269730800u,
+    1288479600u, 1301180400u, 1414274400u, 1480806000u, 354920400u, 370728000u,
+    386456400u, 402264000u, 417992400u, 433800000u, 449614800u, 465346800u,
+    481071600u, 496796400u, 512521200u, 528246000u, 543970800u, 559695600u,
+    575420400u, 591145200u, 606870000u, 622594800u, 646786800u, 701827200u,
+    717552000u, 733276800u, 749001600u, 764726400u, 767739600u, 780447600u,
+    796172400u, 811897200u, 828219600u, 846374400u, 859683600u, 877827600u,
+    891133200u, 909277200u, 922582800u, 941331600u, 954032400u, 972781200u,
+    985482000u, 1004230800u, 1017536400u, 1035680400u, 1048986000u, 1067130000u,
+    1080435600u, 1099184400u, 1111885200u, 1130634000u, 1143334800u, 1162083600u,
+    1174784400u, 1193533200u, 1206838800u, 1224982800u, 1238288400u, 1256432400u,
+    1269738000u, 1288486800u, 1301187600u, 1319936400u, 1332637200u, 1351386000u,
+    1364691600u, 1382835600u, 1396137600u, 1414274400u, 291762000u, 307576800u,
+    323816400u, 339026400u, 355266000u, 370393200u, 386715600u, 401846400u,
+    417571200u, 433296000u, 449020800u, 465350400u, 481075200u, 496800000u,
+    512524800u, 528249600u, 543974400u, 559699200u, 575424000u, 591148800u,
+    606873600u, 622598400u, 638323200u, 654652800u, 670370400u, 686091600u,
+    701820000u, 717541200u, 733269600u, 748990800u, 764719200u, 780440400u,
+    796168800u, 811890000u, 828223200u, 846363600u, 859683600u, 354920400u,
+    370728000u, 386456400u, 402264000u, 417992400u, 433800000u, 449614800u,
+    465346800u, 481071600u, 496796400u, 512521200u, 528246000u, 543970800u,
+    559695600u, 575420400u, 591145200u, 606870000u, 622598400u, 638323200u,
+    654652800u, 670377600u, 686102400u, 701827200u, 717552000u, 733276800u,
+    749001600u, 764726400u, 780451200u, 796176000u, 811900800u, 828230400u,
+    846374400u, 859680000u, 877824000u, 891129600u, 909277200u, 922582800u,
+    941331600u, 1017536400u, 136854000u, 149896800u, 168130800u, 181432800u,
+    199839600u, 213141600u, 231894000u, 244591200u, 263257200u, 276040800u,
+    294706800u, 307490400u, 326156400u, 339458400u, 357087600u, 370389600u,
+    389142000u, 402444000u, 419468400u, 433807200u, 449622000u, 465354000u,
+    481078800u, 496803600u, 512528400u, 528253200u, 543978000u, 559702800u,
+    575427600u, 591152400u, 606877200u, 622602000u, 638326800u, 654656400u,
+    670381200u, 686106000u, 701830800u, 717555600u, 733280400u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u, 354916800u,
+    370724400u, 386452800u, 402260400u, 417988800u, 433796400u, 449611200u,
+    465343200u, 481068000u, 496792800u, 512517600u, 528242400u, 543967200u,
+    559692000u, 575416800u, 591141600u, 606866400u, 622594800u, 638319600u,
+    654649200u, 670374000u, 686102400u, 695779200u, 701823600u, 717548400u,
+    733273200u, 748998000u, 764722800u, 780447600u, 796172400u, 811897200u,
+    828226800u, 846370800u, 859676400u, 877820400u, 891126000u, 909270000u,
+    922575600u, 941324400u, 954025200u, 972774000u, 985474800u, 1004223600u,
+    1017529200u, 1035673200u, 1048978800u, 1067122800u, 1080428400u, 1099177200u,
+    1111878000u, 1130626800u, 1143327600u, 1162076400u, 1174777200u, 1193526000u,
+    1206831600u, 1224975600u, 1238281200u, 1256425200u, 1269730800u, 1288479600u,
+    1301180400u, 1414274400u, 1459033200u, 323823600u, 338940000u, 354675600u,
+    370400400u, 386125200u, 401850000u, 417574800u, 433299600u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    354920400u, 370728000u, 386456400u, 402264000u, 417992400u, 433800000u,
+    449614800u, 465346800u, 481071600u, 496796400u, 512521200u, 528246000u,
+    543970800u, 559695600u, 575420400u, 591145200u, 606870000u, 622598400u,
+    638323200u, 654652800u, 670377600u, 686102400u, 701827200u, 717552000u,
+    733276800u, 749001600u, 764726400u, 780451200u, 796176000u, 811900800u,
+    828230400u, 846374400u, 859680000u, 877824000u, 891133200u, 909277200u,
+    922582800u, 941331600u, 1048986000u, 354916800u, 370724400u, 386452800u,
+    402260400u, 417988800u, 433796400u, 449611200u, 465343200u, 481068000u,
+    496792800u, 512517600u, 528242400u, 543967200u, 559692000u, 575416800u,
+    591145200u, 606870000u, 622594800u, 638319600u, 654649200u, 670374000u,
+    701820000u, 717548400u, 733273200u, 748998000u, 764722800u, 780447600u,
+    796172400u, 811897200u, 828226800u, 846370800u, 859676400u, 877820400u,
+    891126000u, 909270000u, 922575600u, 941324400u, 954025200u, 972774000u,
+    985474800u, 1004223600u, 1017529200u, 1035673200u, 1048978800u, 1067122800u,
+    1080428400u, 1099177200u, 1111878000u, 1130626800u, 1143327600u, 1162076400u,
+    1174777200u, 1193526000u, 1206831600u, 1224975600u, 1238281200u, 1256425200u,
+    1269730800u, 1288479600u, 1301180400u, 1414274400u, 1540681200u, 1609020000u,
+    228873600u, 243993600u, 260323200u, 276048000u, 291772800u, 307497600u,
+    323827200u, 338947200u, 354672000u, 370396800u, 386121600u, 401846400u,
+    417571200u, 433296000u, 449020800u, 465350400u, 481075200u, 496800000u,
+    512524800u, 528249600u, 543974400u, 559699200u, 575427600u, 591152400u,
+    606877200u, 622602000u, 638326800u, 654656400u, 670381200u, 686106000u,
+    701830800u, 717555600u, 733280400u, 749005200u, 764730000u, 780454800u,
+    796179600u, 811904400u, 828234000u, 820436400u, 403041600u, 417034800u,
+    1224972000u, 1238274000u, 745934400u, 228877200u, 243997200u, 260326800u,
+    276051600u, 291776400u, 307501200u, 323830800u, 338950800u, 354675600u,
+    370400400u, 386125200u, 401850000u, 417574800u, 433299600u, 449024400u,
+    465354000u, 481078800u, 496803600u, 512528400u, 528253200u, 543978000u,
+    559702800u, 575427600u, 591152400u, 606877200u, 622602000u, 638326800u,
+    654656400u, 670381200u, 686106000u, 701830800u, 717555600u, 733280400u,
+    749005200u, 764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+    152632800u, 162309600u, 183477600u, 194968800u, 215532000u, 226418400u,
+    246981600u, 257868000u, 278431200u, 289317600u, 309880800u, 320767200u,
+    341330400u, 352216800u, 372780000u, 384271200u, 404834400u, 415720800u,
+    436284000u, 447170400u, 467733600u, 478620000u, 499183200u, 510069600u,
+    530632800u, 541519200u, 562082400u, 573573600u, 594136800u, 605023200u,
+    623772000u, 637682400u, 655221600u, 669132000u, 686671200u, 700581600u,
+    718120800u, 732636000u, 749570400u, 764085600u, 781020000u, 795535200u,
+    812469600u, 826984800u, 844524000u, 858434400u, 875973600u, 889884000u,
+    907423200u, 921938400u, 938872800u, 953388000u, 970322400u, 984837600u,
+    1002376800u, 1016287200u, 1033826400u, 1047736800u, 1065276000u, 1079791200u,
+    1096725600u, 1111240800u, 1128175200u, 1142690400u, 1159624800u, 1174140000u,
+    1191074400u, 1285498800u, 1301752800u, 1316872800u, 1325239200u, 1333202400u,
+    1348927200u, 1365256800u, 1380376800u, 1396706400u, 1411826400u, 1428156000u,
+    1443276000u, 1459605600u, 1474725600u, 1491055200u, 1506175200u, 1522504800u,
+    1538229600u, 1554559200u, 1569679200u, 1586008800u, 1601128800u, 1617458400u,
+    1419696000u, 125409600u, 133876800u, 433256400u, 448977600u, 464706000u,
+    480427200u, 496760400u, 511876800u, 528210000u, 543931200u, 559659600u,
+    575380800u, 591109200u, 606830400u, 622558800u, 638280000u, 654008400u,
+    669729600u, 686062800u, 696340800u, 719931600u, 727790400u, 307627200u,
+    788871600u, 1325242800u, 909842400u, 920124000u, 941896800u, 951573600u,
+    1259416800u, 1269698400u, 1287842400u, 1299333600u, 1319292000u, 1327154400u,
+    1350741600u, 1358604000u, 1382796000u, 1390050000u, 1414850400u, 1421503200u,
+    1446300000u, 1452952800u, 1478354400u, 1484402400u, 1509804000u, 1515852000u,
+    1541253600u, 1547301600u, 1573308000u, 1578751200u, 1608386400u, 1610805600u,
+    504939600u, 722930400u, 728888400u, 9907200u, 21394800u, 41356800u,
+    52844400u, 124819200u, 130863600u, 201888000u, 209487660u, 230659200u,
+    241542000u, 307622400u, 788868000u, 915105600u, 287418600u, 152029800u,
+    162916200u, 1443882600u, 1570287600u, 250002000u, 257342400u, 281451600u,
+    288878400u, 849366000u, 857228400u, 893665800u, 279714600u, 289387800u,
+    309952800u, 320837400u, 341402400u, 352287000u, 372852000u, 384341400u,
+    404906400u, 415791000u, 436356000u, 447240600u, 467805600u, 478690200u,
+    499255200u, 510139800u, 530704800u, 541589400u, 562154400u, 573643800u,
+    594208800u, 605093400u, 625658400u, 636543000u, 657108000u, 667992600u,
+    939214800u, 953384400u, 973342800u, 980596800u, 1004792400u, 1012046400u,
+    1478350800u, 1484398800u, 228877200u, 243997200u, 260326800u, 276051600u,
+    291776400u, 307501200u, 323830800u, 338950800u, 354675600u, 370400400u,
+    386125200u, 401850000u, 417574800u, 433299600u, 449024400u, 465354000u,
+    481078800u, 496803600u, 512528400u, 528253200u, 543978000u, 559702800u,
+    575427600u, 591152400u, 606877200u, 622602000u, 638326800u, 654656400u,
+    670381200u, 686106000u, 701830800u, 717555600u, 733280400u, 749005200u,
+    764730000u, 780454800u, 796179600u, 811904400u, 828234000u,
+};
+
+const uint8_t TZ_TRANSITION_TYPE[] = {
+    2, 0, 2, 3, 4, 3, 0, 2, 0, 3, 0, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 255, 2, 0, 2, 0, 2, 0, 2, 0, 3, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    2, 0, 2, 0, 2, 0, 2, 0, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8,
+    3, 8, 3, 8, 3, 8, 3, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 1, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 1, 6, 0, 4, 3, 3, 0,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 6, 3, 4, 6, 3, 4, 6, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 2, 6, 2, 6, 2, 6,
+    2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6,
+    2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 2, 6,
+    2, 6, 2, 6, 2, 6, 2, 6, 2, 6, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10,
+    11, 10, 11, 10, 11, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12,
+    13, 12, 13, 12, 255, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13,
+    12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13, 12, 13,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 255,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 19, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 16, 18, 17, 18, 17, 19, 17, 16, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 16, 18, 17, 18, 17, 19, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 16, 19, 16, 18, 17, 18, 17, 19, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 16, 17, 18, 17, 18, 17, 19,
+    17, 16, 17, 18, 17, 18, 17, 18, 17, 18, 16, 19, 16, 19, 16, 18,
+    17, 19, 17, 16, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 19, 17, 16, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    16, 18, 17, 18, 17, 19, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    16, 17, 18, 17, 18, 17, 19, 17, 16, 17, 18, 17, 18, 17, 18, 17,
+    18, 16, 19, 16, 17, 19, 17, 16, 17, 18, 19, 16, 19, 16, 17, 18,
+    17, 18, 17, 18, 17, 18, 16, 18, 17, 18, 17, 19, 17, 16, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 19,
+    17, 16, 17, 18, 17, 17, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 19, 16, 19, 16, 19, 16, 19, 16, 18,
+    17, 18, 17, 18, 17, 23, 24, 23, 24, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 25, 20, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 255,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 24, 23, 20, 24, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 255, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 20, 24, 23, 24,
+    23, 20, 25, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 20, 26, 16, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 255, 23, 24, 23, 24, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 24, 23, 24, 23, 24, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 24, 21,
+    255, 23, 24, 23, 24, 23, 24, 23, 24, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 17, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 0, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 21, 28, 27, 28, 27,
+    28, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 255, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 255, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 255, 25, 20, 25, 20, 25, 20, 25,
+    20, 16, 20, 23, 24, 23, 24, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 255, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 21, 25, 20, 25, 20, 255, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 255, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 29, 255, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 18,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 255, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 16, 255, 23, 24, 23, 24, 23, 24, 23,
+    24, 25, 20, 17, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 255,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 255, 22, 21, 22, 21, 22, 21, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 20, 23, 24, 255, 25, 20, 25, 20, 25, 20, 25, 20, 23,
+    20, 25, 20, 25, 20, 255, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 20, 23, 24, 23, 20, 255, 25, 20, 23, 24, 255,
+    25, 20, 25, 20, 25, 20, 25, 20, 255, 25, 20, 23, 24, 23, 20, 255,
+    25, 20, 23, 24, 25, 255, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 255, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 24, 23, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 255, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 15, 27, 28, 27,
+    28, 27, 28, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14,
+    15, 14, 255, 25, 20, 25, 20, 25, 20, 25, 20, 23, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 255, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 255, 25, 20, 25, 20, 25, 20, 25,
+    20, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 255, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 20, 24,
+    23, 24, 23, 24, 20, 24, 20, 24, 23, 24, 23, 24, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 255, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 255,
+    20, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 14, 15, 14, 15, 14, 15, 27, 14, 255, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 255, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 255, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 18, 17,
+    18, 17, 31, 32, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18,
+    17, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 255, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20,
+    25, 20, 25, 20, 25, 20, 255, 11, 10, 11, 10, 11, 10, 11, 10, 11,
+    10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11, 10, 11,
+    10, 11, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 255, 33, 29, 33, 29, 33, 29, 33, 29, 33, 29, 33, 29, 33, 29,
+    33, 29, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 24, 255, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 255,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21,
+    22, 21, 22, 24, 23, 24, 23, 24, 23, 24, 255, 23, 24, 23, 24, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    24, 255, 17, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25,
+    20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 25, 20, 255, 25, 20,
+    25, 20, 25, 20, 16, 20, 19, 16, 19, 16, 19, 16, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 17, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 255, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 20, 23, 24,
+    23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 255, 18, 17, 18, 17, 18,
+    17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 20, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    20, 255, 19, 16, 19, 16, 19, 16, 17, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 255, 20, 35, 20, 35, 20, 35, 20, 35, 20, 16, 20, 16, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17, 18, 17,
+    18, 17, 33, 29, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 255, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 255, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34,
+    32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34,
+    32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 31, 34, 32, 34, 32, 34,
+    32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34,
+    32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34, 32, 34,
+    32, 34, 32, 34, 32, 34, 32, 34, 32, 255, 24, 23, 24, 23, 24, 23,
+    24, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 255, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27,
+    28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 255, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28,
+    27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 27, 28, 21, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15, 14, 15,
+    14, 15, 14, 15, 14, 15, 14, 15, 14, 255, 37, 36, 37, 36, 37, 36,
+    37, 36, 37, 36, 37, 36, 37, 36, 37, 36, 39, 38, 39, 38, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 255, 39,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 255, 18, 17, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16,
+    19, 16, 19, 16, 19, 16, 19, 16, 19, 17, 17, 255, 0, 38, 39, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255,
+    45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42,
+    45, 42, 45, 42, 46, 39, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 39, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 1, 48, 47, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 49, 37, 43, 44,
+    43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44,
+    43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44,
+    43, 44, 43, 49, 37, 43, 42, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 50, 51, 39, 46, 39, 46, 39,
+    46, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 39, 46, 42, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 50, 51, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 50, 51, 39, 42, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 50, 51, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 39, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 1, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 52, 1, 52, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53,
+    38, 53, 38, 53, 38, 53, 38, 45, 42, 38, 53, 38, 53, 38, 53, 38,
+    53, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 38, 42, 38, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    255, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 42, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56,
+    55, 56, 55, 56, 55, 56, 55, 57, 36, 55, 56, 55, 56, 55, 56, 55,
+    56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55,
+    56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55,
+    40, 36, 55, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36,
+    57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36,
+    57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36,
+    57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36,
+    58, 42, 54, 45, 42, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 1, 36, 55, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 46, 39, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    1, 255, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 255, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 255, 38, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57,
+    36, 57, 36, 57, 36, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36,
+    57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 53, 38, 36, 57, 36, 57,
+    36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57,
+    36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 57,
+    36, 57, 36, 55, 36, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    1, 52, 1, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 1, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 255, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44,
+    43, 44, 43, 44, 43, 44, 43, 44, 43, 49, 37, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    49, 37, 43, 46, 39, 46, 39, 46, 39, 60, 56, 55, 56, 55, 56, 55,
+    56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 57, 36,
+    55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56,
+    55, 56, 55, 56, 55, 56, 55, 56, 55, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 37, 40, 55, 53, 38, 53, 38, 53,
+    38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 45,
+    42, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 36, 38, 36, 57, 36, 57, 36, 57,
+    36, 57, 36, 57, 36, 57, 36, 57, 36, 57, 36, 49, 37, 49, 37, 49,
+    37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 41,
+    40, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 43, 40, 37, 57, 36, 57, 36, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 255, 53,
+    38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53,
+    38, 53, 38, 45, 42, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 45, 42, 38, 53, 38, 53,
+    38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53,
+    38, 45, 42, 38, 53, 38, 53, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 38, 42, 38, 45, 42,
+    45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42,
+    45, 42, 46, 39, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45,
+    42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 38, 42, 46, 42, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 50, 51, 50,
+    51, 50, 51, 39, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 39, 38, 62,
+    55, 46, 42, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 50, 51, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 42, 39, 46, 42, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 50, 39, 42, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 42, 39, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49,
+    37, 49, 37, 49, 37, 49, 37, 49, 37, 41, 40, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 37, 40, 37, 46, 42, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 56, 55, 56, 55, 49,
+    37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49,
+    37, 49, 37, 41, 40, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 43, 37, 57, 36,
+    57, 36, 57, 36, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42,
+    45, 42, 45, 42, 45, 42, 45, 42, 46, 39, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 52, 1,
+    52, 1, 52, 1, 52, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 52, 1, 51, 64, 51, 50, 51, 63, 64,
+    63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64,
+    63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64,
+    63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64,
+    63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 64, 63, 42,
+    53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38,
+    53, 38, 53, 38, 45, 42, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53,
+    38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 38, 53, 45, 42, 45, 42,
+    45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 45, 42, 38, 42,
+    38, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49,
+    37, 49, 37, 49, 37, 41, 40, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37,
+    49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 43, 37,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 56, 55, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 37, 40,
+    56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55,
+    56, 55, 56, 55, 57, 36, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56,
+    55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56,
+    55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 56, 55, 40, 55, 46,
+    39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46,
+    39, 46, 39, 50, 51, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39,
+    46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 46, 39, 42, 39, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 52, 1, 52, 1, 52, 1, 52, 1, 52, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 8, 5, 8, 5, 8, 5,
+    8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5, 8, 5,
+    0, 2, 8, 5, 8, 5, 8, 5, 255, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 255, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 255, 5, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 255, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 255, 17, 18, 17, 18, 17, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19, 16, 19,
+    16, 17, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40,
+    41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 255, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 255, 41, 40, 41, 40, 41, 40, 41, 40, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65, 66, 65,
+    66, 65, 66, 65, 66, 65, 66, 255, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 255, 68, 67, 68, 67, 68, 67, 68, 67, 68, 67, 68, 67,
+    69, 70, 69, 70, 69, 70, 69, 70, 69, 41, 69, 41, 69, 41, 69, 41,
+    69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41,
+    69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41, 69, 41,
+    69, 41, 69, 41, 69, 41, 255, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 40, 41, 255, 57, 36, 57,
+    36, 57, 36, 57, 36, 57, 36, 57, 36, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255,
+    21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22, 21, 22,
+    21, 22, 21, 22, 21, 22, 21, 22, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23, 24, 23,
+    24, 23, 24, 23, 24, 23, 24, 23, 255, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 255,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3, 8, 3,
+    8, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 255, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 52, 1, 52, 1, 51, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 51, 1, 51, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 255, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2,
+    0, 2, 0, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 255, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 255, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 255, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 255, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 255, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 255, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 1, 6, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 255, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 52, 1, 52, 1, 51, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 51, 1, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 3,
+    4, 3, 4, 3, 4, 3, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 255, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 7, 6, 1, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 7, 6, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 51, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 255, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 50, 51, 50, 51, 52, 1, 52, 1, 7, 1, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 52, 1, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51,
+    50, 51, 50, 51, 52, 1, 52, 1, 52, 1, 51, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52,
+    1, 51, 1, 51, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 6, 7, 6, 7, 6, 7, 52, 1, 52, 1,
+    52, 1, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 51, 1, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 255, 52, 1, 52, 1, 52,
+    1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 7, 6, 7, 6, 7,
+    6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7,
+    6, 255, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 50,
+    51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 50, 51, 52,
+    1, 52, 1, 7, 6, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 51, 1, 51, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6, 7, 6,
+    7, 6, 4, 3, 4, 6, 255, 50, 51, 50, 51, 50, 51, 50, 51, 50,
+    51, 50, 51, 50, 51, 52, 1, 52, 1, 52, 1, 51, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1, 52, 1,
+    52, 1, 51, 1, 51, 1, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3,
+    4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 42, 50, 51,
+    50, 51, 43, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4, 3, 4,
+    3, 4, 3, 4, 3, 4, 3, 4, 3, 255, 74, 73, 74, 73, 74, 73,
+    74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73,
+    74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73,
+    74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73,
+    74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 74, 73, 255, 11, 10, 11,
+    48, 47, 48, 47, 48, 47, 48, 47, 48, 47, 48, 47, 48, 47, 48, 47,
+    48, 47, 48, 47, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 49,
+    37, 49, 37, 49, 37, 49, 37, 49, 37, 49, 37, 10, 47, 47, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 44, 43,
+    44, 43, 44, 43, 44, 43, 44, 43, 44, 43, 24, 23, 24, 41, 40, 41,
+    40, 41, 40, 41, 40, 41, 40, 12, 72, 37, 43, 78, 77, 37, 255, 49,
+    37, 49, 37, 49, 37, 27, 81, 12, 81, 12, 81, 12, 81, 12, 81, 12,
+    81, 12, 81, 12, 81, 12, 81, 12, 81, 12, 81, 12, 81, 12, 81, 12,
+    48, 47, 48, 47, 48, 47, 48, 47, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0,
+    2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 2, 0, 255,
+};
+
+const TZZone TZ_ZONES[] = {
+    {"GMT0", 0, 0, 0, 0},
+    {"EAT-3", 1, 1, 0, 0},
+    {"CET-1", 2, 0, 0, 10},
+    {"WAT-1", 2, 3, 10, 0},
+    {"GMT0", 0, 5, 10, 1},
+    {"CAT-2", 3, 6, 11, 0},
+    {"EET-2EEST,M4.5.5/0,M10.5.4/24", 4, 6, 11, 89},
+    {"<+01>-1", 2, 0, 100, 188},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 0, 288, 30},
+    {"<+01>-1", 2, 5, 318, 185},
+    {"SAST-2", 3, 6, 503, 0},
+    {"CAT-2", 3, 6, 503, 34},
+    {"CAT-2", 3, 6, 537, 34},
+    {"GMT0", 0, 9, 571, 1},
+    {"WAT-1", 2, 3, 572, 2},
+    {"GMT0", 0, 0, 574, 2},
+    {"EET-2", 3, 6, 576, 24},
+    {"CET-1", 2, 3, 600, 18},
+    {"CAT-2", 3, 6, 618, 48},
+    {"HST10HDT,M3.2.0,M11.1.0", 6, 10, 666, 75},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 12, 741, 75},
+    {"AST4", 8, 16, 816, 0},
+    {"<-03>3", 9, 17, 816, 28},
+    {"<-03>3", 9, 17, 844, 18},
+    {"<-03>3", 9, 17, 862, 18},
+    {"<-03>3", 9, 17, 880, 18},
+    {"<-03>3", 9, 17, 898, 16},
+    {"<-03>3", 9, 17, 914, 19},
+    {"<-03>3", 9, 17, 933, 18},
+    {"<-03>3", 9, 17, 951, 18},
+    {"<-03>3", 9, 17, 969, 16},
+    {"<-03>3", 9, 17, 985, 19},
+    {"<-03>3", 9, 17, 1004, 19},
+    {"<-03>3", 9, 17, 1023, 20},
+    {"<-03>3", 9, 17, 1043, 18},
+    {"<-03>3", 9, 16, 1061, 102},
+    {"EST5", 10, 20, 1163, 0},
+    {"<-03>3", 9, 17, 1163, 38},
+    {"CST6", 11, 21, 1201, 54},
+    {"AST4", 8, 16, 1255, 8},
+    {"<-03>3", 9, 17, 1263, 6},
+    {"CST6", 11, 24, 1269, 4},
+    {"<-04>4", 8, 16, 1273, 10},
+    {"<-05>5", 10, 20, 1283, 2},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 21, 1285, 75},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 21, 1360, 72},
+    {"<-04>4", 8, 16, 1432, 68},
+    {"EST5", 10, 24, 1500, 42},
+    {"<-04>4", 8, 16, 1542, 2},
+    {"<-03>3", 9, 17, 1544, 0},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 1544, 75},
+    {"CST6", 11, 24, 1619, 54},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 24, 1673, 56},
+    {"CST6", 11, 24, 1729, 8},
+    {"<-03>3", 9, 19, 1737, 109},
+    {"MST7", 14, 21, 1846, 0},
+    {"<-04>4", 8, 16, 1846, 66},
+    {"GMT0", 0, 17, 1912, 33},
+    {"MST7", 14, 14, 1945, 83},
+    {"MST7", 14, 27, 2028, 6},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 21, 2034, 75},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 2109, 69},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 21, 2178, 71},
+    {"<-05>5", 10, 20, 2249, 10},
+    {"CST6", 11, 24, 2259, 4},
+    {"PST8PDT,M3.2.0,M11.1.0", 16, 27, 2263, 69},
+    {"MST7", 14, 27, 2332, 91},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 2423, 5},
+    {"<-03>3", 9, 17, 2428, 16},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 2444, 71},
+    {"<-02>2<-01>,M3.5.0/-1,M10.5.0/0", 18, 17, 2515, 88},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 2603, 84},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 2687, 74},
+    {"CST6", 11, 24, 2761, 8},
+    {"<-05>5", 10, 20, 2769, 2},
+    {"<-04>4", 8, 30, 2771, 2},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 2773, 75},
+    {"CST5CDT,M3.2.0/0,M11.1.0/1", 19, 20, 2848, 82},
+    {"MST7", 14, 21, 2930, 6},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 2936, 47},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 2983, 15},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 24, 2998, 21},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 20, 3019, 5},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 3024, 9},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 3033, 7},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 3040, 6},
+    {"MST7MDT,M3.2.0,M11.1.0", 12, 27, 3046, 71},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 3117, 71},
+    {"EST5", 10, 20, 3188, 20},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 27, 3208, 75},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 3283, 75},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 24, 3358, 75},
+    {"<-04>4", 8, 16, 3433, 0},
+    {"<-05>5", 10, 20, 3433, 8},
+    {"PST8PDT,M3.2.0,M11.1.0", 16, 27, 3441, 75},
+    {"<-03>3", 9, 17, 3516, 18},
+    {"CST6", 11, 24, 3534, 14},
+    {"<-04>4", 8, 16, 3548, 8},
+    {"AST4", 8, 16, 3556, 2},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 3558, 31},
+    {"MST7", 14, 21, 3589, 54},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 20, 3643, 69},
+    {"CST6", 11, 24, 3712, 56},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 27, 3768, 37},
+    {"CST6", 11, 24, 3805, 54},
+    {"<-03>3<-02>,M3.2.0,M11.1.0", 20, 16, 3859, 42},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 3901, 73},
+    {"CST6", 11, 24, 3974, 56},
+    {"<-03>3", 9, 17, 4030, 51},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 4081, 75},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 4156, 75},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 10, 4231, 75},
+    {"<-02>2", 21, 29, 4306, 16},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 21, 4322, 83},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 21, 4405, 75},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 21, 4480, 75},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 4555, 55},
+    {"<-03>3", 9, 34, 4610, 1},
+    {"EST5EDT,M3.2.0,M11.1.0", 15, 20, 4611, 43},
+    {"<-05>5", 10, 20, 4654, 8},
+    {"<-04>4", 8, 16, 4662, 6},
+    {"<-03>3", 9, 19, 4668, 93},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 4761, 75},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 4836, 71},
+    {"<-03>3", 9, 17, 4907, 16},
+    {"CST6", 11, 24, 4923, 0},
+    {"CST6CDT,M3.2.0,M11.1.0", 13, 24, 4923, 71},
+    {"<-03>3", 9, 16, 4994, 7},
+    {"<-04>4<-03>,M9.1.6/24,M4.1.6/24", 22, 19, 5001, 105},
+    {"AST4", 8, 35, 5106, 12},
+    {"<-03>3", 9, 17, 5118, 68},
+    {"<-02>2<-01>,M3.5.0/-1,M10.5.0/0", 18, 29, 5186, 89},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 27, 5275, 75},
+    {"NST3:30NDT,M3.2.0,M11.1.0", 23, 34, 5350, 84},
+    {"CST6", 11, 21, 5434, 1},
+    {"CST6", 11, 24, 5435, 6},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 5441, 33},
+    {"PST8PDT,M3.2.0,M11.1.0", 16, 27, 5474, 75},
+    {"MST7", 14, 27, 5549, 82},
+    {"AKST9AKDT,M3.2.0,M11.1.0", 7, 14, 5631, 75},
+    {"<+08>-8", 24, 36, 5706, 16},
+    {"<+07>-7", 25, 38, 5722, 4},
+    {"<+10>-10", 26, 40, 5726, 0},
+    {"AEST-10AEDT,M10.1.0,M4.1.0/3", 27, 41, 5726, 81},
+    {"<+05>-5", 28, 42, 5807, 1},
+    {"NZST-12NZDT,M9.5.0,M4.1.0/3", 29, 43, 5808, 67},
+    {"<-03>3", 9, 17, 5875, 71},
+    {"<-03>3", 9, 0, 5946, 1},
+    {"<+03>-3", 1, 1, 5947, 0},
+    {"<+00>0<+02>-2,M3.5.0/1,M10.5.0/3", 30, 0, 5947, 1},
+    {"<+05>-5", 28, 38, 5948, 3},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 5951, 33},
+    {"<+05>-5", 28, 42, 5984, 50},
+    {"<+03>-3", 1, 6, 6034, 86},
+    {"<+12>-12", 31, 47, 6120, 62},
+    {"<+05>-5", 28, 39, 6182, 48},
+    {"<+05>-5", 28, 39, 6230, 49},
+    {"<+05>-5", 28, 39, 6279, 23},
+    {"<+05>-5", 28, 39, 6302, 48},
+    {"<+03>-3", 1, 1, 6350, 52},
+    {"<+03>-3", 1, 51, 6402, 1},
+    {"<+04>-4", 32, 51, 6403, 64},
+    {"<+07>-7", 25, 38, 6467, 0},
+    {"<+07>-7", 25, 38, 6467, 65},
+    {"EET-2EEST,M3.5.0/0,M10.5.0/0", 33, 6, 6532, 45},
+    {"<+06>-6", 34, 42, 6577, 50},
+    {"<+08>-8", 24, 36, 6627, 0},
+    {"IST-5:30", 35, 54, 6627, 0},
+    {"<+09>-9", 36, 55, 6627, 64},
+    {"<+08>-8", 24, 38, 6691, 49},
+    {"CST-8", 24, 36, 6740, 12},
+    {"<+0530>-5:30", 35, 54, 6752, 3},
+    {"<+06>-6", 34, 42, 6755, 2},
+    {"<+03>-3", 1, 6, 6757, 96},
+    {"<+09>-9", 36, 55, 6853, 2},
+    {"<+04>-4", 32, 51, 6855, 0},
+    {"<+05>-5", 28, 42, 6855, 22},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 6877, 85},
+    {"EET-2EEST,M3.4.4/50,M10.4.4/50", 38, 6, 6962, 272},
+    {"EET-2EEST,M3.4.4/50,M10.4.4/50", 38, 6, 7234, 274},
+    {"<+07>-7", 25, 36, 7508, 1},
+    {"HKT-8", 24, 36, 7509, 16},
+    {"<+07>-7", 25, 42, 7525, 49},
+    {"<+08>-8", 24, 36, 7574, 63},
+    {"<+03>-3", 1, 6, 7637, 79},
+    {"WIB-7", 25, 38, 7716, 0},
+    {"WIT-9", 36, 55, 7716, 0},
+    {"IST-2IDT,M3.4.4/26,M10.5.0", 39, 6, 7716, 65},
+    {"<+0430>-4:30", 40, 59, 7781, 0},
+    {"<+12>-12", 31, 43, 7781, 62},
+    {"PKT-5", 28, 39, 7843, 6},
+    {"<+06>-6", 34, 42, 7849, 0},
+    {"<+0545>-5:45", 41, 54, 7849, 1},
+    {"<+09>-9", 36, 55, 7850, 65},
+    {"<+07>-7", 25, 38, 7915, 63},
+    {"<+08>-8", 24, 61, 7978, 1},
+    {"CST-8", 24, 36, 7979, 16},
+    {"<+11>-11", 42, 37, 7995, 64},
+    {"WITA-8", 24, 36, 8059, 0},
+    {"PST-8", 24, 36, 8059, 4},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 8063, 48},
+    {"<+07>-7", 25, 38, 8111, 62},
+    {"<+07>-7", 25, 38, 8173, 65},
+    {"<+06>-6", 34, 42, 8238, 63},
+    {"<+05>-5", 28, 39, 8301, 49},
+    {"WIB-7", 25, 36, 8350, 1},
+    {"KST-9", 36, 55, 8351, 2},
+    {"<+05>-5", 28, 39, 8353, 50},
+    {"<+05>-5", 28, 39, 8403, 50},
+    {"<+0630>-6:30", 43, 58, 8453, 0},
+    {"<+11>-11", 42, 37, 8453, 64},
+    {"<+05>-5", 28, 39, 8517, 22},
+    {"KST-9", 36, 55, 8539, 4},
+    {"<+11>-11", 42, 37, 8543, 63},
+    {"CST-8", 24, 36, 8606, 6},
+    {"<+05>-5", 28, 42, 8612, 22},
+    {"<+04>-4", 32, 51, 8634, 48},
+    {"<+0330>-3:30", 44, 63, 8682, 69},
+    {"<+06>-6", 34, 54, 8751, 1},
+    {"JST-9", 36, 55, 8752, 0},
+    {"<+07>-7", 25, 38, 8752, 65},
+    {"<+10>-10", 26, 55, 8817, 64},
+    {"<+10>-10", 26, 40, 8881, 63},
+    {"<+09>-9", 36, 55, 8944, 63},
+    {"<+05>-5", 28, 39, 9007, 63},
+    {"<+04>-4", 32, 51, 9070, 60},
+    {"<-01>1<+00>,M3.5.0/0,M10.5.0/1", 45, 5, 9130, 31},
+    {"AST4ADT,M3.2.0,M11.1.0", 17, 16, 9161, 67},
+    {"WET0WEST,M3.5.0/1,M10.5.0", 46, 0, 9228, 33},
+    {"<-01>1", 47, 29, 9261, 1},
+    {"WET0WEST,M3.5.0/1,M10.5.0", 46, 0, 9262, 31},
+    {"WET0WEST,M3.5.0/1,M10.5.0", 46, 0, 9293, 29},
+    {"<-02>2", 21, 29, 9322, 0},
+    {"<-03>3", 9, 16, 9322, 56},
+    {"AEST-10AEDT,M10.1.0,M4.1.0/3", 27, 40, 9378, 74},
+    {"ACST-9:30ACDT,M10.1.0,M4.1.0/3", 48, 65, 9452, 74},
+    {"AEST-10", 26, 40, 9526, 8},
+    {"ACST-9:30ACDT,M10.1.0,M4.1.0/3", 48, 65, 9534, 74},
+    {"AEST-10AEDT,M10.1.0,M4.1.0/3", 27, 41, 9608, 76},
+    {"ACST-9:30", 49, 65, 9684, 0},
+    {"<+0845>-8:45", 50, 67, 9684, 12},
+    {"<+1030>-10:30<+11>-11,M10.1.0,M4.1.0", 51, 40, 9696, 55},
+    {"AEST-10", 26, 40, 9751, 12},
+    {"AEST-10AEDT,M10.1.0,M4.1.0/3", 27, 40, 9763, 74},
+    {"AWST-8", 24, 36, 9837, 12},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 9849, 39},
+    {"<-06>6<-05>,M9.1.6/22,M4.1.6/22", 52, 22, 9888, 105},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 9993, 39},
+    {"IST-1GMT0,M10.5.0,M3.5.0/1", 53, 3, 10032, 50},
+    {"<-01>1", 47, 5, 10082, 0},
+    {"<-10>10", 54, 12, 10082, 0},
+    {"<-11>11", 55, 10, 10082, 0},
+    {"<-12>12", 56, 71, 10082, 0},
+    {"<-05>5", 10, 20, 10082, 0},
+    {"<-06>6", 11, 24, 10082, 0},
+    {"<-07>7", 14, 21, 10082, 0},
+    {"<-08>8", 57, 27, 10082, 0},
+    {"<-09>9", 58, 14, 10082, 0},
+    {"<+01>-1", 2, 3, 10082, 0},
+    {"<+11>-11", 42, 37, 10082, 0},
+    {"<+12>-12", 31, 43, 10082, 0},
+    {"<+13>-13", 59, 47, 10082, 0},
+    {"<+14>-14", 60, 72, 10082, 0},
+    {"<+02>-2", 3, 6, 10082, 0},
+    {"<+05>-5", 28, 39, 10082, 0},
+    {"<+09>-9", 36, 55, 10082, 0},
+    {"UTC0", 0, 0, 10082, 0},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10082, 23},
+    {"<+04>-4", 32, 51, 10105, 62},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 10167, 43},
+    {"GMT0BST,M3.5.0/1,M10.5.0", 46, 3, 10210, 50},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10260, 27},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10287, 35},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 10322, 37},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10359, 33},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10392, 31},
+    {"EET-2EEST,M3.5.0,M10.5.0/3", 61, 1, 10423, 34},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10457, 29},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 10486, 31},
+    {"EET-2", 3, 1, 10517, 62},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 1, 10579, 31},
+    {"MSK-3", 1, 51, 10610, 61},
+    {"WET0WEST,M3.5.0/1,M10.5.0", 46, 3, 10671, 40},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10711, 45},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10756, 53},
+    {"<+03>-3", 1, 1, 10809, 59},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 10868, 41},
+    {"MSK-3", 1, 1, 10909, 63},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 1, 10972, 39},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 11011, 53},
+    {"<+04>-4", 32, 51, 11064, 62},
+    {"<+04>-4", 32, 51, 11126, 62},
+    {"MSK-3", 1, 1, 11188, 66},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 6, 11254, 37},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 1, 11291, 39},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 11330, 45},
+    {"<+04>-4", 32, 51, 11375, 64},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 11439, 33},
+    {"EET-2EEST,M3.5.0/3,M10.5.0/4", 37, 1, 11472, 39},
+    {"MSK-3", 1, 51, 11511, 63},
+    {"CET-1CEST,M3.5.0,M10.5.0/3", 5, 3, 11574, 39},
+    {"<-00>0", 0, 0, 11613, 0},
+    {"HST10", 54, 12, 11613, 0},
+    {"<+06>-6", 34, 39, 11613, 1},
+    {"<+04>-4", 32, 51, 11614, 4},
+    {"<+12>-12", 31, 71, 11618, 1},
+    {"MET-1MEST,M3.5.0,M10.5.0/3", 5, 3, 11619, 39},
+    {"<+1245>-12:45<+1345>,M9.5.0/2:45,M4.1.0/3:45", 62, 73, 11658, 67},
+    {"<+13>-13", 59, 10, 11725, 23},
+    {"<+11>-11", 42, 40, 11748, 1},
+    {"<+11>-11", 42, 37, 11749, 22},
+    {"<+13>-13", 59, 71, 11771, 2},
+    {"<+13>-13", 59, 10, 11773, 1},
+    {"<+12>-12", 31, 43, 11774, 28},
+    {"<-06>6", 11, 20, 11802, 3},
+    {"ChST-10", 26, 40, 11805, 10},
+    {"<+14>-14", 60, 75, 11815, 2},
+    {"<+11>-11", 42, 43, 11817, 1},
+    {"<-0930>9:30", 63, 76, 11818, 0},
+    {"SST11", 55, 10, 11818, 0},
+    {"<+12>-12", 31, 77, 11818, 1},
+    {"<+11>-11<+12>,M10.1.0,M4.1.0/3", 64, 77, 11819, 4},
+    {"<+11>-11", 42, 37, 11823, 6},
+    {"<-08>8", 57, 79, 11829, 1},
+    {"<-10>10", 54, 80, 11830, 26},
+    {"<+13>-13", 59, 47, 11856, 8},
+    {"WET0WEST,M3.5.0/1,M10.5.0", 46, 0, 11864, 39},
+};
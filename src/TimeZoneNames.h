@@ -0,0 +1,689 @@
+// Gerado por extras/tools/gen_tzdata.py a partir do tzdata 2025b (transições desde 1970). Não editar.
+
+#ifndef TIME_ZONE_NAMES_H
+#define TIME_ZONE_NAMES_H
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+constexpr size_t TZ_NAME_COUNT = 598;
+constexpr size_t TZ_HASH_BUCKETS = 200;
+
+inline constexpr uint16_t TZ_HASH_SEEDS[TZ_HASH_BUCKETS] = {
+    2, 1, 1, 54, 21, 7, 1, 3, 2, 7, 25, 46,
+    10, 2, 10, 16, 37, 23, 1, 9, 16, 44, 1, 1,
+    1, 20, 14, 1, 32, 8, 0, 2, 17, 37, 2, 0,
+    3, 9, 11, 48, 4, 4, 19, 1, 4, 7, 23, 2,
+    28, 48, 2, 2, 14, 6, 10, 51, 101, 5, 7, 12,
+    64, 13, 0, 4, 1, 1, 66, 19, 6, 5, 13, 12,
+    81, 69, 23, 1, 161, 167, 15, 11, 3, 6, 1, 9,
+    20, 1, 62, 11, 5, 14, 26, 21, 7, 54, 50, 2,
+    19, 1, 1, 1, 28, 6, 26, 19, 32, 8, 0, 79,
+    17, 9, 20, 45, 25, 49, 140, 0, 40, 15, 23, 4,
+    6, 39, 2, 11, 0, 37, 3, 1, 10, 35, 20, 295,
+    60, 123, 4, 2, 79, 105, 9, 11, 93, 12, 6, 1,
+    14, 14, 8, 89, 34, 4, 118, 49, 46, 14, 3, 68,
+    3, 13, 33, 37, 63, 86, 289, 9, 106, 0, 27, 176,
+    91, 40, 17, 10, 0, 38, 131, 8, 33, 58, 77, 212,
+    155, 59, 2, 44, 31, 102, 104, 145, 2, 1, 63, 146,
+    164, 130, 6, 45, 239, 1108, 35, 43,
+};
+
+// Nomes na ordem das posições do hash
+inline constexpr std::string_view TZ_NAME_KEYS[TZ_NAME_COUNT] = {
+    "GB",
+    "Africa/Ouagadougou",
+    "Africa/Abidjan",
+    "NZ-CHAT",
+    "Australia/Victoria",
+    "America/Coral_Harbour",
+    "Canada/Newfoundland",
+    "Asia/Pyongyang",
+    "Africa/Niamey",
+    "America/Indiana/Knox",
+    "America/Miquelon",
+    "America/Argentina/San_Luis",
+    "Asia/Bahrain",
+    "Asia/Amman",
+    "Pacific/Pago_Pago",
+    "America/Montevideo",
+    "America/Knox_IN",
+    "Pacific/Chuuk",
+    "Africa/Luanda",
+    "America/Matamoros",
+    "GMT",
+    "Etc/GMT+0",
+    "America/Chihuahua",
+    "Europe/Vaduz",
+    "Africa/Bamako",
+    "Asia/Tel_Aviv",
+    "America/Grand_Turk",
+    "Africa/Tripoli",
+    "Asia/Muscat",
+    "Australia/Tasmania",
+    "Europe/Kirov",
+    "America/Argentina/Tucuman",
+    "America/Godthab",
+    "Africa/Casablanca",
+    "Asia/Kathmandu",
+    "America/Santarem",
+    "Etc/GMT-9",
+    "America/North_Dakota/Beulah",
+    "America/Anchorage",
+    "Asia/Yakutsk",
+    "Antarctica/Macquarie",
+    "Pacific/Easter",
+    "Asia/Aqtau",
+    "America/Tortola",
+    "America/Argentina/Cordoba",
+    "Asia/Urumqi",
+    "Australia/Lord_Howe",
+    "Atlantic/Jan_Mayen",
+    "Antarctica/South_Pole",
+    "Asia/Ho_Chi_Minh",
+    "Antarctica/Mawson",
+    "America/Mendoza",
+    "Canada/Saskatchewan",
+    "Canada/Pacific",
+    "Africa/Tunis",
+    "Africa/Dakar",
+    "Zulu",
+    "Pacific/Apia",
+    "America/Punta_Arenas",
+    "Asia/Seoul",
+    "Europe/Vienna",
+    "Europe/Jersey",
+    "Antarctica/Palmer",
+    "Europe/Ljubljana",
+    "Asia/Baku",
+    "Europe/Zaporozhye",
+    "America/St_Vincent",
+    "Pacific/Niue",
+    "Asia/Jerusalem",
+    "Pacific/Ponape",
+    "Asia/Aqtobe",
+    "America/Manaus",
+    "Canada/Eastern",
+    "Etc/GMT-0",
+    "America/Dawson",
+    "America/Louisville",
+    "Asia/Sakhalin",
+    "Asia/Makassar",
+    "Africa/Asmara",
+    "Etc/GMT+10",
+    "America/Monterrey",
+    "America/Boa_Vista",
+    "America/Porto_Acre",
+    "HST",
+    "Asia/Chongqing",
+    "America/Puerto_Rico",
+    "Etc/GMT-14",
+    "GMT-0",
+    "ROK",
+    "Asia/Aden",
+    "Europe/Malta",
+    "PST8PDT",
+    "America/Santiago",
+    "Europe/Chisinau",
+    "America/Tegucigalpa",
+    "America/Jujuy",
+    "Europe/Monaco",
+    "Europe/Podgorica",
+    "Pacific/Noumea",
+    "Asia/Yekaterinburg",
+    "America/Bahia",
+    "America/Cuiaba",
+    "Poland",
+    "America/Denver",
+    "Asia/Bishkek",
+    "Asia/Kuwait",
+    "Africa/Nairobi",
+    "Asia/Jakarta",
+    "Europe/Vatican",
+    "Europe/Zurich",
+    "Atlantic/Cape_Verde",
+    "Africa/Maputo",
+    "Africa/Lome",
+    "Pacific/Johnston",
+    "Europe/Kiev",
+    "Greenwich",
+    "America/Fort_Nelson",
+    "America/Tijuana",
+    "Asia/Chungking",
+    "Brazil/East",
+    "America/Barbados",
+    "America/Moncton",
+    "America/Dawson_Creek",
+    "Asia/Damascus",
+    "Africa/Algiers",
+    "US/Michigan",
+    "Pacific/Tarawa",
+    "US/East-Indiana",
+    "Asia/Istanbul",
+    "Atlantic/Madeira",
+    "America/St_Barthelemy",
+    "Africa/Addis_Ababa",
+    "GMT+0",
+    "America/Mazatlan",
+    "Europe/Busingen",
+    "Cuba",
+    "Pacific/Fiji",
+    "America/Maceio",
+    "Europe/Sarajevo",
+    "America/Antigua",
+    "Europe/Madrid",
+    "Navajo",
+    "Asia/Khandyga",
+    "Australia/Eucla",
+    "Asia/Novosibirsk",
+    "Antarctica/Syowa",
+    "Africa/Maseru",
+    "Europe/Amsterdam",
+    "Asia/Dhaka",
+    "Pacific/Wallis",
+    "Asia/Tehran",
+    "Brazil/West",
+    "Etc/GMT+2",
+    "Atlantic/Stanley",
+    "Portugal",
+    "Etc/GMT-13",
+    "Etc/GMT-11",
+    "Europe/Istanbul",
+    "Etc/GMT",
+    "Etc/GMT+12",
+    "Asia/Beirut",
+    "Europe/Bratislava",
+    "Australia/Sydney",
+    "Pacific/Tongatapu",
+    "Etc/GMT-5",
+    "America/Port-au-Prince",
+    "US/Central",
+    "America/Fortaleza",
+    "Asia/Anadyr",
+    "Pacific/Palau",
+    "Asia/Macau",
+    "America/Goose_Bay",
+    "Asia/Oral",
+    "Asia/Singapore",
+    "America/Havana",
+    "Pacific/Auckland",
+    "America/Hermosillo",
+    "W-SU",
+    "Africa/Banjul",
+    "Asia/Ulaanbaatar",
+    "America/Bogota",
+    "Europe/Skopje",
+    "Kwajalein",
+    "Australia/Queensland",
+    "Asia/Karachi",
+    "UTC",
+    "Canada/Central",
+    "Etc/UTC",
+    "Africa/Accra",
+    "Etc/GMT-12",
+    "Pacific/Midway",
+    "America/Aruba",
+    "America/Nassau",
+    "Europe/Moscow",
+    "Africa/Freetown",
+    "America/Boise",
+    "Asia/Ashgabat",
+    "America/Juneau",
+    "America/Inuvik",
+    "Etc/GMT0",
+    "Asia/Phnom_Penh",
+    "Asia/Yerevan",
+    "America/Curacao",
+    "Europe/Berlin",
+    "America/New_York",
+    "Europe/Saratov",
+    "America/Mexico_City",
+    "Africa/Mogadishu",
+    "America/Creston",
+    "America/Indiana/Winamac",
+    "Europe/Vilnius",
+    "America/Detroit",
+    "Australia/North",
+    "Israel",
+    "Etc/UCT",
+    "Asia/Novokuznetsk",
+    "America/Recife",
+    "Etc/GMT+11",
+    "America/Adak",
+    "Singapore",
+    "Africa/Ndjamena",
+    "Asia/Vientiane",
+    "Pacific/Marquesas",
+    "Asia/Tbilisi",
+    "America/Sao_Paulo",
+    "America/Martinique",
+    "Etc/GMT-1",
+    "Jamaica",
+    "Etc/GMT-4",
+    "America/Rainy_River",
+    "Africa/Timbuktu",
+    "Asia/Qyzylorda",
+    "CET",
+    "Pacific/Nauru",
+    "America/Metlakatla",
+    "US/Mountain",
+    "Pacific/Rarotonga",
+    "Asia/Dubai",
+    "Mexico/General",
+    "Europe/Kaliningrad",
+    "America/Halifax",
+    "Africa/Blantyre",
+    "America/North_Dakota/Center",
+    "Asia/Kabul",
+    "Asia/Hebron",
+    "Europe/Minsk",
+    "Europe/Sofia",
+    "America/Indianapolis",
+    "America/Port_of_Spain",
+    "America/Argentina/Rio_Gallegos",
+    "America/Indiana/Indianapolis",
+    "America/Porto_Velho",
+    "Etc/GMT+6",
+    "Etc/GMT+8",
+    "Africa/Libreville",
+    "Europe/Volgograd",
+    "PRC",
+    "Brazil/DeNoronha",
+    "Chile/EasterIsland",
+    "CST6CDT",
+    "Asia/Ashkhabad",
+    "Asia/Nicosia",
+    "America/Merida",
+    "Pacific/Kwajalein",
+    "America/St_Johns",
+    "Canada/Atlantic",
+    "America/Santo_Domingo",
+    "Asia/Magadan",
+    "Asia/Famagusta",
+    "America/Yellowknife",
+    "America/Menominee",
+    "Europe/Prague",
+    "America/Indiana/Vincennes",
+    "Indian/Mahe",
+    "Europe/Paris",
+    "Australia/Darwin",
+    "Asia/Brunei",
+    "Australia/ACT",
+    "Atlantic/Bermuda",
+    "America/Scoresbysund",
+    "ROC",
+    "Antarctica/DumontDUrville",
+    "America/Phoenix",
+    "Turkey",
+    "Europe/San_Marino",
+    "Europe/Simferopol",
+    "Asia/Qostanay",
+    "Pacific/Galapagos",
+    "Asia/Dili",
+    "Europe/Oslo",
+    "Africa/Conakry",
+    "Europe/Bucharest",
+    "Asia/Saigon",
+    "Indian/Mauritius",
+    "Asia/Hong_Kong",
+    "Europe/Budapest",
+    "Europe/London",
+    "America/Atikokan",
+    "Africa/Sao_Tome",
+    "America/Belem",
+    "Pacific/Honolulu",
+    "Asia/Harbin",
+    "US/Indiana-Starke",
+    "Antarctica/McMurdo",
+    "Antarctica/Casey",
+    "Australia/Adelaide",
+    "Indian/Mayotte",
+    "Europe/Zagreb",
+    "America/Rio_Branco",
+    "US/Eastern",
+    "Australia/Hobart",
+    "America/Costa_Rica",
+    "America/Iqaluit",
+    "Hongkong",
+    "America/Cambridge_Bay",
+    "Asia/Tashkent",
+    "America/Indiana/Marengo",
+    "Australia/Brisbane",
+    "Africa/Kigali",
+    "America/Guayaquil",
+    "EET",
+    "Indian/Antananarivo",
+    "Etc/GMT-3",
+    "Pacific/Truk",
+    "Africa/Khartoum",
+    "Pacific/Kanton",
+    "Etc/GMT+3",
+    "Pacific/Norfolk",
+    "Eire",
+    "America/Ensenada",
+    "Asia/Hovd",
+    "America/Regina",
+    "America/Argentina/Ushuaia",
+    "Asia/Omsk",
+    "America/Thunder_Bay",
+    "Asia/Rangoon",
+    "Pacific/Samoa",
+    "Egypt",
+    "Africa/Gaborone",
+    "America/Winnipeg",
+    "America/Santa_Isabel",
+    "Asia/Kuching",
+    "Africa/Mbabane",
+    "Asia/Ujung_Pandang",
+    "Etc/GMT+9",
+    "Europe/Riga",
+    "Europe/Uzhgorod",
+    "Europe/Guernsey",
+    "Pacific/Kosrae",
+    "Europe/Ulyanovsk",
+    "America/Bahia_Banderas",
+    "Asia/Almaty",
+    "Etc/Universal",
+    "Asia/Baghdad",
+    "Pacific/Efate",
+    "Libya",
+    "America/Sitka",
+    "Europe/Astrakhan",
+    "Asia/Vladivostok",
+    "America/Pangnirtung",
+    "Australia/Currie",
+    "America/Indiana/Tell_City",
+    "America/Noronha",
+    "America/Kentucky/Louisville",
+    "America/Toronto",
+    "America/Argentina/Jujuy",
+    "Pacific/Kiritimati",
+    "GB-Eire",
+    "Asia/Shanghai",
+    "America/Coyhaique",
+    "Etc/GMT+4",
+    "US/Arizona",
+    "Asia/Ulan_Bator",
+    "America/Buenos_Aires",
+    "Canada/Yukon",
+    "Etc/GMT+1",
+    "America/Anguilla",
+    "Pacific/Pitcairn",
+    "America/Danmarkshavn",
+    "Africa/Malabo",
+    "Africa/Bissau",
+    "Pacific/Guadalcanal",
+    "Indian/Reunion",
+    "Pacific/Enderbury",
+    "MST7MDT",
+    "Asia/Chita",
+    "US/Hawaii",
+    "Europe/Tiraspol",
+    "Japan",
+    "America/Ciudad_Juarez",
+    "WET",
+    "America/Nuuk",
+    "Asia/Choibalsan",
+    "NZ",
+    "Pacific/Bougainville",
+    "Africa/Lubumbashi",
+    "America/Caracas",
+    "Etc/GMT-10",
+    "Australia/LHI",
+    "America/Campo_Grande",
+    "America/St_Thomas",
+    "Africa/Douala",
+    "Asia/Manila",
+    "Africa/Juba",
+    "America/Argentina/San_Juan",
+    "US/Aleutian",
+    "Pacific/Wake",
+    "Etc/Zulu",
+    "America/Rosario",
+    "America/Glace_Bay",
+    "Europe/Rome",
+    "Australia/Lindeman",
+    "US/Alaska",
+    "America/Cancun",
+    "Africa/Djibouti",
+    "Africa/Harare",
+    "Indian/Christmas",
+    "Africa/Lagos",
+    "Atlantic/South_Georgia",
+    "Antarctica/Davis",
+    "Pacific/Tahiti",
+    "Europe/Kyiv",
+    "America/Cayman",
+    "Pacific/Funafuti",
+    "America/Araguaina",
+    "Europe/Andorra",
+    "MST",
+    "America/Ojinaga",
+    "Antarctica/Troll",
+    "Pacific/Pohnpei",
+    "America/Rankin_Inlet",
+    "America/Eirunepe",
+    "Asia/Irkutsk",
+    "America/Guatemala",
+    "Pacific/Port_Moresby",
+    "America/Whitehorse",
+    "Australia/Perth",
+    "America/Panama",
+    "Africa/Monrovia",
+    "Antarctica/Vostok",
+    "Africa/Nouakchott",
+    "Africa/Kampala",
+    "EST",
+    "Atlantic/Reykjavik",
+    "Europe/Isle_of_Man",
+    "Pacific/Fakaofo",
+    "Asia/Kuala_Lumpur",
+    "Asia/Jayapura",
+    "Australia/South",
+    "America/Edmonton",
+    "Australia/NSW",
+    "Asia/Taipei",
+    "Australia/Canberra",
+    "America/La_Paz",
+    "Etc/GMT-2",
+    "Asia/Qatar",
+    "Africa/Johannesburg",
+    "Asia/Colombo",
+    "Australia/Melbourne",
+    "America/Kralendijk",
+    "GMT0",
+    "America/Nome",
+    "Europe/Belfast",
+    "Africa/Bangui",
+    "Europe/Lisbon",
+    "Australia/West",
+    "Asia/Riyadh",
+    "America/Guadeloupe",
+    "Europe/Tirane",
+    "Africa/Cairo",
+    "America/Yakutat",
+    "Asia/Bangkok",
+    "Asia/Barnaul",
+    "Asia/Pontianak",
+    "Arctic/Longyearbyen",
+    "Europe/Stockholm",
+    "Australia/Broken_Hill",
+    "America/Fort_Wayne",
+    "Europe/Warsaw",
+    "America/Managua",
+    "Africa/Dar_es_Salaam",
+    "Indian/Chagos",
+    "Europe/Helsinki",
+    "Europe/Athens",
+    "Asia/Thimphu",
+    "Universal",
+    "Mexico/BajaNorte",
+    "Asia/Calcutta",
+    "Asia/Macao",
+    "America/Indiana/Petersburg",
+    "Europe/Tallinn",
+    "America/St_Kitts",
+    "America/Marigot",
+    "Indian/Maldives",
+    "Africa/Lusaka",
+    "Europe/Luxembourg",
+    "Europe/Nicosia",
+    "America/Indiana/Vevay",
+    "America/Lower_Princes",
+    "America/Virgin",
+    "America/Guyana",
+    "America/Montserrat",
+    "US/Pacific",
+    "EST5EDT",
+    "America/Argentina/Buenos_Aires",
+    "America/Jamaica",
+    "Asia/Katmandu",
+    "Africa/Asmera",
+    "Chile/Continental",
+    "America/Asuncion",
+    "Africa/El_Aaiun",
+    "America/Swift_Current",
+    "America/Shiprock",
+    "America/Montreal",
+    "America/North_Dakota/New_Salem",
+    "Australia/Yancowinna",
+    "Pacific/Yap",
+    "Indian/Comoro",
+    "America/St_Lucia",
+    "America/Argentina/Catamarca",
+    "America/Argentina/Salta",
+    "Atlantic/Azores",
+    "Indian/Cocos",
+    "Brazil/Acre",
+    "America/Argentina/La_Rioja",
+    "Asia/Kamchatka",
+    "America/Lima",
+    "Atlantic/Canary",
+    "Pacific/Saipan",
+    "Asia/Krasnoyarsk",
+    "America/Vancouver",
+    "America/Atka",
+    "Asia/Dushanbe",
+    "Africa/Ceuta",
+    "Atlantic/Faeroe",
+    "Asia/Ust-Nera",
+    "America/Argentina/Mendoza",
+    "Europe/Dublin",
+    "Asia/Tokyo",
+    "Atlantic/St_Helena",
+    "Etc/GMT+7",
+    "America/Nipigon",
+    "Africa/Kinshasa",
+    "Asia/Gaza",
+    "America/Resolute",
+    "Atlantic/Faroe",
+    "America/Belize",
+    "Antarctica/Rothera",
+    "Pacific/Chatham",
+    "Africa/Brazzaville",
+    "Pacific/Majuro",
+    "Pacific/Guam",
+    "America/Thule",
+    "Africa/Bujumbura",
+    "Asia/Kashgar",
+    "Asia/Dacca",
+    "Europe/Mariehamn",
+    "America/Catamarca",
+    "Europe/Brussels",
+    "America/Grenada",
+    "Asia/Yangon",
+    "Africa/Windhoek",
+    "Asia/Kolkata",
+    "Pacific/Gambier",
+    "Indian/Kerguelen",
+    "America/Blanc-Sablon",
+    "America/Cordoba",
+    "Iceland",
+    "America/Dominica",
+    "US/Samoa",
+    "Europe/Belgrade",
+    "America/Chicago",
+    "Asia/Srednekolymsk",
+    "America/Argentina/ComodRivadavia",
+    "Mexico/BajaSur",
+    "Iran",
+    "America/Kentucky/Monticello",
+    "America/Los_Angeles",
+    "Etc/Greenwich",
+    "Europe/Gibraltar",
+    "Factory",
+    "Asia/Thimbu",
+    "Asia/Samarkand",
+    "Europe/Copenhagen",
+    "Asia/Atyrau",
+    "MET",
+    "Canada/Mountain",
+    "Africa/Porto-Novo",
+    "America/Paramaribo",
+    "America/El_Salvador",
+    "Etc/GMT-6",
+    "Etc/GMT+5",
+    "America/Cayenne",
+    "Etc/GMT-7",
+    "Asia/Tomsk",
+    "Europe/Samara",
+    "Etc/GMT-8",
+    "UCT",
+};
+
+// Índice em TZ_ZONES de cada nome
+inline constexpr uint16_t TZ_NAME_ZONES[TZ_NAME_COUNT] = {
+    270, 0, 0, 307, 243, 36, 133, 206, 3, 79, 105, 32,
+    160, 153, 319, 108, 79, 142, 3, 99, 0, 0, 51, 275,
+    0, 187, 72, 16, 175, 238, 281, 33, 70, 7, 192, 127,
+    265, 113, 20, 223, 143, 246, 155, 21, 25, 191, 241, 151,
+    145, 180, 144, 28, 125, 137, 17, 0, 266, 308, 121, 212,
+    297, 270, 146, 271, 161, 280, 21, 251, 187, 259, 156, 97,
+    109, 0, 58, 90, 210, 198, 1, 250, 107, 42, 119, 302,
+    170, 21, 262, 0, 212, 148, 284, 94, 128, 276, 135, 26,
+    286, 271, 322, 224, 37, 56, 300, 60, 165, 148, 1, 185,
+    289, 275, 229, 5, 0, 302, 280, 0, 66, 65, 170, 130,
+    39, 106, 59, 173, 2, 61, 260, 67, 184, 231, 21, 1,
+    0, 100, 275, 77, 313, 95, 271, 21, 283, 60, 193, 240,
+    202, 148, 10, 245, 172, 260, 217, 97, 232, 233, 282, 261,
+    259, 184, 0, 252, 164, 272, 234, 325, 264, 118, 50, 68,
+    154, 265, 196, 71, 204, 195, 77, 145, 78, 287, 0, 169,
+    43, 271, 305, 236, 190, 266, 122, 266, 0, 260, 319, 21,
+    109, 287, 0, 44, 157, 89, 86, 0, 162, 225, 21, 151,
+    110, 291, 104, 1, 55, 85, 298, 61, 239, 187, 266, 201,
+    124, 251, 19, 195, 14, 162, 318, 216, 130, 98, 258, 88,
+    175, 122, 0, 208, 245, 320, 103, 60, 324, 175, 104, 279,
+    76, 5, 114, 188, 179, 285, 293, 67, 21, 29, 67, 120,
+    254, 256, 3, 299, 170, 112, 246, 50, 157, 200, 102, 305,
+    133, 76, 129, 197, 177, 62, 101, 272, 84, 175, 286, 239,
+    166, 234, 227, 131, 214, 142, 55, 184, 289, 292, 207, 314,
+    174, 151, 0, 273, 180, 304, 181, 274, 270, 36, 15, 40,
+    302, 170, 79, 145, 140, 235, 1, 271, 119, 110, 238, 53,
+    87, 181, 45, 215, 80, 236, 5, 74, 247, 1, 148, 142,
+    12, 311, 49, 321, 248, 65, 182, 125, 34, 203, 109, 209,
+    319, 6, 5, 122, 65, 166, 10, 198, 257, 288, 280, 270,
+    317, 296, 38, 152, 266, 159, 310, 16, 132, 268, 222, 87,
+    238, 82, 112, 90, 109, 26, 316, 270, 170, 54, 92, 55,
+    169, 23, 138, 249, 21, 323, 57, 3, 4, 259, 175, 311,
+    60, 168, 302, 276, 219, 52, 326, 70, 169, 145, 309, 5,
+    48, 142, 241, 46, 21, 3, 199, 11, 31, 19, 260, 266,
+    25, 69, 289, 242, 20, 47, 1, 5, 162, 3, 232, 141,
+    250, 280, 36, 260, 22, 267, 55, 116, 149, 259, 123, 63,
+    183, 73, 142, 138, 244, 36, 13, 150, 0, 1, 36, 0,
+    270, 312, 195, 186, 235, 62, 234, 214, 234, 92, 263, 160,
+    10, 171, 243, 21, 0, 111, 270, 3, 282, 244, 148, 21,
+    295, 6, 139, 162, 163, 205, 151, 151, 237, 67, 300, 96,
+    1, 303, 278, 269, 218, 266, 65, 167, 196, 81, 294, 21,
+    21, 264, 5, 245, 200, 83, 21, 21, 75, 21, 94, 110,
+    23, 88, 192, 1, 128, 35, 9, 134, 60, 109, 115, 237,
+    142, 1, 21, 24, 30, 226, 209, 119, 27, 189, 93, 228,
+    315, 194, 137, 19, 176, 8, 230, 221, 28, 248, 219, 0,
+    255, 109, 3, 178, 126, 230, 41, 147, 307, 3, 260, 315,
+    136, 5, 191, 172, 278, 24, 245, 21, 209, 18, 167, 257,
+    264, 21, 25, 0, 21, 319, 271, 50, 213, 24, 100, 217,
+    91, 94, 0, 277, 301, 218, 211, 151, 158, 306, 62, 3,
+    117, 64, 191, 253, 49, 162, 220, 290, 166, 266,
+};
+
+#endif // TIME_ZONE_NAMES_H
@@ -0,0 +1,820 @@
+#if defined(ARDUINO)
+
+#include "NTPHal.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <WiFi.h>
+#include <esp_private/esp_clk.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include <algorithm>
+#include <atomic>
+#include <lwip/dns.h>
+#include <lwip/pbuf.h>
+#include <lwip/priv/tcpip_priv.h>
+#include <lwip/tcpip.h>
+#include <lwip/udp.h>
+#include <new>
+
+// IPv6 no lwIP do Arduino existe a partir do core 3.x
+#if LWIP_IPV6 && defined(ESP_ARDUINO_VERSION_MAJOR) && ESP_ARDUINO_VERSION_MAJOR >= 3
+#define NTP_ESP32_IPV6 1
+#else
+#define NTP_ESP32_IPV6 0
+#endif
+
+constexpr uint8_t NTP_ESP32_RX_QUEUE = 8;                        // Respostas aguardando receive()
+constexpr uint8_t NTP_ESP32_SERVER_QUEUE = 2 * NTP_SERVER_BATCH; // Pedidos aguardando receiveBatch()
+
+// ----------------------------------------------------
+//
+//               Rede (WiFi + UDP e DNS do lwIP)
+//
+// ----------------------------------------------------
+
+static void toAddress(const ip_addr_t *ip, NTPAddress &address)
+{
+    memset(address.ip, 0, sizeof(address.ip));
+#if NTP_ESP32_IPV6
+    if (IP_IS_V6(ip))
+    {
+        address.family = NTPFamily::IPv6;
+        memcpy(address.ip, ip_2_ip6(ip)->addr, 16);
+        return;
+    }
+#endif
+    uint32_t v4 = ip4_addr_get_u32(ip_2_ip4(ip));
+    address.family = NTPFamily::IPv4;
+    memcpy(address.ip, &v4, 4);
+}
+
+static void toIp(const NTPAddress &address, ip_addr_t &ip)
+{
+    memset(&ip, 0, sizeof(ip));
+#if NTP_ESP32_IPV6
+    if (address.family == NTPFamily::IPv6)
+    {
+        IP_SET_TYPE_VAL(ip, IPADDR_TYPE_V6);
+        memcpy(ip_2_ip6(&ip)->addr, address.ip, 16);
+        return;
+    }
+#endif
+    IP_SET_TYPE_VAL(ip, IPADDR_TYPE_V4);
+    memcpy(&ip_2_ip4(&ip)->addr, address.ip, 4);
+}
+
+/**
+ * @brief Consulta DNS assíncrona do lwIP
+ *
+ * dns_gethostbyname() precisa rodar na thread tcpip, que também chama
+ * dnsFound(). A geração identifica consultas canceladas cujo callback
+ * ainda chega depois. A tabela é comum a todas as instâncias de
+ * Esp32Network.
+ *
+ * used, generation, hostname e ip só são acessados com esp32LookupLock,
+ * pela tarefa de sincronização e pela thread tcpip: um slot não é liberado
+ * nem reaproveitado enquanto um callback antigo o usa. O lock nunca é
+ * mantido durante chamadas ao lwIP.
+ */
+struct Esp32Lookup
+{
+    std::atomic<int8_t> state; // 1 resolvido, 0 em andamento, -1 falha
+    std::atomic<bool> used;
+    std::atomic<uint8_t> generation;
+    char hostname[64];
+    ip_addr_t ip;
+};
+
+static Esp32Lookup esp32Lookups[NTP_MAX_DNS_QUERIES];
+static std::mutex esp32LookupLock;
+
+/**
+ * @brief Slot da consulta identificada por tag, ou nullptr se ele já foi
+ *        liberado ou reaproveitado
+ *
+ * Deve ser chamada com esp32LookupLock adquirido.
+ */
+static Esp32Lookup *esp32Lookup(uintptr_t tag)
+{
+    Esp32Lookup &lookup = esp32Lookups[tag & 0xFF];
+    if (!lookup.used || lookup.generation != (uint8_t)(tag >> 8))
+        return nullptr;
+    return &lookup;
+}
+
+static void dnsFound(const char *name, const ip_addr_t *ip, void *arg)
+{
+    (void)name;
+    std::lock_guard<std::mutex> lock(esp32LookupLock);
+    Esp32Lookup *lookup = esp32Lookup((uintptr_t)arg);
+    if (lookup == nullptr)
+        return;
+
+    bool found = ip != nullptr && IP_IS_V4(ip);
+#if NTP_ESP32_IPV6
+    found = found || (ip != nullptr && IP_IS_V6(ip));
+#endif
+    if (found)
+        lookup->ip = *ip;
+    lookup->state.store(found ? 1 : -1, std::memory_order_release);
+}
+
+static void dnsStart(void *arg)
+{
+    char hostname[sizeof(esp32Lookups[0].hostname)];
+    {
+        std::lock_guard<std::mutex> lock(esp32LookupLock);
+        Esp32Lookup *lookup = esp32Lookup((uintptr_t)arg);
+        if (lookup == nullptr)
+            return;
+        strcpy(hostname, lookup->hostname);
+    }
+
+    // ERR_OK: o endereço já estava no cache do lwIP
+    ip_addr_t ip;
+#if NTP_ESP32_IPV6
+    // Registro A primeiro; AAAA só se não houver A
+    err_t err = dns_gethostbyname_addrtype(hostname, &ip, dnsFound, arg,
+                                           LWIP_DNS_ADDRTYPE_IPV4_IPV6);
+#else
+    err_t err = dns_gethostbyname(hostname, &ip, dnsFound, arg);
+#endif
+    if (err == ERR_INPROGRESS)
+        return;
+
+    std::lock_guard<std::mutex> lock(esp32LookupLock);
+    Esp32Lookup *lookup = esp32Lookup((uintptr_t)arg);
+    if (lookup == nullptr)
+        return;
+    if (err == ERR_OK)
+        lookup->ip = ip;
+    lookup->state.store(err == ERR_OK ? 1 : -1, std::memory_order_release);
+}
+
+/**
+ * O DNS do lwIP mantém o TTL dos registros apenas internamente, então
+ * resolveResult() devolve 0.
+ */
+class Esp32Network : public NTPNetwork
+{
+public:
+    bool connected() override
+    {
+        return WiFi.status() == WL_CONNECTED;
+    }
+
+    int resolveStart(const char *hostname) override
+    {
+        if (strlen(hostname) >= sizeof(esp32Lookups[0].hostname))
+            return -1;
+
+        int query = -1;
+        uintptr_t tag = 0;
+        {
+            std::lock_guard<std::mutex> lock(esp32LookupLock);
+            for (int i = 0; i < NTP_MAX_DNS_QUERIES && query < 0; i++)
+            {
+                Esp32Lookup &lookup = esp32Lookups[i];
+                if (lookup.used)
+                    continue;
+
+                lookup.used = true;
+                lookup.generation++;
+                lookup.state.store(0, std::memory_order_relaxed);
+                strcpy(lookup.hostname, hostname);
+                tag = (uintptr_t)i | ((uintptr_t)lookup.generation << 8);
+                query = i;
+            }
+        }
+        if (query < 0)
+            return -1;
+
+        // Fora do lock: tcpip_callback() espera se a fila da thread tcpip
+        // estiver cheia, e a thread tcpip pode estar esperando pelo lock
+        if (tcpip_callback(dnsStart, (void *)tag) != ERR_OK)
+            esp32Lookups[query].state.store(-1, std::memory_order_release);
+        return query;
+    }
+
+    int resolveResult(int query, NTPAddress &address, uint32_t &ttlSec) override
+    {
+        if (query < 0 || query >= NTP_MAX_DNS_QUERIES)
+            return -1;
+
+        std::lock_guard<std::mutex> lock(esp32LookupLock);
+        Esp32Lookup &lookup = esp32Lookups[query];
+        if (!lookup.used)
+            return -1;
+        int state = lookup.state.load(std::memory_order_acquire);
+        if (state == 0)
+            return 0;
+
+        if (state > 0)
+        {
+            toAddress(&lookup.ip, address);
+            ttlSec = 0;
+            if (!address.isSet())
+                state = -1;
+        }
+        lookup.used = false;
+        return state;
+    }
+
+    void resolveCancel(int query) override
+    {
+        if (query < 0 || query >= NTP_MAX_DNS_QUERIES)
+            return;
+        std::lock_guard<std::mutex> lock(esp32LookupLock);
+        esp32Lookups[query].used = false;
+    }
+
+    ~Esp32Network() override
+    {
+        close();
+        unlisten();
+        if (_rxQueue != nullptr)
+            vQueueDelete(_rxQueue);
+        if (_serverQueue != nullptr)
+            vQueueDelete(_serverQueue);
+    }
+
+    /**
+     * @brief Abre o PCB UDP do cliente, de pilha dupla quando há IPv6
+     *
+     * O PCB vive na thread tcpip: criação, envio e remoção passam por
+     * tcpip_api_call(), e as respostas chegam por onReceive().
+     */
+    bool open() override
+    {
+        close();
+        if (_rxQueue == nullptr)
+            _rxQueue = xQueueCreate(NTP_ESP32_RX_QUEUE, sizeof(Rx));
+        if (_rxQueue == nullptr)
+            return false;
+        xQueueReset(_rxQueue);
+
+        PcbCall call = {};
+        call.network = this;
+        return tcpip_api_call(pcbOpen, &call.base) == ERR_OK;
+    }
+
+    void close() override
+    {
+        if (_pcb == nullptr)
+            return;
+        PcbCall call = {};
+        call.network = this;
+        tcpip_api_call(pcbClose, &call.base);
+    }
+
+    bool send(const NTPAddress &to, const uint8_t *buf, size_t len) override
+    {
+        int64_t txMonotonicUs;
+        return sendStamped(to, buf, len, txMonotonicUs);
+    }
+
+    int receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs) override
+    {
+        int64_t rxMonotonicUs;
+        return receiveStamped(buf, len, from, timeoutMs, rxMonotonicUs);
+    }
+
+    /**
+     * @brief Envia pela thread tcpip, marcando o instante logo antes de
+     *        entregar o pacote ao udp_sendto()
+     */
+    bool sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                     int64_t &txMonotonicUs) override
+    {
+        txMonotonicUs = 0;
+#if !NTP_ESP32_IPV6
+        if (to.family == NTPFamily::IPv6)
+            return false;
+#endif
+        if (_pcb == nullptr)
+            return false;
+
+        PcbCall call = {};
+        call.network = this;
+        call.to = &to;
+        call.buf = buf;
+        call.len = len;
+        if (tcpip_api_call(pcbSend, &call.base) != ERR_OK)
+            return false;
+        txMonotonicUs = call.txUs;
+        return true;
+    }
+
+    /**
+     * @brief Entrega a próxima resposta com o instante marcado no callback
+     *        do lwIP
+     *
+     * A espera é pela fila, sem polling: a tarefa acorda assim que
+     * onReceive() enfileira o datagrama, e a latência até aqui não entra
+     * no t4.
+     */
+    int receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                       int64_t &rxMonotonicUs) override
+    {
+        if (_pcb == nullptr || _rxQueue == nullptr)
+            return -1;
+
+        Rx rx;
+        if (xQueueReceive(_rxQueue, &rx, pdMS_TO_TICKS(timeoutMs)) != pdTRUE)
+            return 0;
+        size_t n = std::min<size_t>(len, rx.len);
+        memcpy(buf, rx.data, n);
+        from = rx.from;
+        rxMonotonicUs = rx.rxUs;
+        return (int)n;
+    }
+
+    /**
+     * @brief Abre o PCB UDP do modo servidor, como o do cliente
+     *
+     * Os pedidos chegam por onServerReceive() direto numa fila de
+     * NTPDatagram criada uma única vez: nenhuma alocação por pacote além
+     * do pbuf do lwIP.
+     */
+    bool listen(uint16_t &port) override
+    {
+        unlisten();
+        if (_serverQueue == nullptr)
+            _serverQueue = xQueueCreate(NTP_ESP32_SERVER_QUEUE, sizeof(NTPDatagram));
+        if (_serverQueue == nullptr)
+            return false;
+        xQueueReset(_serverQueue);
+
+        PcbCall call = {};
+        call.network = this;
+        call.server = true;
+        call.port = port;
+        if (tcpip_api_call(pcbOpen, &call.base) != ERR_OK)
+            return false;
+        port = call.port;
+        return true;
+    }
+
+    void unlisten() override
+    {
+        if (_serverPcb == nullptr)
+            return;
+        PcbCall call = {};
+        call.network = this;
+        call.server = true;
+        tcpip_api_call(pcbClose, &call.base);
+    }
+
+    /**
+     * Espera pela fila, sem polling, e copia os pedidos direto para batch.
+     */
+    int receiveBatch(NTPDatagram *batch, size_t count, uint32_t timeoutMs) override
+    {
+        if (_serverPcb == nullptr || _serverQueue == nullptr)
+            return -1;
+        if (count == 0)
+            return 0;
+
+        if (xQueueReceive(_serverQueue, &batch[0], pdMS_TO_TICKS(timeoutMs)) != pdTRUE)
+            return 0;
+        size_t n = 1;
+        while (n < count && xQueueReceive(_serverQueue, &batch[n], 0) == pdTRUE)
+        {
+            n++;
+        }
+        return (int)n;
+    }
+
+    /**
+     * O lote inteiro é enviado numa única chamada à thread tcpip.
+     */
+    int sendBatch(const NTPDatagram *batch, size_t count) override
+    {
+        if (_serverPcb == nullptr)
+            return -1;
+
+        PcbCall call = {};
+        call.network = this;
+        call.server = true;
+        call.batch = batch;
+        call.count = count;
+        if (tcpip_api_call(pcbSendBatch, &call.base) != ERR_OK)
+            return -1;
+        return call.sent;
+    }
+
+private:
+    /**
+     * @brief Resposta copiada do pbuf no callback de recepção
+     */
+    struct Rx
+    {
+        int64_t rxUs; // esp_timer_get_time() ao entrar no callback
+        NTPAddress from;
+        uint16_t len;
+        uint8_t data[NTP_DATAGRAM_LEN];
+    };
+
+    /**
+     * @brief Argumentos de tcpip_api_call(); base deve ser o primeiro membro
+     */
+    struct PcbCall
+    {
+        struct tcpip_api_call_data base;
+        Esp32Network *network;
+        bool server;   // PCB do modo servidor em vez do cliente
+        uint16_t port; // listen(): porta pedida e, na volta, a escolhida
+        const NTPAddress *to;
+        const uint8_t *buf;
+        size_t len;
+        int64_t txUs;
+        const NTPDatagram *batch; // sendBatch()
+        size_t count;
+        int sent;
+    };
+
+    struct udp_pcb *_pcb = nullptr; // Só alterado na thread tcpip
+    QueueHandle_t _rxQueue = nullptr;
+    struct udp_pcb *_serverPcb = nullptr; // Só alterado na thread tcpip
+    QueueHandle_t _serverQueue = nullptr;
+
+    static err_t pcbOpen(struct tcpip_api_call_data *arg)
+    {
+        PcbCall *call = reinterpret_cast<PcbCall *>(arg);
+        Esp32Network *self = call->network;
+#if NTP_ESP32_IPV6
+        struct udp_pcb *pcb = udp_new_ip_type(IPADDR_TYPE_ANY);
+        const ip_addr_t *any = IP_ANY_TYPE;
+#else
+        struct udp_pcb *pcb = udp_new();
+        const ip_addr_t *any = IP_ADDR_ANY;
+#endif
+        if (pcb == nullptr)
+            return ERR_MEM;
+        err_t err = udp_bind(pcb, any, call->port);
+        if (err != ERR_OK)
+        {
+            udp_remove(pcb);
+            return err;
+        }
+        if (call->server)
+        {
+            udp_recv(pcb, onServerReceive, self);
+            self->_serverPcb = pcb;
+            call->port = pcb->local_port;
+        }
+        else
+        {
+            udp_recv(pcb, onReceive, self);
+            self->_pcb = pcb;
+        }
+        return ERR_OK;
+    }
+
+    static err_t pcbClose(struct tcpip_api_call_data *arg)
+    {
+        PcbCall *call = reinterpret_cast<PcbCall *>(arg);
+        struct udp_pcb *&pcb = call->server ? call->network->_serverPcb : call->network->_pcb;
+        if (pcb != nullptr)
+        {
+            udp_remove(pcb);
+            pcb = nullptr;
+        }
+        return ERR_OK;
+    }
+
+    static err_t pcbSend(struct tcpip_api_call_data *arg)
+    {
+        PcbCall *call = reinterpret_cast<PcbCall *>(arg);
+        if (call->network->_pcb == nullptr)
+            return ERR_CONN;
+        struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, (u16_t)call->len, PBUF_RAM);
+        if (p == nullptr)
+            return ERR_MEM;
+        memcpy(p->payload, call->buf, call->len);
+
+        ip_addr_t ip;
+        toIp(*call->to, ip);
+        call->txUs = esp_timer_get_time();
+        err_t err = udp_sendto(call->network->_pcb, p, &ip, call->to->port);
+        pbuf_free(p);
+        return err;
+    }
+
+    static err_t pcbSendBatch(struct tcpip_api_call_data *arg)
+    {
+        PcbCall *call = reinterpret_cast<PcbCall *>(arg);
+        struct udp_pcb *pcb = call->network->_serverPcb;
+        if (pcb == nullptr)
+            return ERR_CONN;
+
+        for (size_t i = 0; i < call->count; i++)
+        {
+            const NTPDatagram &datagram = call->batch[i];
+#if !NTP_ESP32_IPV6
+            if (datagram.peer.family == NTPFamily::IPv6)
+                continue;
+#endif
+            struct pbuf *p = pbuf_alloc(PBUF_TRANSPORT, datagram.len, PBUF_RAM);
+            if (p == nullptr)
+                continue;
+            memcpy(p->payload, datagram.data, datagram.len);
+
+            ip_addr_t ip;
+            toIp(datagram.peer, ip);
+            if (udp_sendto(pcb, p, &ip, datagram.peer.port) == ERR_OK)
+                call->sent++;
+            pbuf_free(p);
+        }
+        return ERR_OK;
+    }
+
+    /**
+     * @brief Callback de recepção do lwIP, na thread tcpip
+     *
+     * É o primeiro código da biblioteca a ver o datagrama, logo após o
+     * driver do WiFi entregá-lo à pilha; o instante é lido antes de
+     * qualquer cópia. Com a fila cheia o datagrama é descartado, como num
+     * socket com o buffer cheio.
+     */
+    static void onReceive(void *arg, struct udp_pcb *pcb, struct pbuf *p, const ip_addr_t *addr,
+                          u16_t port)
+    {
+        int64_t rxUs = esp_timer_get_time();
+        (void)pcb;
+        Esp32Network *self = static_cast<Esp32Network *>(arg);
+
+        Rx rx;
+        rx.rxUs = rxUs;
+        rx.len = pbuf_copy_partial(p, rx.data, sizeof(rx.data), 0);
+        toAddress(addr, rx.from);
+        rx.from.port = port;
+        pbuf_free(p);
+        xQueueSend(self->_rxQueue, &rx, 0);
+    }
+
+    /**
+     * @brief Callback de recepção do PCB do modo servidor, na thread tcpip
+     *
+     * Com a fila cheia o pedido é descartado; o cliente tenta de novo.
+     */
+    static void onServerReceive(void *arg, struct udp_pcb *pcb, struct pbuf *p,
+                                const ip_addr_t *addr, u16_t port)
+    {
+        (void)pcb;
+        Esp32Network *self = static_cast<Esp32Network *>(arg);
+
+        NTPDatagram datagram;
+        datagram.len = pbuf_copy_partial(p, datagram.data, sizeof(datagram.data), 0);
+        toAddress(addr, datagram.peer);
+        datagram.peer.port = port;
+        pbuf_free(p);
+        xQueueSend(self->_serverQueue, &datagram, 0);
+    }
+};
+
+// ----------------------------------------------------
+//
+//               Relógio (esp_timer + newlib + timer RTC)
+//
+// ----------------------------------------------------
+
+// RC interno de 150 kHz calibrado pelo cristal; com cristal externo de
+// 32 kHz no domínio RTC, 50 ppm é suficiente
+constexpr uint32_t NTP_ESP32_RTC_TOLERANCE_PPM = 500;
+
+class Esp32Clock : public NTPClock
+{
+public:
+    uint32_t millis() override
+    {
+        return ::millis();
+    }
+
+    int64_t monotonicUs() override
+    {
+        return esp_timer_get_time();
+    }
+
+    void now(struct timeval &tv) override
+    {
+        gettimeofday(&tv, nullptr);
+    }
+
+    void step(int64_t offsetUs) override
+    {
+        struct timeval tv;
+        gettimeofday(&tv, nullptr);
+        int64_t us = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec + offsetUs;
+        tv.tv_sec = (time_t)(us / 1000000LL);
+        tv.tv_usec = (suseconds_t)(us % 1000000LL);
+        settimeofday(&tv, nullptr);
+    }
+
+    /**
+     * adjtime() substitui o ajuste pendente, então o restante ainda não
+     * aplicado é somado à nova correção.
+     */
+    void slew(int64_t offsetUs) override
+    {
+        struct timeval pending = {0, 0};
+        adjtime(nullptr, &pending);
+
+        int64_t us = (int64_t)pending.tv_sec * 1000000LL + pending.tv_usec + offsetUs;
+        struct timeval delta;
+        delta.tv_sec = (time_t)(us / 1000000LL);
+        delta.tv_usec = (suseconds_t)(us % 1000000LL);
+        adjtime(&delta, nullptr);
+    }
+
+    int64_t pendingSlewUs() override
+    {
+        struct timeval pending = {0, 0};
+        adjtime(nullptr, &pending);
+        return (int64_t)pending.tv_sec * 1000000LL + pending.tv_usec;
+    }
+
+    void sleepMs(uint32_t ms) override
+    {
+        vTaskDelay(pdMS_TO_TICKS(ms));
+    }
+
+    /**
+     * O timer RTC continua em deep sleep e resets por software; só é
+     * zerado quando o chip perde a alimentação.
+     */
+    bool rtcUs(int64_t &us) override
+    {
+        esp_reset_reason_t reason = esp_reset_reason();
+        if (reason == ESP_RST_POWERON || reason == ESP_RST_BROWNOUT)
+            return false;
+        us = (int64_t)esp_clk_rtc_time();
+        return true;
+    }
+
+    uint32_t rtcTolerancePpm() override
+    {
+        return NTP_ESP32_RTC_TOLERANCE_PPM;
+    }
+
+    // Gerador por hardware, com entropia do rádio quando o WiFi está ativo
+    uint32_t random() override
+    {
+        return esp_random();
+    }
+};
+
+// ----------------------------------------------------
+//
+//               Armazenamento (Preferences)
+//
+// ----------------------------------------------------
+
+class Esp32Storage : public NTPStorage
+{
+public:
+    bool begin(const char *name, bool readOnly) override
+    {
+        return _prefs.begin(name, readOnly);
+    }
+
+    void end() override
+    {
+        _prefs.end();
+    }
+
+    bool isKey(const char *key) override
+    {
+        return _prefs.isKey(key);
+    }
+
+    uint32_t getU32(const char *key, uint32_t defaultValue) override
+    {
+        return _prefs.getULong(key, defaultValue);
+    }
+
+    void putU32(const char *key, uint32_t value) override
+    {
+        _prefs.putULong(key, value);
+    }
+
+    int32_t getI32(const char *key, int32_t defaultValue) override
+    {
+        return _prefs.getInt(key, defaultValue);
+    }
+
+    void putI32(const char *key, int32_t value) override
+    {
+        _prefs.putInt(key, value);
+    }
+
+    float getFloat(const char *key, float defaultValue) override
+    {
+        return _prefs.getFloat(key, defaultValue);
+    }
+
+    void putFloat(const char *key, float value) override
+    {
+        _prefs.putFloat(key, value);
+    }
+
+    size_t getBytes(const char *key, void *value, size_t len) override
+    {
+        return _prefs.getBytes(key, value, len);
+    }
+
+    size_t putBytes(const char *key, const void *value, size_t len) override
+    {
+        return _prefs.putBytes(key, value, len);
+    }
+
+private:
+    Preferences _prefs;
+};
+
+// ----------------------------------------------------
+//
+//               Tarefas (FreeRTOS)
+//
+// ----------------------------------------------------
+
+struct Esp32Spawned
+{
+    void (*task)(void *);
+    void *arg;
+};
+
+/**
+ * @brief Corpo das tarefas de spawn(): apaga a tarefa quando task retorna
+ *
+ * Uma tarefa do FreeRTOS nunca pode retornar (o ESP-IDF aborta), mas as
+ * tarefas auxiliares, como a do modo servidor, terminam ao serem paradas.
+ */
+static void esp32SpawnedTask(void *arg)
+{
+    Esp32Spawned spawned = *static_cast<Esp32Spawned *>(arg);
+    delete static_cast<Esp32Spawned *>(arg);
+    spawned.task(spawned.arg);
+    vTaskDelete(nullptr);
+}
+
+class Esp32Tasking : public NTPTasking
+{
+public:
+    bool start(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+               uint8_t priority) override
+    {
+        return xTaskCreatePinnedToCore(task, name, stackSize, arg, priority, &_task, 0) == pdPASS;
+    }
+
+    bool spawn(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+               uint8_t priority) override
+    {
+        Esp32Spawned *spawned = new (std::nothrow) Esp32Spawned{task, arg};
+        if (spawned == nullptr)
+            return false;
+        if (xTaskCreatePinnedToCore(esp32SpawnedTask, name, stackSize, spawned, priority, nullptr,
+                                    0) != pdPASS)
+        {
+            delete spawned;
+            return false;
+        }
+        return true;
+    }
+
+    void wait(uint32_t timeoutMs) override
+    {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(timeoutMs));
+    }
+
+    void notify() override
+    {
+        if (_task != nullptr)
+            xTaskNotifyGive(_task);
+    }
+
+    // No ESP-IDF o valor já vem em bytes, não em palavras
+    uint32_t stackHighWater() override
+    {
+        return _task != nullptr ? (uint32_t)uxTaskGetStackHighWaterMark(_task) : 0;
+    }
+
+private:
+    TaskHandle_t _task = nullptr;
+};
+
+NTPPlatform ntpDefaultPlatform()
+{
+    static Esp32Network network;
+    static Esp32Clock clock;
+    static Esp32Storage storage;
+    static Esp32Tasking tasking;
+    return {&network, &clock, &storage, &tasking};
+}
+
+NTPNetwork *ntpCreateNetwork()
+{
+    return new Esp32Network();
+}
+
+#endif // ARDUINO
@@ -0,0 +1,201 @@
+#include "NTPHal.h"
+#include <algorithm>
+#include <cctype>
+#include <cstdio>
+
+/**
+ * @brief Converte um IPv6 em texto ("2001:db8::1"), com compressão "::"
+ */
+static bool parseIpv6(const char *text, uint8_t ip[16])
+{
+    uint16_t head[8], tail[8];
+    uint8_t headCount = 0, tailCount = 0;
+    bool gap = false;
+    const char *p = text;
+
+    if (p[0] == ':')
+    {
+        if (p[1] != ':')
+            return false;
+        gap = true;
+        p += 2;
+    }
+    while (*p != '\0')
+    {
+        unsigned value = 0;
+        uint8_t digits = 0;
+        while (isxdigit((unsigned char)*p) && digits < 4)
+        {
+            value = value * 16 + (isdigit((unsigned char)*p) ? *p - '0' : (tolower((unsigned char)*p) - 'a' + 10));
+            digits++;
+            p++;
+        }
+        if (digits == 0 || headCount + tailCount >= 8)
+            return false;
+        if (gap)
+            tail[tailCount++] = (uint16_t)value;
+        else
+            head[headCount++] = (uint16_t)value;
+
+        if (*p == '\0')
+            break;
+        if (*p++ != ':')
+            return false;
+        if (*p == ':')
+        {
+            if (gap)
+                return false;
+            gap = true;
+            p++;
+        }
+        else if (*p == '\0')
+        {
+            return false;
+        }
+    }
+    if (gap ? headCount + tailCount > 7 : headCount != 8)
+        return false;
+
+    memset(ip, 0, 16);
+    for (uint8_t i = 0; i < headCount; i++)
+    {
+        ip[2 * i] = (uint8_t)(head[i] >> 8);
+        ip[2 * i + 1] = (uint8_t)head[i];
+    }
+    for (uint8_t i = 0; i < tailCount; i++)
+    {
+        uint8_t group = (uint8_t)(8 - tailCount + i);
+        ip[2 * group] = (uint8_t)(tail[i] >> 8);
+        ip[2 * group + 1] = (uint8_t)tail[i];
+    }
+    return true;
+}
+
+/**
+ * @brief Converte "a.b.c.d" ou um IPv6 para NTPAddress, sem alterar a porta
+ *
+ * @return false se o texto não for um IP numérico.
+ */
+bool ntpParseAddress(const char *text, NTPAddress &address)
+{
+    unsigned a, b, c, d;
+    char tail;
+    if (sscanf(text, "%u.%u.%u.%u%c", &a, &b, &c, &d, &tail) == 4)
+    {
+        if (a > 255 || b > 255 || c > 255 || d > 255)
+            return false;
+
+        address.family = NTPFamily::IPv4;
+        memset(address.ip, 0, sizeof(address.ip));
+        address.ip[0] = (uint8_t)a;
+        address.ip[1] = (uint8_t)b;
+        address.ip[2] = (uint8_t)c;
+        address.ip[3] = (uint8_t)d;
+        return true;
+    }
+
+    uint8_t ip[16];
+    if (strchr(text, ':') == nullptr || !parseIpv6(text, ip))
+        return false;
+    address.family = NTPFamily::IPv6;
+    memcpy(address.ip, ip, sizeof(ip));
+    return true;
+}
+
+/**
+ * @brief Formata como "a.b.c.d:porta" ou "[x:x:x:x:x:x:x:x]:porta"
+ *
+ * @param len Pelo menos NTP_ADDRESS_TEXT_LEN para qualquer endereço.
+ */
+void ntpFormatAddress(const NTPAddress &address, char *buf, size_t len)
+{
+    if (address.family != NTPFamily::IPv6)
+    {
+        snprintf(buf, len, "%u.%u.%u.%u:%u", address.ip[0], address.ip[1], address.ip[2],
+                 address.ip[3], address.port);
+        return;
+    }
+
+    uint16_t g[8];
+    for (uint8_t i = 0; i < 8; i++)
+    {
+        g[i] = (uint16_t)(address.ip[2 * i] << 8 | address.ip[2 * i + 1]);
+    }
+    snprintf(buf, len, "[%x:%x:%x:%x:%x:%x:%x:%x]:%u", g[0], g[1], g[2], g[3], g[4], g[5], g[6],
+             g[7], address.port);
+}
+
+// ----------------------------------------------------
+//
+//               NTPSoftClock
+//
+// ----------------------------------------------------
+
+NTPSoftClock::NTPSoftClock(NTPClock *base)
+    : _base(base), _offsetUs(0), _pendingUs(0), _settledAtUs(base->monotonicUs())
+{
+}
+
+void NTPSoftClock::now(struct timeval &tv)
+{
+    _base->now(tv);
+    int64_t us = (int64_t)tv.tv_sec * 1000000LL + tv.tv_usec + correctionUs();
+    tv.tv_sec = (time_t)(us / 1000000LL);
+    tv.tv_usec = (suseconds_t)(us % 1000000LL);
+}
+
+void NTPSoftClock::step(int64_t offsetUs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(_base->monotonicUs());
+    _offsetUs += offsetUs;
+}
+
+void NTPSoftClock::slew(int64_t offsetUs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(_base->monotonicUs());
+    _pendingUs += offsetUs;
+}
+
+int64_t NTPSoftClock::pendingSlewUs()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(_base->monotonicUs());
+    return _pendingUs;
+}
+
+/**
+ * @brief Correção total já aplicada sobre o relógio base
+ */
+int64_t NTPSoftClock::correctionUs()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(_base->monotonicUs());
+    return _offsetUs;
+}
+
+/**
+ * @brief Move para o offset a parte do slew correspondente ao tempo
+ *        decorrido desde a última chamada
+ *
+ * Só consome o tempo equivalente aos microssegundos aplicados, para que
+ * leituras frequentes não descartem a fração de microssegundo de cada
+ * intervalo.
+ */
+void NTPSoftClock::settle(int64_t monotonicUs)
+{
+    int64_t elapsed = monotonicUs - _settledAtUs;
+    if (_pendingUs == 0)
+        _settledAtUs = monotonicUs;
+    if (_pendingUs == 0 || elapsed <= 0)
+        return;
+
+    int64_t budget = elapsed * NTP_SOFT_SLEW_RATE_PPM / 1000000;
+    if (budget == 0)
+        return;
+    _settledAtUs += budget * 1000000 / NTP_SOFT_SLEW_RATE_PPM;
+    int64_t applied = _pendingUs > 0 ? std::min(_pendingUs, budget) : std::max(_pendingUs, -budget);
+    _offsetUs += applied;
+    _pendingUs -= applied;
+}
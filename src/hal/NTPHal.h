@@ -0,0 +1,381 @@
+#ifndef NTP_HAL_H
+#define NTP_HAL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <sys/time.h>
+
+constexpr uint8_t NTP_MAX_DNS_QUERIES = 8; // Consultas DNS simultâneas por backend
+constexpr size_t NTP_ADDRESS_TEXT_LEN = 48; // "[IPv6]:porta" formatado, com o '\0'
+constexpr size_t NTP_DATAGRAM_LEN = 68;     // Cabeçalho NTP + key id + MD5 (RFC 5905 §7.3)
+constexpr uint8_t NTP_SERVER_BATCH = 16;    // Datagramas por chamada no modo servidor
+constexpr uint32_t NTP_SOFT_SLEW_RATE_PPM = 500; // Taxa de slew de NTPSoftClock
+
+enum class NTPFamily : uint8_t
+{
+    None,
+    IPv4,
+    IPv6
+};
+
+/**
+ * @brief Endereço IPv4 ou IPv6 e porta UDP de um servidor NTP
+ *
+ * Binário e de tamanho fixo; um IPv4 ocupa os 4 primeiros bytes de ip.
+ */
+struct NTPAddress
+{
+    NTPFamily family;
+    uint8_t ip[16];
+    uint16_t port;
+
+    size_t length() const { return family == NTPFamily::IPv6 ? 16 : 4; }
+    bool isSet() const
+    {
+        uint8_t any = 0;
+        for (size_t i = 0; i < length(); i++)
+        {
+            any |= ip[i];
+        }
+        return family != NTPFamily::None && any != 0;
+    }
+    bool operator==(const NTPAddress &other) const
+    {
+        return family == other.family && port == other.port && memcmp(ip, other.ip, length()) == 0;
+    }
+    bool operator!=(const NTPAddress &other) const { return !(*this == other); }
+};
+
+/**
+ * @brief Datagrama recebido ou enviado pelo modo servidor
+ *
+ * Tamanho fixo, para que os lotes fiquem em buffers pré-alocados.
+ * Pedidos maiores que NTP_DATAGRAM_LEN chegam truncados.
+ */
+struct NTPDatagram
+{
+    NTPAddress peer;
+    uint16_t len;
+    uint8_t data[NTP_DATAGRAM_LEN];
+};
+
+/**
+ * @brief Rede: estado do link, DNS assíncrono e um socket UDP
+ *
+ * O modo servidor usa um segundo socket, independente do cliente. Os
+ * métodos listen()...sendBatch() têm implementação padrão que não
+ * suporta o modo servidor.
+ */
+class NTPNetwork
+{
+public:
+    virtual ~NTPNetwork() = default;
+
+    virtual bool connected() = 0;
+
+    /**
+     * @brief Inicia a resolução de hostname sem bloquear
+     *
+     * @return Identificador da consulta, ou -1 se as NTP_MAX_DNS_QUERIES
+     *         consultas já estiverem em uso.
+     */
+    virtual int resolveStart(const char *hostname) = 0;
+
+    /**
+     * @brief Resultado de uma consulta iniciada por resolveStart()
+     *
+     * Só address.family e address.ip são alterados; com registros IPv4
+     * e IPv6, o IPv4 tem preferência. A consulta é liberada quando termina.
+     *
+     * @param ttlSec Recebe o TTL do registro, ou 0 se o backend não o conhecer.
+     *
+     * @return 1 se resolvido, 0 se em andamento, -1 em falha.
+     */
+    virtual int resolveResult(int query, NTPAddress &address, uint32_t &ttlSec) = 0;
+
+    /**
+     * @brief Abandona uma consulta em andamento e libera o identificador
+     */
+    virtual void resolveCancel(int query) = 0;
+
+    virtual bool open() = 0;
+    virtual void close() = 0;
+    virtual bool send(const NTPAddress &to, const uint8_t *buf, size_t len) = 0;
+
+    /**
+     * @brief Espera um datagrama por no máximo timeoutMs
+     *
+     * @return Bytes recebidos, 0 se o timeout expirar, -1 em erro.
+     */
+    virtual int receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs) = 0;
+
+    /**
+     * @brief Como send(), informando o instante da transmissão
+     *
+     * @param txMonotonicUs Recebe NTPClock::monotonicUs() lido o mais perto
+     *                      possível da saída do pacote, ou 0 se o backend
+     *                      não souber; quem chama usa então o instante atual.
+     */
+    virtual bool sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                             int64_t &txMonotonicUs)
+    {
+        txMonotonicUs = 0;
+        return send(to, buf, len);
+    }
+
+    /**
+     * @brief Como receive(), informando o instante da chegada
+     *
+     * @param rxMonotonicUs Recebe NTPClock::monotonicUs() da chegada do
+     *                      datagrama, obtido o mais perto possível da
+     *                      interface (timestamp do kernel, callback do
+     *                      lwIP), ou 0 se o backend não souber.
+     */
+    virtual int receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                               int64_t &rxMonotonicUs)
+    {
+        rxMonotonicUs = 0;
+        return receive(buf, len, from, timeoutMs);
+    }
+
+    /**
+     * @brief Abre o socket do modo servidor, IPv4 e IPv6 quando possível
+     *
+     * @param port Porta local; 0 escolhe uma livre, devolvida em port.
+     */
+    virtual bool listen(uint16_t &port)
+    {
+        (void)port;
+        return false;
+    }
+
+    virtual void unlisten() {}
+
+    /**
+     * @brief Espera por no máximo timeoutMs e lê até count datagramas
+     *
+     * Lê tudo o que já estiver na fila, sem esperar de novo após o
+     * primeiro datagrama.
+     *
+     * @return Datagramas lidos, 0 se o timeout expirar, -1 em erro.
+     */
+    virtual int receiveBatch(NTPDatagram *batch, size_t count, uint32_t timeoutMs)
+    {
+        (void)batch;
+        (void)count;
+        (void)timeoutMs;
+        return -1;
+    }
+
+    /**
+     * @brief Envia cada datagrama para o seu peer
+     *
+     * @return Datagramas enviados, -1 em erro.
+     */
+    virtual int sendBatch(const NTPDatagram *batch, size_t count)
+    {
+        (void)batch;
+        (void)count;
+        return -1;
+    }
+};
+
+/**
+ * @brief Relógios: monotônico para intervalos e UTC do sistema
+ */
+class NTPClock
+{
+public:
+    virtual ~NTPClock() = default;
+
+    virtual uint32_t millis() = 0;
+    virtual int64_t monotonicUs() = 0;
+    virtual void now(struct timeval &tv) = 0;
+    virtual void step(int64_t offsetUs) = 0;
+
+    /**
+     * @brief Soma offsetUs ao ajuste gradual ainda pendente
+     */
+    virtual void slew(int64_t offsetUs) = 0;
+
+    /**
+     * @brief Parte dos slews que ainda não chegou ao horário de now()
+     */
+    virtual int64_t pendingSlewUs() = 0;
+    virtual void sleepMs(uint32_t ms) = 0;
+
+    /**
+     * @brief Relógio do domínio RTC, que continua contando em resets e
+     *        deep sleep
+     *
+     * @param us Microssegundos desde uma origem que só muda quando o
+     *           domínio RTC é zerado.
+     *
+     * @return false se a plataforma não tiver esse relógio ou se ele foi
+     *         zerado neste boot.
+     */
+    virtual bool rtcUs(int64_t &us) = 0;
+
+    /**
+     * @brief Tolerância de frequência de rtcUs(), em ppm, além da deriva
+     *        estimada pela disciplina
+     */
+    virtual uint32_t rtcTolerancePpm() = 0;
+
+    /**
+     * @brief Número aleatório de 32 bits
+     *
+     * Usado para espalhar as sincronizações no tempo; deve diferir entre
+     * dispositivos que reiniciam juntos.
+     */
+    virtual uint32_t random() = 0;
+};
+
+/**
+ * @brief Armazenamento chave/valor persistente, no modelo do Preferences
+ */
+class NTPStorage
+{
+public:
+    virtual ~NTPStorage() = default;
+
+    virtual bool begin(const char *name, bool readOnly) = 0;
+    virtual void end() = 0;
+    virtual bool isKey(const char *key) = 0;
+
+    virtual uint32_t getU32(const char *key, uint32_t defaultValue) = 0;
+    virtual void putU32(const char *key, uint32_t value) = 0;
+    virtual int32_t getI32(const char *key, int32_t defaultValue) = 0;
+    virtual void putI32(const char *key, int32_t value) = 0;
+    virtual float getFloat(const char *key, float defaultValue) = 0;
+    virtual void putFloat(const char *key, float value) = 0;
+
+    /**
+     * @return Bytes lidos; 0 se a chave não existir ou não couber em len.
+     */
+    virtual size_t getBytes(const char *key, void *value, size_t len) = 0;
+
+    /**
+     * @return Bytes gravados; 0 em falha.
+     */
+    virtual size_t putBytes(const char *key, const void *value, size_t len) = 0;
+};
+
+/**
+ * @brief Criação de tarefas em segundo plano
+ */
+class NTPTasking
+{
+public:
+    virtual ~NTPTasking() = default;
+
+    virtual bool start(void (*task)(void *), const char *name, uint32_t stackSize,
+                       void *arg, uint8_t priority) = 0;
+
+    /**
+     * @brief Bloqueia a tarefa criada por start() até notify() ou timeoutMs
+     *
+     * Uma notificação feita antes da espera não é perdida.
+     */
+    virtual void wait(uint32_t timeoutMs) = 0;
+
+    /**
+     * @brief Acorda a tarefa em wait(); pode ser chamada de qualquer tarefa
+     */
+    virtual void notify() = 0;
+
+    /**
+     * @brief Cria uma tarefa auxiliar, sem relação com wait()/notify()
+     *
+     * task pode retornar: a plataforma encerra a tarefa em seguida.
+     *
+     * @return false se a plataforma não suportar; quem chama conduz o
+     *         trabalho por conta própria.
+     */
+    virtual bool spawn(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+                       uint8_t priority)
+    {
+        (void)task;
+        (void)name;
+        (void)stackSize;
+        (void)arg;
+        (void)priority;
+        return false;
+    }
+
+    /**
+     * @brief Menor folga já registrada na pilha da tarefa, em bytes
+     *
+     * @return 0 se a plataforma não medir a pilha.
+     */
+    virtual uint32_t stackHighWater() { return 0; }
+};
+
+/**
+ * @brief Conjunto de backends usado por NTPSync
+ */
+struct NTPPlatform
+{
+    NTPNetwork *network;
+    NTPClock *clock;
+    NTPStorage *storage;
+    NTPTasking *tasking;
+};
+
+/**
+ * @brief Backends nativos da plataforma de compilação
+ *
+ * ESP32 (Arduino) quando ARDUINO estiver definido, POSIX caso contrário.
+ */
+NTPPlatform ntpDefaultPlatform();
+
+/**
+ * @brief Cria um backend de rede nativo adicional, com sockets próprios
+ *
+ * Cada NTPSyncClock precisa do seu: o socket do cliente não pode ser
+ * compartilhado. Aloca no heap; chame apenas na configuração.
+ */
+NTPNetwork *ntpCreateNetwork();
+
+/**
+ * @brief Relógio de software sobre outro NTPClock
+ *
+ * now() é o horário do relógio base somado a uma correção própria;
+ * step() e slew() alteram só essa correção. Permite que um domínio de
+ * tempo secundário seja disciplinado sem mexer no relógio do sistema.
+ * O slew é aplicado a NTP_SOFT_SLEW_RATE_PPM sobre monotonicUs().
+ */
+class NTPSoftClock : public NTPClock
+{
+public:
+    explicit NTPSoftClock(NTPClock *base);
+
+    uint32_t millis() override { return _base->millis(); }
+    int64_t monotonicUs() override { return _base->monotonicUs(); }
+    void now(struct timeval &tv) override;
+    void step(int64_t offsetUs) override;
+    void slew(int64_t offsetUs) override;
+    int64_t pendingSlewUs() override;
+    void sleepMs(uint32_t ms) override { _base->sleepMs(ms); }
+    bool rtcUs(int64_t &us) override { return _base->rtcUs(us); }
+    uint32_t rtcTolerancePpm() override { return _base->rtcTolerancePpm(); }
+    uint32_t random() override { return _base->random(); }
+
+    int64_t correctionUs();
+
+private:
+    NTPClock *_base;
+    std::mutex _lock;
+    int64_t _offsetUs;
+    int64_t _pendingUs;
+    int64_t _settledAtUs;
+
+    void settle(int64_t monotonicUs);
+};
+
+bool ntpParseAddress(const char *text, NTPAddress &address);
+void ntpFormatAddress(const NTPAddress &address, char *buf, size_t len);
+
+#endif // NTP_HAL_H
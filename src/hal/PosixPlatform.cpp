@@ -0,0 +1,746 @@
+#if !defined(ARDUINO)
+
+#include "PosixPlatform.h"
+#include <algorithm>
+#include <arpa/inet.h>
+#include <cerrno>
+#include <cstring>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+
+static int64_t clockUs(clockid_t id)
+{
+    struct timespec ts;
+    clock_gettime(id, &ts);
+    return (int64_t)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000;
+}
+
+/**
+ * @brief Pede ao kernel o instante de chegada de cada datagrama
+ */
+static void enableRxTimestamps(int fd)
+{
+#ifdef SO_TIMESTAMPNS
+    int on = 1;
+    setsockopt(fd, SOL_SOCKET, SO_TIMESTAMPNS, &on, sizeof(on));
+#else
+    (void)fd;
+#endif
+}
+
+// ----------------------------------------------------
+//
+//               PosixNetwork
+//
+// ----------------------------------------------------
+
+/**
+ * @brief Converte para sockaddr; num socket de pilha dupla, IPv4 vira
+ *        ::ffff:a.b.c.d
+ *
+ * @return Tamanho do endereço, ou 0 se a família não servir ao socket.
+ */
+static socklen_t toSockaddr(const NTPAddress &address, bool v6Socket, struct sockaddr_storage &out)
+{
+    memset(&out, 0, sizeof(out));
+    if (v6Socket)
+    {
+        struct sockaddr_in6 *sin6 = (struct sockaddr_in6 *)&out;
+        sin6->sin6_family = AF_INET6;
+        sin6->sin6_port = htons(address.port);
+        if (address.family == NTPFamily::IPv6)
+        {
+            memcpy(&sin6->sin6_addr, address.ip, 16);
+        }
+        else
+        {
+            sin6->sin6_addr.s6_addr[10] = 0xFF;
+            sin6->sin6_addr.s6_addr[11] = 0xFF;
+            memcpy(&sin6->sin6_addr.s6_addr[12], address.ip, 4);
+        }
+        return sizeof(struct sockaddr_in6);
+    }
+
+    if (address.family == NTPFamily::IPv6)
+        return 0;
+    struct sockaddr_in *sin = (struct sockaddr_in *)&out;
+    sin->sin_family = AF_INET;
+    sin->sin_port = htons(address.port);
+    memcpy(&sin->sin_addr.s_addr, address.ip, 4);
+    return sizeof(struct sockaddr_in);
+}
+
+/**
+ * @brief Converte de sockaddr; ::ffff:a.b.c.d vira IPv4
+ */
+static void fromSockaddr(const struct sockaddr_storage &in, NTPAddress &address)
+{
+    memset(address.ip, 0, sizeof(address.ip));
+    if (in.ss_family == AF_INET6)
+    {
+        const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)&in;
+        address.port = ntohs(sin6->sin6_port);
+        if (IN6_IS_ADDR_V4MAPPED(&sin6->sin6_addr))
+        {
+            address.family = NTPFamily::IPv4;
+            memcpy(address.ip, &sin6->sin6_addr.s6_addr[12], 4);
+        }
+        else
+        {
+            address.family = NTPFamily::IPv6;
+            memcpy(address.ip, &sin6->sin6_addr, 16);
+        }
+        return;
+    }
+
+    const struct sockaddr_in *sin = (const struct sockaddr_in *)&in;
+    address.family = NTPFamily::IPv4;
+    address.port = ntohs(sin->sin_port);
+    memcpy(address.ip, &sin->sin_addr.s_addr, 4);
+}
+
+PosixNetwork::PosixNetwork() : _fd(-1), _fd6(-1), _serverFd(-1), _serverV6(false)
+{
+}
+
+PosixNetwork::~PosixNetwork()
+{
+    close();
+    unlisten();
+}
+
+bool PosixNetwork::connected()
+{
+    return true;
+}
+
+int PosixNetwork::resolveStart(const char *hostname)
+{
+    for (int i = 0; i < NTP_MAX_DNS_QUERIES; i++)
+    {
+        if (_lookups[i])
+            continue;
+
+        std::shared_ptr<Lookup> lookup = std::make_shared<Lookup>();
+        _lookups[i] = lookup;
+        std::thread([lookup, host = std::string(hostname)]
+                    {
+                        struct addrinfo hints = {};
+                        hints.ai_family = AF_UNSPEC;
+                        hints.ai_socktype = SOCK_DGRAM;
+                        hints.ai_flags = AI_ADDRCONFIG;
+
+                        struct addrinfo *result = nullptr;
+                        int state = -1;
+                        if (getaddrinfo(host.c_str(), nullptr, &hints, &result) == 0)
+                        {
+                            // IPv4 primeiro; IPv6 só se não houver registro A
+                            for (const struct addrinfo *ai = result; ai != nullptr; ai = ai->ai_next)
+                            {
+                                if (ai->ai_family == AF_INET)
+                                {
+                                    const struct sockaddr_in *sin = (const struct sockaddr_in *)ai->ai_addr;
+                                    lookup->family = NTPFamily::IPv4;
+                                    memcpy(lookup->ip, &sin->sin_addr.s_addr, 4);
+                                    state = 1;
+                                    break;
+                                }
+                                if (ai->ai_family == AF_INET6 && state < 0)
+                                {
+                                    const struct sockaddr_in6 *sin6 = (const struct sockaddr_in6 *)ai->ai_addr;
+                                    lookup->family = NTPFamily::IPv6;
+                                    memcpy(lookup->ip, &sin6->sin6_addr, 16);
+                                    state = 1;
+                                }
+                            }
+                        }
+                        if (result != nullptr)
+                            freeaddrinfo(result);
+                        lookup->state.store(state, std::memory_order_release);
+                    })
+            .detach();
+        return i;
+    }
+    return -1;
+}
+
+int PosixNetwork::resolveResult(int query, NTPAddress &address, uint32_t &ttlSec)
+{
+    if (query < 0 || query >= NTP_MAX_DNS_QUERIES || !_lookups[query])
+        return -1;
+
+    int state = _lookups[query]->state.load(std::memory_order_acquire);
+    if (state == 0)
+        return 0;
+
+    if (state > 0)
+    {
+        address.family = _lookups[query]->family;
+        memcpy(address.ip, _lookups[query]->ip, 16);
+        ttlSec = 0;
+        if (!address.isSet())
+            state = -1;
+    }
+    _lookups[query].reset();
+    return state;
+}
+
+void PosixNetwork::resolveCancel(int query)
+{
+    if (query >= 0 && query < NTP_MAX_DNS_QUERIES)
+        _lookups[query].reset();
+}
+
+/**
+ * @brief Abre um socket IPv4 e, se o host permitir, um IPv6
+ */
+bool PosixNetwork::open()
+{
+    close();
+    _fd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (_fd < 0)
+        return false;
+    enableRxTimestamps(_fd);
+
+    struct sockaddr_in local = {};
+    local.sin_family = AF_INET;
+    local.sin_addr.s_addr = htonl(INADDR_ANY);
+    local.sin_port = 0;
+    if (bind(_fd, (struct sockaddr *)&local, sizeof(local)) != 0)
+    {
+        close();
+        return false;
+    }
+
+    _fd6 = socket(AF_INET6, SOCK_DGRAM, 0);
+    if (_fd6 >= 0)
+    {
+        int only = 1;
+        setsockopt(_fd6, IPPROTO_IPV6, IPV6_V6ONLY, &only, sizeof(only));
+        struct sockaddr_in6 local6 = {};
+        local6.sin6_family = AF_INET6;
+        local6.sin6_addr = in6addr_any;
+        if (bind(_fd6, (struct sockaddr *)&local6, sizeof(local6)) != 0)
+        {
+            ::close(_fd6);
+            _fd6 = -1;
+        }
+        else
+        {
+            enableRxTimestamps(_fd6);
+        }
+    }
+    return true;
+}
+
+void PosixNetwork::close()
+{
+    if (_fd >= 0)
+    {
+        ::close(_fd);
+        _fd = -1;
+    }
+    if (_fd6 >= 0)
+    {
+        ::close(_fd6);
+        _fd6 = -1;
+    }
+}
+
+bool PosixNetwork::send(const NTPAddress &to, const uint8_t *buf, size_t len)
+{
+    if (to.family == NTPFamily::IPv6)
+    {
+        if (_fd6 < 0)
+            return false;
+        struct sockaddr_in6 dest = {};
+        dest.sin6_family = AF_INET6;
+        memcpy(&dest.sin6_addr, to.ip, 16);
+        dest.sin6_port = htons(to.port);
+        return sendto(_fd6, buf, len, 0, (struct sockaddr *)&dest, sizeof(dest)) == (ssize_t)len;
+    }
+
+    if (_fd < 0)
+        return false;
+    struct sockaddr_in dest = {};
+    dest.sin_family = AF_INET;
+    memcpy(&dest.sin_addr.s_addr, to.ip, 4);
+    dest.sin_port = htons(to.port);
+    return sendto(_fd, buf, len, 0, (struct sockaddr *)&dest, sizeof(dest)) == (ssize_t)len;
+}
+
+int PosixNetwork::receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs)
+{
+    int64_t rxMonotonicUs;
+    return receiveStamped(buf, len, from, timeoutMs, rxMonotonicUs);
+}
+
+/**
+ * @brief Marca o instante da transmissão logo antes do sendto()
+ *
+ * O timestamp de transmissão do kernel (SO_TIMESTAMPING) só sai pela
+ * fila de erros do socket; a diferença para esta leitura é a própria
+ * chamada de sistema, sem espera do escalonador.
+ */
+bool PosixNetwork::sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                               int64_t &txMonotonicUs)
+{
+    txMonotonicUs = clockUs(CLOCK_MONOTONIC);
+    return send(to, buf, len);
+}
+
+/**
+ * @brief Recebe um datagrama com o timestamp de chegada do kernel
+ *
+ * O kernel marca o datagrama com CLOCK_REALTIME (SO_TIMESTAMPNS) quando
+ * ele chega ao socket; a idade do pacote é descontada de
+ * CLOCK_MONOTONIC. Assim, o tempo até a tarefa acordar e ler o socket
+ * não entra no t4. Sem o timestamp, usa o instante logo após recvmsg().
+ */
+int PosixNetwork::receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                                 int64_t &rxMonotonicUs)
+{
+    if (_fd < 0)
+        return -1;
+
+    struct pollfd pfd[2] = {{_fd, POLLIN, 0}, {_fd6, POLLIN, 0}};
+    int ready = poll(pfd, _fd6 >= 0 ? 2 : 1, (int)timeoutMs);
+    if (ready <= 0)
+        return ready;
+
+    struct sockaddr_storage src = {};
+    struct iovec iov = {buf, len};
+    alignas(struct cmsghdr) char control[CMSG_SPACE(sizeof(struct timespec))];
+    struct msghdr msg = {};
+    msg.msg_name = &src;
+    msg.msg_namelen = sizeof(src);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+
+    int fd = (pfd[0].revents & POLLIN) ? _fd : _fd6;
+    ssize_t n = recvmsg(fd, &msg, 0);
+    int64_t monotonicUs = clockUs(CLOCK_MONOTONIC);
+    if (n < 0)
+        return -1;
+
+    rxMonotonicUs = monotonicUs;
+#ifdef SO_TIMESTAMPNS
+    for (struct cmsghdr *c = CMSG_FIRSTHDR(&msg); c != nullptr; c = CMSG_NXTHDR(&msg, c))
+    {
+        if (c->cmsg_level != SOL_SOCKET || c->cmsg_type != SCM_TIMESTAMPNS)
+            continue;
+        struct timespec ts;
+        memcpy(&ts, CMSG_DATA(c), sizeof(ts));
+        int64_t ageUs = clockUs(CLOCK_REALTIME) - ((int64_t)ts.tv_sec * 1000000LL + ts.tv_nsec / 1000);
+        if (ageUs > 0) // Negativo só se CLOCK_REALTIME voltou
+            rxMonotonicUs = monotonicUs - ageUs;
+        break;
+    }
+#endif
+
+    fromSockaddr(src, from);
+    return (int)n;
+}
+
+/**
+ * @brief Abre o socket do servidor; IPv6 de pilha dupla ou, sem IPv6, IPv4
+ */
+bool PosixNetwork::listen(uint16_t &port)
+{
+    unlisten();
+    _serverV6 = true;
+    _serverFd = socket(AF_INET6, SOCK_DGRAM, 0);
+    if (_serverFd >= 0)
+    {
+        int only = 0;
+        setsockopt(_serverFd, IPPROTO_IPV6, IPV6_V6ONLY, &only, sizeof(only));
+    }
+    else
+    {
+        _serverV6 = false;
+        _serverFd = socket(AF_INET, SOCK_DGRAM, 0);
+        if (_serverFd < 0)
+            return false;
+    }
+
+    // Rajadas de pedidos não devem transbordar a fila do kernel
+    int rcvbuf = 1 << 20;
+    setsockopt(_serverFd, SOL_SOCKET, SO_RCVBUF, &rcvbuf, sizeof(rcvbuf));
+
+    NTPAddress any = {};
+    any.family = _serverV6 ? NTPFamily::IPv6 : NTPFamily::IPv4;
+    any.port = port;
+    struct sockaddr_storage local;
+    socklen_t localLen = toSockaddr(any, _serverV6, local);
+    if (bind(_serverFd, (struct sockaddr *)&local, localLen) != 0 ||
+        getsockname(_serverFd, (struct sockaddr *)&local, &localLen) != 0)
+    {
+        unlisten();
+        return false;
+    }
+    fromSockaddr(local, any);
+    port = any.port;
+    return true;
+}
+
+void PosixNetwork::unlisten()
+{
+    if (_serverFd >= 0)
+    {
+        ::close(_serverFd);
+        _serverFd = -1;
+    }
+}
+
+int PosixNetwork::receiveBatch(NTPDatagram *batch, size_t count, uint32_t timeoutMs)
+{
+    if (_serverFd < 0)
+        return -1;
+
+    struct pollfd pfd = {_serverFd, POLLIN, 0};
+    int ready = poll(&pfd, 1, (int)timeoutMs);
+    if (ready <= 0)
+        return ready;
+
+    count = std::min(count, (size_t)NTP_SERVER_BATCH);
+    struct sockaddr_storage peers[NTP_SERVER_BATCH];
+#if defined(__linux__)
+    struct mmsghdr msgs[NTP_SERVER_BATCH];
+    struct iovec iov[NTP_SERVER_BATCH];
+    memset(msgs, 0, sizeof(msgs[0]) * count);
+    for (size_t i = 0; i < count; i++)
+    {
+        iov[i] = {batch[i].data, sizeof(batch[i].data)};
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+        msgs[i].msg_hdr.msg_name = &peers[i];
+        msgs[i].msg_hdr.msg_namelen = sizeof(peers[i]);
+    }
+    int n = recvmmsg(_serverFd, msgs, (unsigned)count, MSG_DONTWAIT, nullptr);
+    if (n < 0)
+        return (errno == EAGAIN || errno == EWOULDBLOCK) ? 0 : -1;
+    for (int i = 0; i < n; i++)
+    {
+        batch[i].len = (uint16_t)std::min<size_t>(msgs[i].msg_len, sizeof(batch[i].data));
+        fromSockaddr(peers[i], batch[i].peer);
+    }
+    return n;
+#else
+    int n = 0;
+    while ((size_t)n < count)
+    {
+        socklen_t peerLen = sizeof(peers[n]);
+        ssize_t len = recvfrom(_serverFd, batch[n].data, sizeof(batch[n].data), MSG_DONTWAIT,
+                               (struct sockaddr *)&peers[n], &peerLen);
+        if (len < 0)
+            break;
+        batch[n].len = (uint16_t)len;
+        fromSockaddr(peers[n], batch[n].peer);
+        n++;
+    }
+    return n;
+#endif
+}
+
+int PosixNetwork::sendBatch(const NTPDatagram *batch, size_t count)
+{
+    if (_serverFd < 0)
+        return -1;
+
+    count = std::min(count, (size_t)NTP_SERVER_BATCH);
+    struct sockaddr_storage peers[NTP_SERVER_BATCH];
+#if defined(__linux__)
+    struct mmsghdr msgs[NTP_SERVER_BATCH];
+    struct iovec iov[NTP_SERVER_BATCH];
+    unsigned used = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        socklen_t peerLen = toSockaddr(batch[i].peer, _serverV6, peers[used]);
+        if (peerLen == 0)
+            continue;
+        memset(&msgs[used], 0, sizeof(msgs[used]));
+        iov[used] = {(void *)batch[i].data, batch[i].len};
+        msgs[used].msg_hdr.msg_iov = &iov[used];
+        msgs[used].msg_hdr.msg_iovlen = 1;
+        msgs[used].msg_hdr.msg_name = &peers[used];
+        msgs[used].msg_hdr.msg_namelen = peerLen;
+        used++;
+    }
+    return used > 0 ? sendmmsg(_serverFd, msgs, used, 0) : 0;
+#else
+    int sent = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        socklen_t peerLen = toSockaddr(batch[i].peer, _serverV6, peers[0]);
+        if (peerLen > 0 && sendto(_serverFd, batch[i].data, batch[i].len, 0,
+                                  (struct sockaddr *)&peers[0], peerLen) == (ssize_t)batch[i].len)
+            sent++;
+    }
+    return sent;
+#endif
+}
+
+// ----------------------------------------------------
+//
+//               PosixClock
+//
+// ----------------------------------------------------
+
+PosixClock::PosixClock(double slewRatePpm)
+    : _slewRatePpm(slewRatePpm),
+      _offsetUs(0),
+      _pendingUs(0),
+      _settledAtUs(clockUs(CLOCK_MONOTONIC)),
+      _rng(std::random_device{}())
+{
+}
+
+uint32_t PosixClock::millis()
+{
+    return (uint32_t)(clockUs(CLOCK_MONOTONIC) / 1000);
+}
+
+int64_t PosixClock::monotonicUs()
+{
+    return clockUs(CLOCK_MONOTONIC);
+}
+
+void PosixClock::now(struct timeval &tv)
+{
+    int64_t us = clockUs(CLOCK_REALTIME) + correctionUs();
+    tv.tv_sec = (time_t)(us / 1000000LL);
+    tv.tv_usec = (suseconds_t)(us % 1000000LL);
+}
+
+void PosixClock::step(int64_t offsetUs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(clockUs(CLOCK_MONOTONIC));
+    _offsetUs += offsetUs;
+}
+
+void PosixClock::slew(int64_t offsetUs)
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(clockUs(CLOCK_MONOTONIC));
+    _pendingUs += offsetUs;
+}
+
+void PosixClock::sleepMs(uint32_t ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+bool PosixClock::rtcUs(int64_t &us)
+{
+    us = clockUs(CLOCK_BOOTTIME);
+    return true;
+}
+
+uint32_t PosixClock::rtcTolerancePpm()
+{
+    return NTP_POSIX_RTC_TOLERANCE_PPM;
+}
+
+uint32_t PosixClock::random()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    return (uint32_t)_rng();
+}
+
+/**
+ * @brief Correção total já aplicada sobre CLOCK_REALTIME
+ */
+int64_t PosixClock::correctionUs()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(clockUs(CLOCK_MONOTONIC));
+    return _offsetUs;
+}
+
+/**
+ * @brief Parte do slew que ainda não foi aplicada
+ */
+int64_t PosixClock::pendingSlewUs()
+{
+    std::lock_guard<std::mutex> lock(_lock);
+    settle(clockUs(CLOCK_MONOTONIC));
+    return _pendingUs;
+}
+
+/**
+ * @brief Move para o offset a parte do slew correspondente ao tempo
+ *        decorrido desde a última chamada
+ *
+ * Só consome o tempo equivalente aos microssegundos aplicados: com
+ * leituras a menos de 1 / slewRatePpm s umas das outras, o tempo
+ * decorrido se acumula até valer 1 us, em vez de ser descartado.
+ */
+void PosixClock::settle(int64_t monotonicUs)
+{
+    int64_t elapsed = monotonicUs - _settledAtUs;
+    if (_pendingUs == 0)
+        _settledAtUs = monotonicUs;
+    if (_pendingUs == 0 || elapsed <= 0)
+        return;
+
+    int64_t budget = (int64_t)(elapsed * _slewRatePpm / 1000000.0);
+    if (budget == 0)
+        return;
+    _settledAtUs += std::min(elapsed, (int64_t)(budget * 1000000.0 / _slewRatePpm));
+    int64_t applied = _pendingUs > 0 ? std::min(_pendingUs, budget) : std::max(_pendingUs, -budget);
+    _offsetUs += applied;
+    _pendingUs -= applied;
+}
+
+// ----------------------------------------------------
+//
+//               PosixStorage
+//
+// ----------------------------------------------------
+
+bool PosixStorage::begin(const char *name, bool readOnly)
+{
+    _namespace = name;
+    _readOnly = readOnly;
+    return true;
+}
+
+void PosixStorage::end()
+{
+    _namespace.clear();
+    _readOnly = true;
+}
+
+bool PosixStorage::isKey(const char *key)
+{
+    return _values.count(_namespace + "/" + key) > 0;
+}
+
+uint32_t PosixStorage::getU32(const char *key, uint32_t defaultValue)
+{
+    get(key, &defaultValue, sizeof(defaultValue));
+    return defaultValue;
+}
+
+void PosixStorage::putU32(const char *key, uint32_t value)
+{
+    put(key, &value, sizeof(value));
+}
+
+int32_t PosixStorage::getI32(const char *key, int32_t defaultValue)
+{
+    get(key, &defaultValue, sizeof(defaultValue));
+    return defaultValue;
+}
+
+void PosixStorage::putI32(const char *key, int32_t value)
+{
+    put(key, &value, sizeof(value));
+}
+
+float PosixStorage::getFloat(const char *key, float defaultValue)
+{
+    get(key, &defaultValue, sizeof(defaultValue));
+    return defaultValue;
+}
+
+void PosixStorage::putFloat(const char *key, float value)
+{
+    put(key, &value, sizeof(value));
+}
+
+size_t PosixStorage::getBytes(const char *key, void *value, size_t len)
+{
+    auto it = _values.find(_namespace + "/" + key);
+    if (it == _values.end() || it->second.size() > len)
+        return 0;
+    memcpy(value, it->second.data(), it->second.size());
+    return it->second.size();
+}
+
+size_t PosixStorage::putBytes(const char *key, const void *value, size_t len)
+{
+    if (_readOnly || _namespace.empty())
+        return 0;
+    put(key, value, len);
+    return len;
+}
+
+bool PosixStorage::get(const char *key, void *value, size_t len)
+{
+    auto it = _values.find(_namespace + "/" + key);
+    if (it == _values.end() || it->second.size() != len)
+        return false;
+    memcpy(value, it->second.data(), len);
+    return true;
+}
+
+void PosixStorage::put(const char *key, const void *value, size_t len)
+{
+    if (_readOnly || _namespace.empty())
+        return;
+    _values[_namespace + "/" + key].assign((const char *)value, len);
+}
+
+// ----------------------------------------------------
+//
+//               PosixTasking
+//
+// ----------------------------------------------------
+
+bool PosixTasking::start(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+                         uint8_t priority)
+{
+    (void)name;
+    (void)stackSize;
+    (void)priority;
+    std::thread(task, arg).detach();
+    return true;
+}
+
+bool PosixTasking::spawn(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+                         uint8_t priority)
+{
+    return start(task, name, stackSize, arg, priority);
+}
+
+void PosixTasking::wait(uint32_t timeoutMs)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    _wake.wait_for(lock, std::chrono::milliseconds(timeoutMs), [this]
+                   { return _notified; });
+    _notified = false;
+}
+
+void PosixTasking::notify()
+{
+    {
+        std::lock_guard<std::mutex> lock(_lock);
+        _notified = true;
+    }
+    _wake.notify_all();
+}
+
+NTPPlatform ntpDefaultPlatform()
+{
+    static PosixNetwork network;
+    static PosixClock clock;
+    static PosixStorage storage;
+    static PosixTasking tasking;
+    return {&network, &clock, &storage, &tasking};
+}
+
+NTPNetwork *ntpCreateNetwork()
+{
+    return new PosixNetwork();
+}
+
+#endif // !ARDUINO
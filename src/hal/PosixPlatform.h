@@ -0,0 +1,161 @@
+#ifndef NTP_POSIX_PLATFORM_H
+#define NTP_POSIX_PLATFORM_H
+
+#if !defined(ARDUINO)
+
+#include "NTPHal.h"
+#include <atomic>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+
+constexpr double NTP_POSIX_SLEW_RATE_PPM = 500.0; // Mesma taxa do adjtime() do Linux
+constexpr uint32_t NTP_POSIX_RTC_TOLERANCE_PPM = 15; // CLOCK_BOOTTIME usa o oscilador do sistema
+
+/**
+ * @brief Rede POSIX: getaddrinfo() e sockets UDP IPv4/IPv6 em porta efêmera
+ *
+ * Cada consulta DNS roda getaddrinfo() numa thread própria. getaddrinfo()
+ * não informa o TTL dos registros, então resolveResult() devolve 0.
+ *
+ * O modo servidor usa um socket IPv6 de pilha dupla e, no Linux,
+ * recvmmsg()/sendmmsg() para tratar um lote inteiro por chamada.
+ */
+class PosixNetwork : public NTPNetwork
+{
+public:
+    PosixNetwork();
+    ~PosixNetwork() override;
+
+    bool connected() override;
+    int resolveStart(const char *hostname) override;
+    int resolveResult(int query, NTPAddress &address, uint32_t &ttlSec) override;
+    void resolveCancel(int query) override;
+    bool open() override;
+    void close() override;
+    bool send(const NTPAddress &to, const uint8_t *buf, size_t len) override;
+    int receive(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs) override;
+    bool sendStamped(const NTPAddress &to, const uint8_t *buf, size_t len,
+                     int64_t &txMonotonicUs) override;
+    int receiveStamped(uint8_t *buf, size_t len, NTPAddress &from, uint32_t timeoutMs,
+                       int64_t &rxMonotonicUs) override;
+    bool listen(uint16_t &port) override;
+    void unlisten() override;
+    int receiveBatch(NTPDatagram *batch, size_t count, uint32_t timeoutMs) override;
+    int sendBatch(const NTPDatagram *batch, size_t count) override;
+
+private:
+    /**
+     * @brief Consulta compartilhada com a thread de resolução, que pode
+     *        terminar depois de resolveCancel()
+     */
+    struct Lookup
+    {
+        std::atomic<int> state{0}; // Mesmo código de resolveResult()
+        NTPFamily family;
+        uint8_t ip[16];
+    };
+
+    int _fd;
+    int _fd6; // -1 se o host não tiver IPv6
+    int _serverFd;
+    bool _serverV6; // _serverFd é de pilha dupla: IPv4 chega como ::ffff:a.b.c.d
+    std::shared_ptr<Lookup> _lookups[NTP_MAX_DNS_QUERIES];
+};
+
+/**
+ * @brief Relógio de software sobre CLOCK_REALTIME/CLOCK_MONOTONIC
+ *
+ * Ajustar o relógio do host exige privilégios, então as correções de
+ * step e slew são acumuladas em um offset próprio somado a
+ * CLOCK_REALTIME. O slew é aplicado à taxa máxima de slewRatePpm, como
+ * faz o adjtime().
+ *
+ * O domínio RTC é o CLOCK_BOOTTIME, que continua contando durante a
+ * suspensão e entre execuções do processo no mesmo boot do host.
+ */
+class PosixClock : public NTPClock
+{
+public:
+    explicit PosixClock(double slewRatePpm = NTP_POSIX_SLEW_RATE_PPM);
+
+    uint32_t millis() override;
+    int64_t monotonicUs() override;
+    void now(struct timeval &tv) override;
+    void step(int64_t offsetUs) override;
+    void slew(int64_t offsetUs) override;
+    int64_t pendingSlewUs() override;
+    void sleepMs(uint32_t ms) override;
+    bool rtcUs(int64_t &us) override;
+    uint32_t rtcTolerancePpm() override;
+    uint32_t random() override;
+
+    int64_t correctionUs();
+
+private:
+    std::mutex _lock;
+    double _slewRatePpm;
+    int64_t _offsetUs;
+    int64_t _pendingUs;
+    int64_t _settledAtUs;
+    std::mt19937 _rng;
+
+    void settle(int64_t monotonicUs);
+};
+
+/**
+ * @brief Armazenamento em memória com a semântica do Preferences
+ *
+ * O conteúdo dura enquanto o objeto existir, o que basta para testes e
+ * benchmarks que simulam reinícios na mesma execução.
+ */
+class PosixStorage : public NTPStorage
+{
+public:
+    bool begin(const char *name, bool readOnly) override;
+    void end() override;
+    bool isKey(const char *key) override;
+
+    uint32_t getU32(const char *key, uint32_t defaultValue) override;
+    void putU32(const char *key, uint32_t value) override;
+    int32_t getI32(const char *key, int32_t defaultValue) override;
+    void putI32(const char *key, int32_t value) override;
+    float getFloat(const char *key, float defaultValue) override;
+    void putFloat(const char *key, float value) override;
+    size_t getBytes(const char *key, void *value, size_t len) override;
+    size_t putBytes(const char *key, const void *value, size_t len) override;
+
+private:
+    std::map<std::string, std::string> _values;
+    std::string _namespace;
+    bool _readOnly = true;
+
+    bool get(const char *key, void *value, size_t len);
+    void put(const char *key, const void *value, size_t len);
+};
+
+/**
+ * @brief Tarefas como std::thread destacadas
+ */
+class PosixTasking : public NTPTasking
+{
+public:
+    bool start(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+               uint8_t priority) override;
+    void wait(uint32_t timeoutMs) override;
+    void notify() override;
+    bool spawn(void (*task)(void *), const char *name, uint32_t stackSize, void *arg,
+               uint8_t priority) override;
+
+private:
+    std::mutex _lock;
+    std::condition_variable _wake;
+    bool _notified = false;
+};
+
+#endif // !ARDUINO
+
+#endif // NTP_POSIX_PLATFORM_H
@@ -0,0 +1,58 @@
+/**
+ * @file ClockTest.cpp
+ * @brief Testes do slew dos relógios de host sob leituras frequentes
+ *
+ * Cada leitura consome o tempo decorrido desde a anterior; lidas em laço,
+ * as correções precisam continuar avançando na taxa de slew.
+ */
+
+#include "Test.h"
+#include <hal/PosixPlatform.h>
+
+constexpr int64_t TEST_SLEW_US = 1000000;
+constexpr int64_t TEST_LOOP_US = 200000;
+
+// Arredondamento do slew e as leituras de monotonicUs() fora do laço
+constexpr double TEST_SLEW_TOLERANCE_US = 2;
+
+NTP_TEST(clockPosixTightLoop)
+{
+    PosixClock clock;
+    int64_t startUs = clock.monotonicUs();
+    clock.slew(TEST_SLEW_US);
+
+    int64_t elapsedUs = 0;
+    while (elapsedUs < TEST_LOOP_US)
+    {
+        clock.correctionUs();
+        elapsedUs = clock.monotonicUs() - startUs;
+    }
+
+    int64_t appliedUs = TEST_SLEW_US - clock.pendingSlewUs();
+    NTP_CHECK_NEAR(appliedUs, elapsedUs * NTP_POSIX_SLEW_RATE_PPM / 1000000,
+                   TEST_SLEW_TOLERANCE_US);
+}
+
+/**
+ * NTPSoftClock lido por now() em laço, como faz quem consulta a hora a
+ * cada iteração do loop().
+ */
+NTP_TEST(clockSoftTightLoop)
+{
+    PosixClock base;
+    NTPSoftClock clock(&base);
+    int64_t startUs = clock.monotonicUs();
+    clock.slew(TEST_SLEW_US);
+
+    int64_t elapsedUs = 0;
+    while (elapsedUs < TEST_LOOP_US)
+    {
+        struct timeval tv;
+        clock.now(tv);
+        elapsedUs = clock.monotonicUs() - startUs;
+    }
+
+    int64_t appliedUs = TEST_SLEW_US - clock.pendingSlewUs();
+    NTP_CHECK_NEAR(appliedUs, elapsedUs * NTP_SOFT_SLEW_RATE_PPM / 1000000.0,
+                   TEST_SLEW_TOLERANCE_US);
+}
@@ -0,0 +1,64 @@
+/**
+ * @file DisciplineTest.cpp
+ * @brief Testes da medição inicial de frequência do ClockDiscipline
+ *
+ * Os offsets simulam um oscilador com TEST_DRIFT_PPM de deriva corrigido
+ * só pelas ações devolvidas: entre dois ajustes, o offset cresce
+ * TEST_DRIFT_PPM microssegundos por segundo.
+ */
+
+#include "Test.h"
+#include <ClockDiscipline.h>
+
+constexpr double TEST_DRIFT_PPM = 40;
+constexpr uint32_t TEST_START_MS = 1000;
+constexpr int64_t TEST_INITIAL_OFFSET_US = 2500000;
+
+/**
+ * Atualizações mais frequentes que NTP_MIN_FREQ_INTERVAL_S não podem
+ * reiniciar a medição, senão a frequência nunca seria estimada.
+ */
+NTP_TEST(disciplineFrequentUpdates)
+{
+    ClockDiscipline discipline;
+    NTP_CHECK(discipline.update(TEST_INITIAL_OFFSET_US, TEST_START_MS) ==
+              ClockDiscipline::Action::Step);
+    NTP_CHECK(discipline.state() == ClockDiscipline::State::Frequency);
+
+    uint32_t elapsedS = 16;
+    while (elapsedS < NTP_MIN_FREQ_INTERVAL_S)
+    {
+        int64_t offsetUs = (int64_t)(TEST_DRIFT_PPM * elapsedS);
+        NTP_CHECK(discipline.update(offsetUs, TEST_START_MS + elapsedS * 1000) ==
+                  ClockDiscipline::Action::Ignore);
+        elapsedS += 16;
+    }
+
+    int64_t offsetUs = (int64_t)(TEST_DRIFT_PPM * elapsedS);
+    NTP_CHECK(discipline.update(offsetUs, TEST_START_MS + elapsedS * 1000) ==
+              ClockDiscipline::Action::Slew);
+    NTP_CHECK(discipline.state() == ClockDiscipline::State::Sync);
+    NTP_CHECK(discipline.frequencyKnown());
+    NTP_CHECK_NEAR(discipline.frequencyPpm(), TEST_DRIFT_PPM, 0.1);
+}
+
+/**
+ * Com uma sincronização por hora, a deriva acumulada passa do limite de
+ * step: o próprio step serve de medição da frequência.
+ */
+NTP_TEST(disciplineFrequencyFromStep)
+{
+    ClockDiscipline discipline;
+    discipline.update(TEST_INITIAL_OFFSET_US, TEST_START_MS);
+
+    uint32_t intervalS = 3600;
+    int64_t offsetUs = (int64_t)(TEST_DRIFT_PPM * intervalS);
+    NTP_CHECK(discipline.update(offsetUs, TEST_START_MS + intervalS * 1000) ==
+              ClockDiscipline::Action::Step);
+    NTP_CHECK(discipline.state() == ClockDiscipline::State::Sync);
+    NTP_CHECK(discipline.frequencyKnown());
+    NTP_CHECK_NEAR(discipline.frequencyPpm(), TEST_DRIFT_PPM, 0.1);
+
+    // Compensada a deriva, a hora seguinte não precisa de novo step
+    NTP_CHECK_NEAR(discipline.tick(TEST_START_MS + 2 * intervalS * 1000), offsetUs, 1);
+}
@@ -0,0 +1,256 @@
+/**
+ * @file LoopbackTest.cpp
+ * @brief Sincronizações de ponta a ponta contra servidores em loopback
+ *
+ * Usa os backends POSIX com um PosixClock próprio, que corrige só a si
+ * mesmo: o relógio do sistema não é tocado. O horário corrigido é
+ * comparado ao offset de cada servidor, contando o slew ainda pendente.
+ */
+
+#include "Test.h"
+#include <LoopbackServer.h>
+#include <NTPSync.h>
+#include <algorithm>
+#include <hal/PosixPlatform.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+constexpr size_t TEST_MAX_SERVERS = 4;
+constexpr uint16_t TEST_PACKET_TIMEOUT_MS = 100;
+
+// Loopback: atraso de dezenas de us; a margem cobre o escalonador
+constexpr double TEST_OFFSET_TOLERANCE_US = 2000;
+
+// Com setPathDelayUs, um sleep_for() que atrasa só na ida desloca o offset
+constexpr double TEST_PATH_TOLERANCE_US = 10000;
+
+/**
+ * @brief PosixClock com millis() adiantável
+ *
+ * Simula horas entre sincronizações sem esperá-las: a disciplina, o
+ * filtro e o limite de taxa veem o tempo passar, os timestamps dos
+ * pacotes não. O slew que caberia no intervalo pulado é aplicado de uma
+ * vez.
+ */
+class LoopbackClock : public PosixClock
+{
+public:
+    LoopbackClock() : _skipMs(0) {}
+
+    uint32_t millis() override { return PosixClock::millis() + _skipMs; }
+
+    void skip(uint32_t ms)
+    {
+        _skipMs += ms;
+        int64_t budget = (int64_t)(NTP_POSIX_SLEW_RATE_PPM * ms / 1000);
+        int64_t pending = pendingSlewUs();
+        int64_t applied = pending > 0 ? std::min(pending, budget) : std::max(pending, -budget);
+        slew(-applied);
+        step(applied);
+    }
+
+private:
+    uint32_t _skipMs;
+};
+
+/**
+ * @brief Domínio de tempo independente contra serverCount servidores
+ */
+class LoopbackTest
+{
+public:
+    LoopbackTest(size_t serverCount, NTPSyncClock::SyncMode mode) : _started(true)
+    {
+        std::vector<std::string> hosts;
+        for (size_t i = 0; i < serverCount; i++)
+        {
+            _started = _started && _servers[i].start();
+            hosts.push_back("127.0.0.1:" + std::to_string(_servers[i].port()));
+        }
+
+        _sync.reset(new NTPSyncClock("test", {&_network, &_clock, &_storage, &_tasking}));
+        _sync->setTimeval("UTC", hosts);
+        _sync->setSyncMode(mode);
+        _sync->setPacketTimeout(TEST_PACKET_TIMEOUT_MS);
+    }
+
+    bool started() const { return _started; }
+    LoopbackServer &server(size_t i) { return _servers[i]; }
+    LoopbackClock &clock() { return _clock; }
+    NTPSyncClock &sync() { return *_sync; }
+
+    // Correção já aplicada mais o slew pendente
+    int64_t targetUs() { return _clock.correctionUs() + _clock.pendingSlewUs(); }
+
+    NTPMetrics metrics()
+    {
+        NTPMetrics metrics;
+        _sync->getMetrics(metrics);
+        return metrics;
+    }
+
+private:
+    LoopbackServer _servers[TEST_MAX_SERVERS];
+    PosixNetwork _network;
+    LoopbackClock _clock;
+    PosixStorage _storage;
+    PosixTasking _tasking;
+    std::unique_ptr<NTPSyncClock> _sync; // ~10 KB: fora da pilha
+    bool _started;
+};
+
+NTP_TEST(loopbackSequential)
+{
+    LoopbackTest test(2, NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(test.started());
+    test.server(0).setOffsetUs(2500000);
+    test.server(1).setOffsetUs(2500000);
+
+    NTP_CHECK(test.sync().syncTime(1));
+    NTP_CHECK(test.sync().isTimeSynced());
+    NTP_CHECK_NEAR(test.targetUs(), 2500000, TEST_OFFSET_TOLERANCE_US);
+
+    // O primeiro servidor respondeu: o segundo não é consultado
+    NTP_CHECK(test.server(0).requests() == 1);
+    NTP_CHECK(test.server(1).requests() == 0);
+}
+
+NTP_TEST(loopbackLostReply)
+{
+    LoopbackTest test(1, NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(test.started());
+    test.server(0).setLossPercent(100);
+
+    NTP_CHECK(!test.sync().syncTime(1));
+    NTP_CHECK(!test.sync().isTimeSynced());
+    NTP_CHECK(test.server(0).requests() == 1);
+    NTP_CHECK(test.server(0).replies() == 0);
+    NTP_CHECK(test.targetUs() == 0);
+
+    NTPMetrics metrics = test.metrics();
+    NTP_CHECK(metrics.syncFailed == 1);
+    NTP_CHECK(metrics.servers[0].timeouts == 1);
+}
+
+/**
+ * Uma resposta cuja amostra perde no filtro para outra já usada não
+ * corrige o relógio, mas também não é falha: o tempo segue sincronizado.
+ */
+NTP_TEST(loopbackStaleSample)
+{
+    LoopbackTest test(1, NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(test.started());
+    test.server(0).setOffsetUs(50000);
+    NTP_CHECK(test.sync().syncTime(1));
+
+    test.server(0).setPathDelayUs(2000);
+    NTP_CHECK(test.sync().syncTime(1));
+    NTP_CHECK(test.sync().isTimeSynced());
+    NTP_CHECK_NEAR(test.targetUs(), 50000, TEST_OFFSET_TOLERANCE_US);
+
+    NTPMetrics metrics = test.metrics();
+    NTP_CHECK(metrics.syncSuccess == 1);
+    NTP_CHECK(metrics.syncUnchanged == 1);
+    NTP_CHECK(metrics.syncFailed == 0);
+}
+
+/**
+ * KoD RATE: o servidor não recebe novos pedidos antes do intervalo exigido.
+ */
+NTP_TEST(loopbackKissRate)
+{
+    LoopbackTest test(1, NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(test.started());
+    test.server(0).setKissCode(NTP_KISS_RATE);
+
+    NTP_CHECK(!test.sync().syncTime(1));
+    NTP_CHECK(test.metrics().servers[0].kod == 1);
+
+    test.server(0).setKissCode(0);
+    NTP_CHECK(!test.sync().syncTime(1));
+    NTP_CHECK(test.server(0).requests() == 1);
+    NTP_CHECK(test.metrics().servers[0].throttled == 1);
+    NTP_CHECK(test.targetUs() == 0);
+}
+
+/**
+ * KoD DENY: o servidor é rebaixado e os demais seguem sincronizando.
+ */
+NTP_TEST(loopbackKissDeny)
+{
+    LoopbackTest test(2, NTPSyncClock::SyncMode::Parallel);
+    NTP_CHECK(test.started());
+    test.server(0).setKissCode(NTP_KISS_DENY);
+    test.server(1).setOffsetUs(1000000);
+
+    NTP_CHECK(test.sync().syncTime(1));
+    NTP_CHECK(test.metrics().servers[0].kod == 1);
+    NTP_CHECK_NEAR(test.targetUs(), 1000000, TEST_OFFSET_TOLERANCE_US);
+
+    test.server(0).setKissCode(0);
+    test.sync().syncTime(1);
+    NTP_CHECK(test.server(0).requests() == 1);
+    NTP_CHECK(test.server(1).requests() == 2);
+}
+
+/**
+ * Um servidor 3 s adiantado não pode levar o relógio: três concordam.
+ */
+NTP_TEST(loopbackFalseticker)
+{
+    LoopbackTest test(4, NTPSyncClock::SyncMode::Parallel);
+    NTP_CHECK(test.started());
+    for (size_t i = 0; i < 4; i++)
+    {
+        test.server(i).setOffsetUs(1000000);
+    }
+    test.server(3).setOffsetUs(4000000);
+
+    NTP_CHECK(test.sync().syncTime(1));
+    NTP_CHECK_NEAR(test.targetUs(), 1000000, TEST_OFFSET_TOLERANCE_US);
+    for (size_t i = 0; i < 4; i++)
+    {
+        NTP_CHECK(test.server(i).requests() == 1);
+    }
+}
+
+/**
+ * Sincronizações de hora em hora contra um servidor que se afasta 20 ppm.
+ *
+ * A primeira amostra tem o menor atraso de todas: se fosse reaplicada, o
+ * offset sairia ~0 e a frequência nunca seria medida. Depois da medição,
+ * a compensação de frequência deve manter o relógio certo entre as
+ * sincronizações.
+ */
+NTP_TEST(loopbackRepeatedSyncs)
+{
+    constexpr double driftPpm = 20;
+    constexpr uint32_t intervalMs = 3600000;
+
+    LoopbackTest test(1, NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(test.started());
+    int64_t serverUs = 50000;
+    test.server(0).setOffsetUs(serverUs);
+    NTP_CHECK(test.sync().syncTime(1));
+    NTP_CHECK_NEAR(test.targetUs(), serverUs, TEST_OFFSET_TOLERANCE_US);
+
+    test.server(0).setPathDelayUs(2000);
+    for (int round = 1; round <= 6; round++)
+    {
+        // Compensação de frequência no mesmo período da tarefa de fundo
+        for (uint32_t elapsedMs = 0; elapsedMs < intervalMs; elapsedMs += NTP_DISCIPLINE_TICK_MS)
+        {
+            test.clock().skip(NTP_DISCIPLINE_TICK_MS);
+            test.sync().disciplineTick();
+        }
+        serverUs += (int64_t)(driftPpm * intervalMs / 1000);
+        test.server(0).setOffsetUs(serverUs);
+        if (round >= 2)
+            NTP_CHECK_NEAR(test.targetUs(), serverUs, TEST_PATH_TOLERANCE_US);
+
+        NTP_CHECK(test.sync().syncTime(1));
+        NTP_CHECK_NEAR(test.targetUs(), serverUs, TEST_PATH_TOLERANCE_US);
+    }
+    NTP_CHECK(test.server(0).requests() == 7);
+}
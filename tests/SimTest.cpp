@@ -0,0 +1,53 @@
+/**
+ * @file SimTest.cpp
+ * @brief Testes de regime longo sobre o simulador (extras/sim)
+ *
+ * Mesmas condições do ntpsync_sim: oscilador com 40 ppm de deriva, 2,5 s
+ * de erro inicial e 24 h de tempo virtual, sincronizando a cada hora.
+ */
+
+#include "Test.h"
+#include <SimRun.h>
+
+constexpr uint32_t TEST_SIM_HOURS = 24;
+constexpr double TEST_SIM_DRIFT_PPM = 40;
+constexpr int64_t TEST_SIM_INITIAL_ERROR_US = 2500000;
+
+// 40 ppm × 1 h entre sincronizações, com margem para o jitter
+constexpr double TEST_SIM_MAX_ERROR_US = 160000;
+
+// Com a frequência estimada, a deriva entre sincronizações some
+constexpr double TEST_SIM_SYNCED_ERROR_US = 5000;
+
+static SimResult runIdeal(NTPSyncClock::SyncMode mode)
+{
+    SimWorld world(1, TEST_SIM_DRIFT_PPM, TEST_SIM_INITIAL_ERROR_US);
+    for (int i = 0; i < 4; i++)
+    {
+        world.addServer(SimServerConfig());
+    }
+    SimPolicy policy = {"test", mode, 0, 60, 5, false};
+    return simRun(world, policy, TEST_SIM_HOURS);
+}
+
+/**
+ * Uma amostra antiga de menor atraso não pode ser reaplicada: o erro
+ * cresceria com a deriva a cada sincronização "bem-sucedida".
+ */
+NTP_TEST(simIdealSequential)
+{
+    SimResult result = runIdeal(NTPSyncClock::SyncMode::Sequential);
+    NTP_CHECK(result.synced);
+    NTP_CHECK_NEAR(result.maxErrorUs(), 0, TEST_SIM_MAX_ERROR_US);
+    NTP_CHECK_NEAR(result.percentile(0.5), 0, TEST_SIM_SYNCED_ERROR_US);
+    NTP_CHECK_NEAR(result.finalErrorUs, 0, TEST_SIM_SYNCED_ERROR_US);
+}
+
+NTP_TEST(simIdealParallel)
+{
+    SimResult result = runIdeal(NTPSyncClock::SyncMode::Parallel);
+    NTP_CHECK(result.synced);
+    NTP_CHECK_NEAR(result.maxErrorUs(), 0, TEST_SIM_MAX_ERROR_US);
+    NTP_CHECK_NEAR(result.percentile(0.5), 0, TEST_SIM_SYNCED_ERROR_US);
+    NTP_CHECK_NEAR(result.finalErrorUs, 0, TEST_SIM_SYNCED_ERROR_US);
+}
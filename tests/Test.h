@@ -0,0 +1,37 @@
+#ifndef NTP_TEST_H
+#define NTP_TEST_H
+
+#include <cstdint>
+
+typedef void (*TestFunction)();
+
+struct TestRegistrar
+{
+    TestRegistrar(const char *name, TestFunction function);
+};
+
+bool testCheck(bool ok, const char *expression, const char *file, int line);
+bool testCheckNear(double value, double expected, double tolerance, const char *expression,
+                   const char *file, int line);
+
+/**
+ * @brief Registra um teste; o nome começa pelo grupo (ex.: simIdeal...),
+ *        que o CMake passa em --filter
+ */
+#define NTP_TEST(name)                                   \
+    static void name();                                  \
+    static TestRegistrar name##Registrar(#name, name);   \
+    static void name()
+
+/**
+ * @brief Falha o teste se cond for falso e continua a execução
+ */
+#define NTP_CHECK(cond) testCheck((cond), #cond, __FILE__, __LINE__)
+
+/**
+ * @brief Falha o teste se |value - expected| > tolerance, mostrando os valores
+ */
+#define NTP_CHECK_NEAR(value, expected, tolerance) \
+    testCheckNear((double)(value), (double)(expected), (double)(tolerance), #value, __FILE__, __LINE__)
+
+#endif // NTP_TEST_H
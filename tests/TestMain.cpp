@@ -0,0 +1,94 @@
+/**
+ * @file TestMain.cpp
+ * @brief Harness dos testes da biblioteca
+ *
+ * Uso:
+ *   ntpsync_tests [--filter=prefixo]
+ *
+ * Roda os testes cujo nome começa com o prefixo e retorna 0 se todas as
+ * verificações passarem. O CMake registra no ctest um teste por grupo.
+ */
+
+#include "Test.h"
+#include <NTPSync.h>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+struct TestEntry
+{
+    const char *name;
+    TestFunction function;
+};
+
+static std::vector<TestEntry> &registry()
+{
+    static std::vector<TestEntry> entries;
+    return entries;
+}
+
+static uint32_t failures; // Verificações que falharam no teste atual
+
+TestRegistrar::TestRegistrar(const char *name, TestFunction function)
+{
+    registry().push_back({name, function});
+}
+
+bool testCheck(bool ok, const char *expression, const char *file, int line)
+{
+    if (!ok)
+    {
+        printf("  %s:%d: falhou: %s\n", file, line, expression);
+        failures++;
+    }
+    return ok;
+}
+
+bool testCheckNear(double value, double expected, double tolerance, const char *expression,
+                   const char *file, int line)
+{
+    bool ok = std::fabs(value - expected) <= tolerance;
+    if (!ok)
+    {
+        printf("  %s:%d: falhou: %s = %g, esperado %g ± %g\n", file, line, expression,
+               value, expected, tolerance);
+        failures++;
+    }
+    return ok;
+}
+
+int main(int argc, char **argv)
+{
+    std::string filter;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strncmp(argv[i], "--filter=", 9) == 0)
+            filter = argv[i] + 9;
+        else
+        {
+            fprintf(stderr, "Argumento desconhecido: %s\n", argv[i]);
+            return 2;
+        }
+    }
+
+    NTPSync::logControl(false);
+
+    uint32_t run = 0;
+    uint32_t failed = 0;
+    for (const auto &entry : registry())
+    {
+        if (strncmp(entry.name, filter.c_str(), filter.size()) != 0)
+            continue;
+        failures = 0;
+        entry.function();
+        printf("%s %s\n", failures == 0 ? "[ OK ]" : "[FALHOU]", entry.name);
+        run++;
+        if (failures > 0)
+            failed++;
+    }
+
+    printf("%u testes, %u falharam\n", run, failed);
+    return run > 0 && failed == 0 ? 0 : 1;
+}